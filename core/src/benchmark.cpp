@@ -0,0 +1,493 @@
+/**
+ * @file benchmark.cpp
+ * @brief Benchmark results as JSON, and their comparison with a baseline.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// Standard error of the median of normally distributed samples is
+// sqrt(pi / 2) * sigma / sqrt(n), and sigma is 1.4826 * MAD.
+//
+static const double MEDIAN_ERROR_PER_MAD = 1.2533 * 1.4826;
+
+BenchmarkResult summarizeBenchmark(const char *name, const FrameStats &times)
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.samples = times.count();
+    result.rounds = 1;
+    result.median = times.percentile(50.0);
+    result.mad = times.medianAbsoluteDeviation();
+    result.p95 = times.percentile(95.0);
+    return result;
+}
+
+void combineBenchmarkRounds(const std::vector<std::vector<BenchmarkResult> > &rounds,
+                            std::vector<BenchmarkResult> &results)
+{
+    results.clear();
+    if (rounds.empty())
+    {
+        return;
+    }
+    for (std::size_t i = 0; i < rounds[0].size(); ++i)
+    {
+        BenchmarkResult result = rounds[0][i];
+        FrameStats medians(rounds.size());
+        FrameStats p95s(rounds.size());
+        result.samples = 0;
+        for (std::size_t round = 0; round < rounds.size(); ++round)
+        {
+            const BenchmarkResult &roundResult = rounds[round][i];
+            medians.addSample(roundResult.median);
+            p95s.addSample(roundResult.p95);
+            result.samples += roundResult.samples;
+        }
+        result.rounds = rounds.size();
+        result.median = medians.percentile(50.0);
+        result.mad = medians.medianAbsoluteDeviation();
+        result.p95 = p95s.percentile(50.0);
+        results.push_back(result);
+    }
+}
+
+/**
+ * @brief Writes a string as a JSON string literal.
+ */
+static void writeJsonString(std::FILE *file, const std::string &text)
+{
+    std::fputc('"', file);
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        const unsigned char c = (unsigned char)text[i];
+        if (c == '"' || c == '\\')
+        {
+            std::fprintf(file, "\\%c", c);
+        }
+        else if (c < 0x20)
+        {
+            std::fprintf(file, "\\u%04x", c);
+        }
+        else
+        {
+            std::fputc(c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+bool writeBenchmarkJson(const char *path, const std::string &renderer, const std::vector<BenchmarkResult> &results)
+{
+    std::FILE *file = std::fopen(path, "w");
+    if (file == NULL)
+    {
+        std::cout << "ERROR::BENCHMARK::FILE_NOT_WRITTEN " << path << std::endl;
+        return false;
+    }
+
+    std::fprintf(file, "{\n\"renderer\": ");
+    writeJsonString(file, renderer);
+    std::fprintf(file, ",\n\"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        std::fprintf(file, "%s\n  {\"name\": ", i > 0 ? "," : "");
+        writeJsonString(file, results[i].name);
+        std::fprintf(file, ", \"samples\": %lu, \"rounds\": %lu, \"median\": %.6f, \"mad\": %.6f, \"p95\": %.6f}",
+                     (unsigned long)results[i].samples, (unsigned long)results[i].rounds, results[i].median,
+                     results[i].mad, results[i].p95);
+    }
+    std::fprintf(file, "\n]\n}\n");
+
+    if (std::fclose(file) != 0)
+    {
+        std::cout << "ERROR::BENCHMARK::FILE_NOT_WRITTEN " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Skips whitespace and returns the next character, or 0 at the end.
+ */
+static char peekJson(const std::string &text, std::size_t &at)
+{
+    while (at < text.size() && (text[at] == ' ' || text[at] == '\t' || text[at] == '\n' || text[at] == '\r'))
+    {
+        ++at;
+    }
+    return at < text.size() ? text[at] : '\0';
+}
+
+/**
+ * @brief Reads a JSON string literal; escaped code points beyond ASCII are replaced with '?'.
+ */
+static bool readJsonString(const std::string &text, std::size_t &at, std::string &value)
+{
+    if (peekJson(text, at) != '"')
+    {
+        return false;
+    }
+    value.clear();
+    for (++at; at < text.size(); ++at)
+    {
+        char c = text[at];
+        if (c == '"')
+        {
+            ++at;
+            return true;
+        }
+        if (c == '\\')
+        {
+            if (++at >= text.size())
+            {
+                return false;
+            }
+            c = text[at];
+            if (c == 'n')
+            {
+                c = '\n';
+            }
+            else if (c == 't')
+            {
+                c = '\t';
+            }
+            else if (c == 'u')
+            {
+                if (at + 4 >= text.size())
+                {
+                    return false;
+                }
+                const long code = std::strtol(text.substr(at + 1, 4).c_str(), NULL, 16);
+                c = code < 0x80 ? (char)code : '?';
+                at += 4;
+            }
+            else if (c != '"' && c != '\\' && c != '/')
+            {
+                c = '?';
+            }
+        }
+        value += c;
+    }
+    return false;
+}
+
+/**
+ * @brief Reads a JSON number.
+ */
+static bool readJsonNumber(const std::string &text, std::size_t &at, double &value)
+{
+    peekJson(text, at);
+    const char *start = text.c_str() + at;
+    char *end;
+    value = std::strtod(start, &end);
+    at += end - start;
+    return end != start;
+}
+
+/**
+ * @brief Skips over any JSON value, for fields that are not read.
+ */
+static bool skipJsonValue(const std::string &text, std::size_t &at)
+{
+    const char c = peekJson(text, at);
+    if (c == '"')
+    {
+        std::string ignored;
+        return readJsonString(text, at, ignored);
+    }
+    if (c == '{' || c == '[')
+    {
+        const char close = c == '{' ? '}' : ']';
+        ++at;
+        if (peekJson(text, at) == close)
+        {
+            ++at;
+            return true;
+        }
+        for (;;)
+        {
+            if (c == '{')
+            {
+                std::string key;
+                if (!readJsonString(text, at, key) || peekJson(text, at) != ':')
+                {
+                    return false;
+                }
+                ++at;
+            }
+            if (!skipJsonValue(text, at))
+            {
+                return false;
+            }
+            const char next = peekJson(text, at);
+            ++at;
+            if (next == close)
+            {
+                return true;
+            }
+            if (next != ',')
+            {
+                return false;
+            }
+        }
+    }
+
+    // A number, true, false or null.
+    //
+    const std::size_t start = at;
+    while (at < text.size() && text[at] != ',' && text[at] != '}' && text[at] != ']' && text[at] != ' ' &&
+           text[at] != '\n' && text[at] != '\r' && text[at] != '\t')
+    {
+        ++at;
+    }
+    return at > start;
+}
+
+/**
+ * @brief Reads the members of a JSON object, calling a reader for the value of each.
+ *
+ * @param readMember reads the value of the member with the given key, or skips it; false on a malformed value
+ */
+template <typename MemberReader>
+static bool readJsonObject(const std::string &text, std::size_t &at, MemberReader readMember)
+{
+    if (peekJson(text, at) != '{')
+    {
+        return false;
+    }
+    ++at;
+    if (peekJson(text, at) == '}')
+    {
+        ++at;
+        return true;
+    }
+    for (;;)
+    {
+        std::string key;
+        if (!readJsonString(text, at, key) || peekJson(text, at) != ':')
+        {
+            return false;
+        }
+        ++at;
+        if (!readMember(key))
+        {
+            return false;
+        }
+        const char next = peekJson(text, at);
+        ++at;
+        if (next == '}')
+        {
+            return true;
+        }
+        if (next != ',')
+        {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Reads one entry of the "benchmarks" array.
+ */
+static bool readBenchmarkResult(const std::string &text, std::size_t &at, BenchmarkResult &result)
+{
+    result = BenchmarkResult();
+    result.rounds = 1;
+    bool named = false;
+    const bool read = readJsonObject(text, at,
+                                     [&](const std::string &key) -> bool
+                                     {
+                                         if (key == "name")
+                                         {
+                                             named = true;
+                                             return readJsonString(text, at, result.name);
+                                         }
+                                         if (key == "samples" || key == "rounds")
+                                         {
+                                             double count;
+                                             if (!readJsonNumber(text, at, count))
+                                             {
+                                                 return false;
+                                             }
+                                             (key == "samples" ? result.samples : result.rounds) =
+                                                 count > 0.0 ? (std::size_t)count : 0;
+                                             return true;
+                                         }
+                                         if (key == "median")
+                                         {
+                                             return readJsonNumber(text, at, result.median);
+                                         }
+                                         if (key == "mad")
+                                         {
+                                             return readJsonNumber(text, at, result.mad);
+                                         }
+                                         if (key == "p95")
+                                         {
+                                             return readJsonNumber(text, at, result.p95);
+                                         }
+                                         return skipJsonValue(text, at);
+                                     });
+    return read && named;
+}
+
+bool readBenchmarkJson(const char *path, std::string &renderer, std::vector<BenchmarkResult> &results)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cout << "ERROR::BENCHMARK::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+        return false;
+    }
+    std::stringstream stream;
+    stream << file.rdbuf();
+    const std::string text = stream.str();
+
+    renderer.clear();
+    results.clear();
+    std::size_t at = 0;
+    const bool read = readJsonObject(text, at,
+                                     [&](const std::string &key) -> bool
+                                     {
+                                         if (key == "renderer")
+                                         {
+                                             return readJsonString(text, at, renderer);
+                                         }
+                                         if (key != "benchmarks")
+                                         {
+                                             return skipJsonValue(text, at);
+                                         }
+                                         if (peekJson(text, at) != '[')
+                                         {
+                                             return false;
+                                         }
+                                         ++at;
+                                         if (peekJson(text, at) == ']')
+                                         {
+                                             ++at;
+                                             return true;
+                                         }
+                                         for (;;)
+                                         {
+                                             BenchmarkResult result;
+                                             if (!readBenchmarkResult(text, at, result))
+                                             {
+                                                 return false;
+                                             }
+                                             results.push_back(result);
+                                             const char next = peekJson(text, at);
+                                             ++at;
+                                             if (next == ']')
+                                             {
+                                                 return true;
+                                             }
+                                             if (next != ',')
+                                             {
+                                                 return false;
+                                             }
+                                         }
+                                     });
+    if (!read)
+    {
+        std::cout << "ERROR::BENCHMARK::NOT_A_BENCHMARK_FILE " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Standard error of the median of a benchmark.
+ *
+ * Over the rounds if there were several, as their MAD is then that of the
+ * medians of the rounds, and over the samples otherwise.
+ */
+static double medianError(const BenchmarkResult &result)
+{
+    const std::size_t count = result.rounds > 1 ? result.rounds : result.samples;
+    return count > 0 ? MEDIAN_ERROR_PER_MAD * result.mad / std::sqrt((double)count) : 0.0;
+}
+
+std::size_t compareBenchmarks(const std::vector<BenchmarkResult> &baseline, const std::vector<BenchmarkResult> &results,
+                              std::ostream &out)
+{
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    std::size_t faster = 0;
+    std::size_t slower = 0;
+    std::size_t unchanged = 0;
+    std::size_t added = 0;
+    out << std::fixed;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkResult &result = results[i];
+        const BenchmarkResult *base = NULL;
+        for (std::size_t j = 0; j < baseline.size() && base == NULL; ++j)
+        {
+            if (baseline[j].name == result.name)
+            {
+                base = &baseline[j];
+            }
+        }
+
+        out << "  " << std::left << std::setw(24) << result.name << std::right;
+        if (base == NULL)
+        {
+            out << std::setprecision(3) << "            " << std::setw(9) << result.median << " ms  new" << std::endl;
+            ++added;
+            continue;
+        }
+
+        // The difference of two medians has the errors of both; it also has
+        // to be big enough to matter, or quiet runs flag every tiny drift.
+        //
+        const double difference = result.median - base->median;
+        const double baseError = medianError(*base);
+        const double error = medianError(result);
+        const double noise = BENCHMARK_NOISE_SIGMAS * std::sqrt(baseError * baseError + error * error);
+        const double threshold = std::max(noise, BENCHMARK_MIN_CHANGE * base->median);
+        const char *verdict = "unchanged";
+        if (difference > threshold)
+        {
+            verdict = "SLOWER";
+            ++slower;
+        }
+        else if (-difference > threshold)
+        {
+            verdict = "faster";
+            ++faster;
+        }
+        else
+        {
+            ++unchanged;
+        }
+
+        const double percent = base->median > 0.0 ? 100.0 * difference / base->median : 0.0;
+        out << std::setprecision(3) << std::setw(9) << base->median << " ->" << std::setw(9) << result.median << " ms"
+            << std::setprecision(1) << std::showpos << std::setw(8) << percent << "%" << std::noshowpos << "  ±"
+            << std::setprecision(1) << 100.0 * threshold / std::max(base->median, 1e-9) << "%  " << verdict
+            << std::endl;
+    }
+    out << faster << " faster, " << slower << " slower, " << unchanged << " unchanged";
+    if (added > 0)
+    {
+        out << ", " << added << " new";
+    }
+    out << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+    return slower;
+}
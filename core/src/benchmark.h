@@ -0,0 +1,112 @@
+/**
+ * @file benchmark.h
+ * @brief Benchmark results as JSON, and their comparison with a baseline.
+ *
+ * The results of a run are written out as JSON, one entry per benchmark
+ * with its median, median absolute deviation (MAD) and p95. A later run is
+ * compared with such a file as its baseline. A benchmark only counts as
+ * faster or slower if its median moved by more than the noise of both runs
+ * and by more than a minimum relative change, so reruns of the same build
+ * come out unchanged.
+ *
+ * Samples within a run are not independent: clocks, caches and other load
+ * shift all of them together, so their spread understates how much the
+ * next run differs. Runs therefore repeat the whole suite in rounds, and
+ * the noise is taken from how much the medians of the rounds differ.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "frame_stats.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+const double BENCHMARK_MIN_CHANGE = 0.10;  //!< Smallest relative change of a median that counts, even in quiet runs.
+const double BENCHMARK_NOISE_SIGMAS = 3.0; //!< Standard errors a median has to move by to count.
+
+/**
+ * @brief Summary of the samples of one benchmark, in milliseconds.
+ */
+struct BenchmarkResult
+{
+    std::string name;    //!< Name of the benchmark, unique within a run.
+    std::size_t samples; //!< Number of samples taken, over all rounds.
+    std::size_t rounds;  //!< Number of rounds summarized.
+    double median;       //!< Median of the samples, or of the medians of the rounds.
+    double mad;          //!< Median absolute deviation of the samples, or of the medians of the rounds.
+    double p95;          //!< 95th percentile of the samples, or median of those of the rounds.
+};
+
+/**
+ * @brief Summarizes the samples of a benchmark in one round.
+ *
+ * @param name name of the benchmark
+ * @param times the samples
+ * @return the summary
+ */
+BenchmarkResult summarizeBenchmark(const char *name, const FrameStats &times);
+
+/**
+ * @brief Combines the results of several rounds of the same suite into one per benchmark.
+ *
+ * Each benchmark gets the median and MAD of its medians in the rounds, so
+ * its MAD is the noise from round to round.
+ *
+ * @param rounds results of each round, with the benchmarks in the same order
+ * @param results set to the combined results
+ */
+void combineBenchmarkRounds(const std::vector<std::vector<BenchmarkResult> > &rounds,
+                            std::vector<BenchmarkResult> &results);
+
+/**
+ * @brief Writes the results of a run as JSON.
+ *
+ * An error is printed if the file could not be written.
+ *
+ * @param path file to write
+ * @param renderer GL renderer the run was on, as results on different renderers do not compare
+ * @param results the results
+ * @return true if the file was written
+ */
+bool writeBenchmarkJson(const char *path, const std::string &renderer, const std::vector<BenchmarkResult> &results);
+
+/**
+ * @brief Reads the results of a run written by writeBenchmarkJson().
+ *
+ * Only reads the fields written by writeBenchmarkJson(); others are skipped.
+ * An error is printed if the file could not be read or is not such a file.
+ *
+ * @param path file to read
+ * @param renderer set to the GL renderer the run was on
+ * @param results set to the results
+ * @return true if the file was read
+ */
+bool readBenchmarkJson(const char *path, std::string &renderer, std::vector<BenchmarkResult> &results);
+
+/**
+ * @brief Compares the results of a run with a baseline and writes a report.
+ *
+ * Each benchmark is reported as faster, slower or unchanged, or as new if
+ * the baseline does not have it. The median has to move by more than
+ * BENCHMARK_NOISE_SIGMAS standard errors of the difference, estimated from
+ * the MADs and round counts of both runs, or sample counts for single
+ * rounds, and by more than BENCHMARK_MIN_CHANGE of the baseline median to
+ * count.
+ *
+ * @param baseline results of the baseline run
+ * @param results results of this run
+ * @param out stream to write the report to
+ * @return the number of benchmarks that got slower
+ */
+std::size_t compareBenchmarks(const std::vector<BenchmarkResult> &baseline, const std::vector<BenchmarkResult> &results,
+                              std::ostream &out);
+
+#endif // BENCHMARK_H
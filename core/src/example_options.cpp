@@ -0,0 +1,130 @@
+/**
+ * @file example_options.cpp
+ * @brief Command line options every example takes, for running it headless in tests.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "example_options.h"
+
+#include "image.h"
+#include "profiler.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+/**
+ * @brief Prints the command line usage.
+ *
+ * @param program name the program was invoked with
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "usage: " << program << " [--headless] [--frames N] [--capture FILE] [--frame-budget MS]\n"
+              << "       [--profile FILE]\n"
+              << "  --headless         render offscreen with EGL instead of opening a window\n"
+              << "  --frames N         stop after N frames (default: when the window is closed, or "
+              << DEFAULT_HEADLESS_FRAMES << " headless)\n"
+              << "  --capture FILE     write the last frame to FILE as a PPM image; needs --headless\n"
+              << "  --frame-budget MS  fail if the p95 CPU frame time is over MS milliseconds\n"
+              << "  --profile FILE     write the profiler zones of each frame to FILE as Chrome trace JSON;\n"
+              << "                     needs a build with profiling, the default" << std::endl;
+}
+
+bool parseExampleOptions(int argc, char *argv[], ExampleOptions &options)
+{
+    options.headless = false;
+    options.frames = 0;
+    options.capture = NULL;
+    options.frameBudget = 0.0;
+    options.profile = NULL;
+
+    bool valid = true;
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            char *end;
+            options.frames = std::strtoul(argv[++i], &end, 10);
+            valid = *end == '\0' && options.frames > 0;
+        }
+        else if (std::strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+        {
+            options.capture = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--frame-budget") == 0 && i + 1 < argc)
+        {
+            char *end;
+            options.frameBudget = std::strtod(argv[++i], &end);
+            valid = *end == '\0' && options.frameBudget > 0.0;
+        }
+        else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+#ifdef PROFILING
+            options.profile = argv[++i];
+#else
+            std::cout << "--profile needs a build with profiling, which this one was configured without" << std::endl;
+            valid = false;
+#endif
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+
+    // The frame a window shows is gone once it is swapped, so only headless
+    // frames are captured.
+    //
+    valid = valid && (options.capture == NULL || options.headless);
+    if (!valid)
+    {
+        printUsage(argv[0]);
+        return false;
+    }
+    if (options.headless && options.frames == 0)
+    {
+        options.frames = DEFAULT_HEADLESS_FRAMES;
+    }
+    return true;
+}
+
+bool createExampleWindow(Window &window, const ExampleOptions &options, int width, int height, const char *title)
+{
+    if (options.profile != NULL)
+    {
+        profilerStart();
+    }
+    return options.headless ? window.createHeadless(width, height) : window.create(width, height, title);
+}
+
+bool finishExampleRun(const ExampleOptions &options, const Window &window, const FrameStats &frameTimes)
+{
+    bool passed = true;
+    if (options.capture != NULL)
+    {
+        passed = captureFramebuffer(options.capture, window.width(), window.height());
+    }
+    if (options.headless || options.frameBudget > 0.0)
+    {
+        std::cout << frameTimes.added() << " frames at " << window.width() << "x" << window.height() << " on "
+                  << glGetString(GL_RENDERER) << std::endl;
+        frameTimes.report(std::cout, "cpu frame");
+    }
+    if (options.profile != NULL)
+    {
+        profilerReport(std::cout);
+        if (profilerWrite(options.profile))
+        {
+            std::cout << "  profile written to " << options.profile << std::endl;
+        }
+    }
+    return checkFrameBudget(frameTimes, options.frameBudget) && passed;
+}
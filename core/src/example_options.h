@@ -0,0 +1,76 @@
+/**
+ * @file example_options.h
+ * @brief Command line options every example takes, for running it headless in tests.
+ *
+ * Without options an example opens its window and runs until it is closed.
+ * With --headless it renders offscreen instead, for a fixed number of frames,
+ * and can write its last frame out and check its frame times against a
+ * budget, which is how the tests run it on machines without a display.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef EXAMPLE_OPTIONS_H
+#define EXAMPLE_OPTIONS_H
+
+#include "frame_stats.h"
+#include "window.h"
+
+#include <ostream>
+
+const unsigned long DEFAULT_HEADLESS_FRAMES = 100; //!< Frames rendered headless unless --frames is given.
+
+/**
+ * @brief Options selected on the command line.
+ */
+struct ExampleOptions
+{
+    bool headless;        //!< Render offscreen instead of to a window.
+    unsigned long frames; //!< Frames to render before exiting, or 0 to run until the window is closed.
+    const char *capture;  //!< File to write the last frame to as a PPM image, or NULL.
+    double frameBudget;   //!< Most the p95 CPU frame time may be, in milliseconds, or 0 for no budget.
+    const char *profile;  //!< File to write the profiler zones to as a Chrome trace, or NULL.
+};
+
+/**
+ * @brief Parses the command line, printing the usage if it is not valid.
+ *
+ * @param argc number of arguments
+ * @param argv the arguments
+ * @param options receives the parsed options
+ * @return true if the command line was valid
+ */
+bool parseExampleOptions(int argc, char *argv[], ExampleOptions &options);
+
+/**
+ * @brief Opens the window, or creates an offscreen target of its size when headless.
+ *
+ * Starts the profiler first if the options ask for a profile, so it covers
+ * the setup too.
+ *
+ * @param window the window to create
+ * @param options the command line options
+ * @param width width of the window
+ * @param height height of the window
+ * @param title title of the window
+ * @return true if the window was created and the GL functions loaded
+ */
+bool createExampleWindow(Window &window, const ExampleOptions &options, int width, int height, const char *title);
+
+/**
+ * @brief Captures the last frame, reports the frame times, writes the profile and checks the budget, as the
+ * options ask.
+ *
+ * Call once the frame loop has returned, before anything is drawn over the
+ * last frame.
+ *
+ * @param options the command line options
+ * @param window the window the frames were rendered to
+ * @param frameTimes CPU time of each frame
+ * @return false if the capture failed or the budget was exceeded
+ */
+bool finishExampleRun(const ExampleOptions &options, const Window &window, const FrameStats &frameTimes);
+
+#endif // EXAMPLE_OPTIONS_H
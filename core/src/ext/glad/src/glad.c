@@ -0,0 +1,3446 @@
+/*
+
+    OpenGL loader generated by glad 0.1.36 on Sun Jun 30 16:13:18 2024, then
+    modified by hand. Regenerating it with the command line below drops the
+    additions, which would have to be merged back in:
+
+        - Extension lookup: a hash table of the context's extension names,
+          built by get_exts(), which gladHasExtension() probes.
+        - Tracing (GL_TRACE only): glad_trace_next_<name> pointers, a shim
+          per function, trace_install() and gladSetTraceHooks() and the
+          gladTrace*() queries.
+        - Lazy loading: lazy_resolve(), a trampoline per function,
+          lazy_<version>() and gladLoadGLLoaderLazy().
+        - glad_proc_from_object(), which converts what the loader returns
+          to a function pointer without a cast ISO C forbids.
+
+    Language/Generator: C/C++
+    Specification: gl
+    APIs: gl=3.3
+    Profile: core
+    Extensions:
+        GL_ARB_debug_output,
+        GL_ARB_get_program_binary,
+        GL_ARB_pipeline_statistics_query,
+        GL_KHR_debug,
+        GL_KHR_parallel_shader_compile
+    Loader: True
+    Local files: False
+    Omit khrplatform: False
+    Reproducible: False
+
+    Commandline:
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_debug_output,GL_ARB_get_program_binary,GL_ARB_pipeline_statistics_query,GL_KHR_debug,GL_KHR_parallel_shader_compile"
+    Online:
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_debug_output&extensions=GL_ARB_get_program_binary&extensions=GL_ARB_pipeline_statistics_query&extensions=GL_KHR_debug&extensions=GL_KHR_parallel_shader_compile
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+
+static void* get_proc(const char *namez);
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#ifndef _WINDOWS_
+#undef APIENTRY
+#endif
+#include <windows.h>
+static HMODULE libGL;
+
+typedef void* (APIENTRYP PFNWGLGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+
+#ifdef _MSC_VER
+#ifdef __has_include
+  #if __has_include(<winapifamily.h>)
+    #define HAVE_WINAPIFAMILY 1
+  #endif
+#elif _MSC_VER >= 1700 && !_USING_V110_SDK71_
+  #define HAVE_WINAPIFAMILY 1
+#endif
+#endif
+
+#ifdef HAVE_WINAPIFAMILY
+  #include <winapifamily.h>
+  #if !WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_APP)
+    #define IS_UWP 1
+  #endif
+#endif
+
+static
+int open_gl(void) {
+#ifndef IS_UWP
+    libGL = LoadLibraryW(L"opengl32.dll");
+    if(libGL != NULL) {
+        void (* tmp)(void);
+        tmp = (void(*)(void)) GetProcAddress(libGL, "wglGetProcAddress");
+        gladGetProcAddressPtr = (PFNWGLGETPROCADDRESSPROC_PRIVATE) tmp;
+        return gladGetProcAddressPtr != NULL;
+    }
+#endif
+
+    return 0;
+}
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        FreeLibrary((HMODULE) libGL);
+        libGL = NULL;
+    }
+}
+#else
+#include <dlfcn.h>
+static void* libGL;
+
+#if !defined(__APPLE__) && !defined(__HAIKU__)
+typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+#endif
+
+static
+int open_gl(void) {
+#ifdef __APPLE__
+    static const char *NAMES[] = {
+        "../Frameworks/OpenGL.framework/OpenGL",
+        "/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+    };
+#else
+    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
+#endif
+
+    unsigned int index = 0;
+    for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
+        libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
+
+        if(libGL != NULL) {
+#if defined(__APPLE__) || defined(__HAIKU__)
+            return 1;
+#else
+            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
+                "glXGetProcAddressARB");
+            return gladGetProcAddressPtr != NULL;
+#endif
+        }
+    }
+
+    return 0;
+}
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        dlclose(libGL);
+        libGL = NULL;
+    }
+}
+#endif
+
+static
+void* get_proc(const char *namez) {
+    void* result = NULL;
+    if(libGL == NULL) return NULL;
+
+#if !defined(__APPLE__) && !defined(__HAIKU__)
+    if(gladGetProcAddressPtr != NULL) {
+        result = gladGetProcAddressPtr(namez);
+    }
+#endif
+    if(result == NULL) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+        result = (void*)GetProcAddress((HMODULE) libGL, namez);
+#else
+        result = dlsym(libGL, namez);
+#endif
+    }
+
+    return result;
+}
+
+int gladLoadGL(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoader(&get_proc);
+        close_gl();
+    }
+
+    return status;
+}
+
+struct gladGLversionStruct GLVersion = { 0, 0 };
+
+#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+#define _GLAD_IS_SOME_NEW_VERSION 1
+#endif
+
+static int max_loaded_major;
+static int max_loaded_minor;
+
+/*
+ * Extension names are kept in a single allocation: a hash table, open
+ * addressing with linear probing and at most half full, followed by the
+ * names it points to. It stays after loading, so gladHasExtension answers
+ * from memory in about one probe instead of asking the driver or scanning
+ * hundreds of names.
+ */
+struct glad_ext_slot {
+    unsigned int hash;
+    const char *name; /* NULL for an empty slot. */
+};
+
+static struct glad_ext_slot *exts_table = NULL;
+static unsigned int exts_mask = 0;
+
+static unsigned int hash_ext(const char *name) {
+    /* FNV-1a. */
+    unsigned int hash = 2166136261u;
+    for(; *name != '\0'; name++) {
+        hash = (hash ^ (unsigned char)*name) * 16777619u;
+    }
+    return hash;
+}
+
+static void free_exts(void) {
+    free((void *)exts_table);
+    exts_table = NULL;
+    exts_mask = 0;
+}
+
+static void insert_ext(const char *name) {
+    const unsigned int hash = hash_ext(name);
+    unsigned int slot;
+    for(slot = hash & exts_mask; exts_table[slot].name != NULL; slot = (slot + 1) & exts_mask) {
+        if(exts_table[slot].hash == hash && strcmp(exts_table[slot].name, name) == 0) {
+            return;
+        }
+    }
+    exts_table[slot].hash = hash;
+    exts_table[slot].name = name;
+}
+
+static int get_exts(void) {
+    const char *list = NULL;
+    int count = 0;
+    size_t bytes = 0;
+    unsigned int slots = 16;
+    char *names;
+    int index;
+
+    free_exts();
+
+    /* First count the names and their bytes, to size the allocation. */
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        const char *c;
+        list = (const char *)glGetString(GL_EXTENSIONS);
+        if(list == NULL) {
+            return 0;
+        }
+        for(c = list; *c != '\0'; c++) {
+            if(*c != ' ' && (c == list || c[-1] == ' ')) {
+                count++;
+            }
+        }
+        bytes = (size_t)(c - list) + 1;
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for(index = 0; index < count; index++) {
+            const char *name = (const char *)glGetStringi(GL_EXTENSIONS, index);
+            if(name != NULL) {
+                bytes += strlen(name) + 1;
+            }
+        }
+    }
+#endif
+
+    while(slots < (unsigned int)count * 2) {
+        slots *= 2;
+    }
+    exts_table = (struct glad_ext_slot *)calloc(1, slots * sizeof *exts_table + bytes);
+    if(exts_table == NULL) {
+        return 0;
+    }
+    exts_mask = slots - 1;
+    names = (char *)(exts_table + slots);
+
+    /* Then copy the names in and hash them. */
+    if(list != NULL) {
+        char *word = names;
+        char *c;
+        memcpy(names, list, bytes);
+        for(c = names; ; c++) {
+            if(*c == ' ' || *c == '\0') {
+                const int last = *c == '\0';
+                *c = '\0';
+                if(c != word) {
+                    insert_ext(word);
+                }
+                if(last) {
+                    break;
+                }
+                word = c + 1;
+            }
+        }
+    } else {
+        for(index = 0; index < count; index++) {
+            const char *name = (const char *)glGetStringi(GL_EXTENSIONS, index);
+            if(name != NULL) {
+                const size_t length = strlen(name) + 1;
+                memcpy(names, name, length);
+                insert_ext(names);
+                names += length;
+            }
+        }
+    }
+    return 1;
+}
+
+static int has_ext(const char *ext) {
+    unsigned int hash;
+    unsigned int slot;
+    if(exts_table == NULL || ext == NULL) {
+        return 0;
+    }
+
+    hash = hash_ext(ext);
+    for(slot = hash & exts_mask; exts_table[slot].name != NULL; slot = (slot + 1) & exts_mask) {
+        if(exts_table[slot].hash == hash && strcmp(exts_table[slot].name, ext) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int gladHasExtension(const char *name) {
+    return has_ext(name);
+}
+int GLAD_GL_VERSION_1_0 = 0;
+int GLAD_GL_VERSION_1_1 = 0;
+int GLAD_GL_VERSION_1_2 = 0;
+int GLAD_GL_VERSION_1_3 = 0;
+int GLAD_GL_VERSION_1_4 = 0;
+int GLAD_GL_VERSION_1_5 = 0;
+int GLAD_GL_VERSION_2_0 = 0;
+int GLAD_GL_VERSION_2_1 = 0;
+int GLAD_GL_VERSION_3_0 = 0;
+int GLAD_GL_VERSION_3_1 = 0;
+int GLAD_GL_VERSION_3_2 = 0;
+int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_ARB_debug_output = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_ARB_pipeline_statistics_query = 0;
+int GLAD_GL_KHR_debug = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
+PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
+PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
+PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
+PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
+PFNGLCLEARPROC glad_glClear = NULL;
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
+PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
+PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+PFNGLCOLORMASKPROC glad_glColorMask = NULL;
+PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
+PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
+PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
+PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
+PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
+PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+PFNGLCULLFACEPROC glad_glCullFace = NULL;
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
+PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
+PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
+PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
+PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
+PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
+PFNGLDISABLEPROC glad_glDisable = NULL;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
+PFNGLDISABLEIPROC glad_glDisablei = NULL;
+PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
+PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+PFNGLENABLEPROC glad_glEnable = NULL;
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
+PFNGLENABLEIPROC glad_glEnablei = NULL;
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
+PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
+PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
+PFNGLFINISHPROC glad_glFinish = NULL;
+PFNGLFLUSHPROC glad_glFlush = NULL;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
+PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
+PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
+PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
+PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
+PFNGLGETERRORPROC glad_glGetError = NULL;
+PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
+PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
+PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
+PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
+PFNGLGETSTRINGPROC glad_glGetString = NULL;
+PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+PFNGLHINTPROC glad_glHint = NULL;
+PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
+PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
+PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
+PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+PFNGLISQUERYPROC glad_glIsQuery = NULL;
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
+PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
+PFNGLISSHADERPROC glad_glIsShader = NULL;
+PFNGLISSYNCPROC glad_glIsSync = NULL;
+PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
+PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
+PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
+PFNGLLOGICOPPROC glad_glLogicOp = NULL;
+PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
+PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
+PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
+PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
+PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
+PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
+PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
+PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
+PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
+PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
+PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
+PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
+PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
+PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
+PFNGLSCISSORPROC glad_glScissor = NULL;
+PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
+PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
+PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
+PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
+PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
+PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
+PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
+PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
+PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
+PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
+PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
+PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
+PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
+PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
+PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
+PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
+PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
+PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
+PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
+PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
+PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
+PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
+PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
+PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
+PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
+PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
+PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
+PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
+PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
+PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
+PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
+PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
+PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
+PFNGLVIEWPORTPROC glad_glViewport = NULL;
+PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+PFNGLDEBUGMESSAGECONTROLARBPROC glad_glDebugMessageControlARB = NULL;
+PFNGLDEBUGMESSAGEINSERTARBPROC glad_glDebugMessageInsertARB = NULL;
+PFNGLDEBUGMESSAGECALLBACKARBPROC glad_glDebugMessageCallbackARB = NULL;
+PFNGLGETDEBUGMESSAGELOGARBPROC glad_glGetDebugMessageLogARB = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+static void load_GL_VERSION_1_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	glad_glHint = (PFNGLHINTPROC)load("glHint");
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	glad_glClear = (PFNGLCLEARPROC)load("glClear");
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
+	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
+	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
+	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
+	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static void load_GL_ARB_debug_output(GLADloadproc load) {
+	if(!GLAD_GL_ARB_debug_output) return;
+	glad_glDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC)load("glDebugMessageControlARB");
+	glad_glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC)load("glDebugMessageInsertARB");
+	glad_glDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)load("glDebugMessageCallbackARB");
+	glad_glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC)load("glGetDebugMessageLogARB");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+#ifdef GL_TRACE
+/*
+ * Tracing: once loaded, every pointer that was found is moved to
+ * glad_trace_next_<name> and replaced by a shim that calls the begin hook,
+ * the function and the end hook with its first integer arguments. Lazy
+ * trampolines patch the next pointer instead, so the shim stays in front.
+ * Without GL_TRACE none of this is compiled and calls go straight through.
+ */
+static unsigned long long trace_begin_none(void) {
+    return 0;
+}
+static void trace_end_none(int function, unsigned long long begin, const long long *args) {
+    (void)function; (void)begin; (void)args;
+}
+
+static GLADtracebeginproc trace_begin = trace_begin_none;
+static GLADtraceendproc trace_end = trace_end_none;
+
+#define GLAD_TRACE_UNPACK(a, b, c) { (long long)(a), (long long)(b), (long long)(c) }
+#define GLAD_TRACE(id, ret, type, name, params, args, summary) \
+    static type glad_trace_next_##name = NULL; \
+    static ret APIENTRY glad_trace_##name params { \
+        const long long summarized[GLAD_TRACE_ARGS] = GLAD_TRACE_UNPACK summary; \
+        const unsigned long long begin = trace_begin(); \
+        ret result = glad_trace_next_##name args; \
+        trace_end(id, begin, summarized); \
+        return result; \
+    }
+#define GLAD_TRACE_VOID(id, type, name, params, args, summary) \
+    static type glad_trace_next_##name = NULL; \
+    static void APIENTRY glad_trace_##name params { \
+        const long long summarized[GLAD_TRACE_ARGS] = GLAD_TRACE_UNPACK summary; \
+        const unsigned long long begin = trace_begin(); \
+        glad_trace_next_##name args; \
+        trace_end(id, begin, summarized); \
+    }
+GLAD_TRACE_VOID(0, PFNGLCULLFACEPROC, glCullFace, (GLenum mode), (mode), (mode, 0, 0))
+GLAD_TRACE_VOID(1, PFNGLFRONTFACEPROC, glFrontFace, (GLenum mode), (mode), (mode, 0, 0))
+GLAD_TRACE_VOID(2, PFNGLHINTPROC, glHint, (GLenum target, GLenum mode), (target, mode), (target, mode, 0))
+GLAD_TRACE_VOID(3, PFNGLLINEWIDTHPROC, glLineWidth, (GLfloat width), (width), (0, 0, 0))
+GLAD_TRACE_VOID(4, PFNGLPOINTSIZEPROC, glPointSize, (GLfloat size), (size), (0, 0, 0))
+GLAD_TRACE_VOID(5, PFNGLPOLYGONMODEPROC, glPolygonMode, (GLenum face, GLenum mode), (face, mode), (face, mode, 0))
+GLAD_TRACE_VOID(6, PFNGLSCISSORPROC, glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), (x, y, width))
+GLAD_TRACE_VOID(7, PFNGLTEXPARAMETERFPROC, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), (target, pname, 0))
+GLAD_TRACE_VOID(8, PFNGLTEXPARAMETERFVPROC, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(9, PFNGLTEXPARAMETERIPROC, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param), (target, pname, param))
+GLAD_TRACE_VOID(10, PFNGLTEXPARAMETERIVPROC, glTexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(11, PFNGLTEXIMAGE1DPROC, glTexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels), (target, level, internalformat))
+GLAD_TRACE_VOID(12, PFNGLTEXIMAGE2DPROC, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels), (target, level, internalformat))
+GLAD_TRACE_VOID(13, PFNGLDRAWBUFFERPROC, glDrawBuffer, (GLenum buf), (buf), (buf, 0, 0))
+GLAD_TRACE_VOID(14, PFNGLCLEARPROC, glClear, (GLbitfield mask), (mask), (mask, 0, 0))
+GLAD_TRACE_VOID(15, PFNGLCLEARCOLORPROC, glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), (0, 0, 0))
+GLAD_TRACE_VOID(16, PFNGLCLEARSTENCILPROC, glClearStencil, (GLint s), (s), (s, 0, 0))
+GLAD_TRACE_VOID(17, PFNGLCLEARDEPTHPROC, glClearDepth, (GLdouble depth), (depth), (0, 0, 0))
+GLAD_TRACE_VOID(18, PFNGLSTENCILMASKPROC, glStencilMask, (GLuint mask), (mask), (mask, 0, 0))
+GLAD_TRACE_VOID(19, PFNGLCOLORMASKPROC, glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), (red, green, blue))
+GLAD_TRACE_VOID(20, PFNGLDEPTHMASKPROC, glDepthMask, (GLboolean flag), (flag), (flag, 0, 0))
+GLAD_TRACE_VOID(21, PFNGLDISABLEPROC, glDisable, (GLenum cap), (cap), (cap, 0, 0))
+GLAD_TRACE_VOID(22, PFNGLENABLEPROC, glEnable, (GLenum cap), (cap), (cap, 0, 0))
+GLAD_TRACE_VOID(23, PFNGLFINISHPROC, glFinish, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(24, PFNGLFLUSHPROC, glFlush, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(25, PFNGLBLENDFUNCPROC, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), (sfactor, dfactor, 0))
+GLAD_TRACE_VOID(26, PFNGLLOGICOPPROC, glLogicOp, (GLenum opcode), (opcode), (opcode, 0, 0))
+GLAD_TRACE_VOID(27, PFNGLSTENCILFUNCPROC, glStencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), (func, ref, mask))
+GLAD_TRACE_VOID(28, PFNGLSTENCILOPPROC, glStencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), (fail, zfail, zpass))
+GLAD_TRACE_VOID(29, PFNGLDEPTHFUNCPROC, glDepthFunc, (GLenum func), (func), (func, 0, 0))
+GLAD_TRACE_VOID(30, PFNGLPIXELSTOREFPROC, glPixelStoref, (GLenum pname, GLfloat param), (pname, param), (pname, 0, 0))
+GLAD_TRACE_VOID(31, PFNGLPIXELSTOREIPROC, glPixelStorei, (GLenum pname, GLint param), (pname, param), (pname, param, 0))
+GLAD_TRACE_VOID(32, PFNGLREADBUFFERPROC, glReadBuffer, (GLenum src), (src), (src, 0, 0))
+GLAD_TRACE_VOID(33, PFNGLREADPIXELSPROC, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels), (x, y, width))
+GLAD_TRACE_VOID(34, PFNGLGETBOOLEANVPROC, glGetBooleanv, (GLenum pname, GLboolean *data), (pname, data), (pname, 0, 0))
+GLAD_TRACE_VOID(35, PFNGLGETDOUBLEVPROC, glGetDoublev, (GLenum pname, GLdouble *data), (pname, data), (pname, 0, 0))
+GLAD_TRACE(36, GLenum, PFNGLGETERRORPROC, glGetError, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(37, PFNGLGETFLOATVPROC, glGetFloatv, (GLenum pname, GLfloat *data), (pname, data), (pname, 0, 0))
+GLAD_TRACE_VOID(38, PFNGLGETINTEGERVPROC, glGetIntegerv, (GLenum pname, GLint *data), (pname, data), (pname, 0, 0))
+GLAD_TRACE(39, const GLubyte *, PFNGLGETSTRINGPROC, glGetString, (GLenum name), (name), (name, 0, 0))
+GLAD_TRACE_VOID(40, PFNGLGETTEXIMAGEPROC, glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels), (target, level, format))
+GLAD_TRACE_VOID(41, PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(42, PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(43, PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params), (target, level, pname))
+GLAD_TRACE_VOID(44, PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params), (target, level, pname))
+GLAD_TRACE(45, GLboolean, PFNGLISENABLEDPROC, glIsEnabled, (GLenum cap), (cap), (cap, 0, 0))
+GLAD_TRACE_VOID(46, PFNGLDEPTHRANGEPROC, glDepthRange, (GLdouble n, GLdouble f), (n, f), (0, 0, 0))
+GLAD_TRACE_VOID(47, PFNGLVIEWPORTPROC, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), (x, y, width))
+GLAD_TRACE_VOID(48, PFNGLDRAWARRAYSPROC, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count), (mode, first, count))
+GLAD_TRACE_VOID(49, PFNGLDRAWELEMENTSPROC, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices), (mode, count, type))
+GLAD_TRACE_VOID(50, PFNGLPOLYGONOFFSETPROC, glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units), (0, 0, 0))
+GLAD_TRACE_VOID(51, PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), (target, level, internalformat))
+GLAD_TRACE_VOID(52, PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), (target, level, internalformat))
+GLAD_TRACE_VOID(53, PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), (target, level, xoffset))
+GLAD_TRACE_VOID(54, PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), (target, level, xoffset))
+GLAD_TRACE_VOID(55, PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels), (target, level, xoffset))
+GLAD_TRACE_VOID(56, PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), (target, level, xoffset))
+GLAD_TRACE_VOID(57, PFNGLBINDTEXTUREPROC, glBindTexture, (GLenum target, GLuint texture), (target, texture), (target, texture, 0))
+GLAD_TRACE_VOID(58, PFNGLDELETETEXTURESPROC, glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures), (n, 0, 0))
+GLAD_TRACE_VOID(59, PFNGLGENTEXTURESPROC, glGenTextures, (GLsizei n, GLuint *textures), (n, textures), (n, 0, 0))
+GLAD_TRACE(60, GLboolean, PFNGLISTEXTUREPROC, glIsTexture, (GLuint texture), (texture), (texture, 0, 0))
+GLAD_TRACE_VOID(61, PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices), (mode, start, end))
+GLAD_TRACE_VOID(62, PFNGLTEXIMAGE3DPROC, glTexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), (target, level, internalformat))
+GLAD_TRACE_VOID(63, PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), (target, level, xoffset))
+GLAD_TRACE_VOID(64, PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), (target, level, xoffset))
+GLAD_TRACE_VOID(65, PFNGLACTIVETEXTUREPROC, glActiveTexture, (GLenum texture), (texture), (texture, 0, 0))
+GLAD_TRACE_VOID(66, PFNGLSAMPLECOVERAGEPROC, glSampleCoverage, (GLfloat value, GLboolean invert), (value, invert), (invert, 0, 0))
+GLAD_TRACE_VOID(67, PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data), (target, level, internalformat))
+GLAD_TRACE_VOID(68, PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data), (target, level, internalformat))
+GLAD_TRACE_VOID(69, PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data), (target, level, internalformat))
+GLAD_TRACE_VOID(70, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), (target, level, xoffset))
+GLAD_TRACE_VOID(71, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), (target, level, xoffset))
+GLAD_TRACE_VOID(72, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data), (target, level, xoffset))
+GLAD_TRACE_VOID(73, PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage, (GLenum target, GLint level, void *img), (target, level, img), (target, level, 0))
+GLAD_TRACE_VOID(74, PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha))
+GLAD_TRACE_VOID(75, PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount), (mode, drawcount, 0))
+GLAD_TRACE_VOID(76, PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount), (mode, type, drawcount))
+GLAD_TRACE_VOID(77, PFNGLPOINTPARAMETERFPROC, glPointParameterf, (GLenum pname, GLfloat param), (pname, param), (pname, 0, 0))
+GLAD_TRACE_VOID(78, PFNGLPOINTPARAMETERFVPROC, glPointParameterfv, (GLenum pname, const GLfloat *params), (pname, params), (pname, 0, 0))
+GLAD_TRACE_VOID(79, PFNGLPOINTPARAMETERIPROC, glPointParameteri, (GLenum pname, GLint param), (pname, param), (pname, param, 0))
+GLAD_TRACE_VOID(80, PFNGLPOINTPARAMETERIVPROC, glPointParameteriv, (GLenum pname, const GLint *params), (pname, params), (pname, 0, 0))
+GLAD_TRACE_VOID(81, PFNGLBLENDCOLORPROC, glBlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), (0, 0, 0))
+GLAD_TRACE_VOID(82, PFNGLBLENDEQUATIONPROC, glBlendEquation, (GLenum mode), (mode), (mode, 0, 0))
+GLAD_TRACE_VOID(83, PFNGLGENQUERIESPROC, glGenQueries, (GLsizei n, GLuint *ids), (n, ids), (n, 0, 0))
+GLAD_TRACE_VOID(84, PFNGLDELETEQUERIESPROC, glDeleteQueries, (GLsizei n, const GLuint *ids), (n, ids), (n, 0, 0))
+GLAD_TRACE(85, GLboolean, PFNGLISQUERYPROC, glIsQuery, (GLuint id), (id), (id, 0, 0))
+GLAD_TRACE_VOID(86, PFNGLBEGINQUERYPROC, glBeginQuery, (GLenum target, GLuint id), (target, id), (target, id, 0))
+GLAD_TRACE_VOID(87, PFNGLENDQUERYPROC, glEndQuery, (GLenum target), (target), (target, 0, 0))
+GLAD_TRACE_VOID(88, PFNGLGETQUERYIVPROC, glGetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(89, PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params), (id, pname, 0))
+GLAD_TRACE_VOID(90, PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), (id, pname, 0))
+GLAD_TRACE_VOID(91, PFNGLBINDBUFFERPROC, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer), (target, buffer, 0))
+GLAD_TRACE_VOID(92, PFNGLDELETEBUFFERSPROC, glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers), (n, 0, 0))
+GLAD_TRACE_VOID(93, PFNGLGENBUFFERSPROC, glGenBuffers, (GLsizei n, GLuint *buffers), (n, buffers), (n, 0, 0))
+GLAD_TRACE(94, GLboolean, PFNGLISBUFFERPROC, glIsBuffer, (GLuint buffer), (buffer), (buffer, 0, 0))
+GLAD_TRACE_VOID(95, PFNGLBUFFERDATAPROC, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage), (target, size, usage))
+GLAD_TRACE_VOID(96, PFNGLBUFFERSUBDATAPROC, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data), (target, offset, size))
+GLAD_TRACE_VOID(97, PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data), (target, offset, size))
+GLAD_TRACE(98, void *, PFNGLMAPBUFFERPROC, glMapBuffer, (GLenum target, GLenum access), (target, access), (target, access, 0))
+GLAD_TRACE(99, GLboolean, PFNGLUNMAPBUFFERPROC, glUnmapBuffer, (GLenum target), (target), (target, 0, 0))
+GLAD_TRACE_VOID(100, PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(101, PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(102, PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), (modeRGB, modeAlpha, 0))
+GLAD_TRACE_VOID(103, PFNGLDRAWBUFFERSPROC, glDrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs), (n, 0, 0))
+GLAD_TRACE_VOID(104, PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), (face, sfail, dpfail))
+GLAD_TRACE_VOID(105, PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), (face, func, ref))
+GLAD_TRACE_VOID(106, PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate, (GLenum face, GLuint mask), (face, mask), (face, mask, 0))
+GLAD_TRACE_VOID(107, PFNGLATTACHSHADERPROC, glAttachShader, (GLuint program, GLuint shader), (program, shader), (program, shader, 0))
+GLAD_TRACE_VOID(108, PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name), (program, index, 0))
+GLAD_TRACE_VOID(109, PFNGLCOMPILESHADERPROC, glCompileShader, (GLuint shader), (shader), (shader, 0, 0))
+GLAD_TRACE(110, GLuint, PFNGLCREATEPROGRAMPROC, glCreateProgram, (void), (), (0, 0, 0))
+GLAD_TRACE(111, GLuint, PFNGLCREATESHADERPROC, glCreateShader, (GLenum type), (type), (type, 0, 0))
+GLAD_TRACE_VOID(112, PFNGLDELETEPROGRAMPROC, glDeleteProgram, (GLuint program), (program), (program, 0, 0))
+GLAD_TRACE_VOID(113, PFNGLDELETESHADERPROC, glDeleteShader, (GLuint shader), (shader), (shader, 0, 0))
+GLAD_TRACE_VOID(114, PFNGLDETACHSHADERPROC, glDetachShader, (GLuint program, GLuint shader), (program, shader), (program, shader, 0))
+GLAD_TRACE_VOID(115, PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray, (GLuint index), (index), (index, 0, 0))
+GLAD_TRACE_VOID(116, PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray, (GLuint index), (index), (index, 0, 0))
+GLAD_TRACE_VOID(117, PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), (program, index, bufSize))
+GLAD_TRACE_VOID(118, PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), (program, index, bufSize))
+GLAD_TRACE_VOID(119, PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders), (program, maxCount, 0))
+GLAD_TRACE(120, GLint, PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation, (GLuint program, const GLchar *name), (program, name), (program, 0, 0))
+GLAD_TRACE_VOID(121, PFNGLGETPROGRAMIVPROC, glGetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params), (program, pname, 0))
+GLAD_TRACE_VOID(122, PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog), (program, bufSize, 0))
+GLAD_TRACE_VOID(123, PFNGLGETSHADERIVPROC, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params), (shader, pname, 0))
+GLAD_TRACE_VOID(124, PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog), (shader, bufSize, 0))
+GLAD_TRACE_VOID(125, PFNGLGETSHADERSOURCEPROC, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source), (shader, bufSize, 0))
+GLAD_TRACE(126, GLint, PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation, (GLuint program, const GLchar *name), (program, name), (program, 0, 0))
+GLAD_TRACE_VOID(127, PFNGLGETUNIFORMFVPROC, glGetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params), (program, location, 0))
+GLAD_TRACE_VOID(128, PFNGLGETUNIFORMIVPROC, glGetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params), (program, location, 0))
+GLAD_TRACE_VOID(129, PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), (index, pname, 0))
+GLAD_TRACE_VOID(130, PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), (index, pname, 0))
+GLAD_TRACE_VOID(131, PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params), (index, pname, 0))
+GLAD_TRACE_VOID(132, PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), (index, pname, 0))
+GLAD_TRACE(133, GLboolean, PFNGLISPROGRAMPROC, glIsProgram, (GLuint program), (program), (program, 0, 0))
+GLAD_TRACE(134, GLboolean, PFNGLISSHADERPROC, glIsShader, (GLuint shader), (shader), (shader, 0, 0))
+GLAD_TRACE_VOID(135, PFNGLLINKPROGRAMPROC, glLinkProgram, (GLuint program), (program), (program, 0, 0))
+GLAD_TRACE_VOID(136, PFNGLSHADERSOURCEPROC, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length), (shader, count, 0))
+GLAD_TRACE_VOID(137, PFNGLUSEPROGRAMPROC, glUseProgram, (GLuint program), (program), (program, 0, 0))
+GLAD_TRACE_VOID(138, PFNGLUNIFORM1FPROC, glUniform1f, (GLint location, GLfloat v0), (location, v0), (location, 0, 0))
+GLAD_TRACE_VOID(139, PFNGLUNIFORM2FPROC, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), (location, 0, 0))
+GLAD_TRACE_VOID(140, PFNGLUNIFORM3FPROC, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), (location, 0, 0))
+GLAD_TRACE_VOID(141, PFNGLUNIFORM4FPROC, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), (location, 0, 0))
+GLAD_TRACE_VOID(142, PFNGLUNIFORM1IPROC, glUniform1i, (GLint location, GLint v0), (location, v0), (location, v0, 0))
+GLAD_TRACE_VOID(143, PFNGLUNIFORM2IPROC, glUniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1), (location, v0, v1))
+GLAD_TRACE_VOID(144, PFNGLUNIFORM3IPROC, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), (location, v0, v1))
+GLAD_TRACE_VOID(145, PFNGLUNIFORM4IPROC, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), (location, v0, v1))
+GLAD_TRACE_VOID(146, PFNGLUNIFORM1FVPROC, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(147, PFNGLUNIFORM2FVPROC, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(148, PFNGLUNIFORM3FVPROC, glUniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(149, PFNGLUNIFORM4FVPROC, glUniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(150, PFNGLUNIFORM1IVPROC, glUniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(151, PFNGLUNIFORM2IVPROC, glUniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(152, PFNGLUNIFORM3IVPROC, glUniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(153, PFNGLUNIFORM4IVPROC, glUniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(154, PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(155, PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(156, PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(157, PFNGLVALIDATEPROGRAMPROC, glValidateProgram, (GLuint program), (program), (program, 0, 0))
+GLAD_TRACE_VOID(158, PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d, (GLuint index, GLdouble x), (index, x), (index, 0, 0))
+GLAD_TRACE_VOID(159, PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(160, PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f, (GLuint index, GLfloat x), (index, x), (index, 0, 0))
+GLAD_TRACE_VOID(161, PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(162, PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s, (GLuint index, GLshort x), (index, x), (index, x, 0))
+GLAD_TRACE_VOID(163, PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(164, PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y), (index, 0, 0))
+GLAD_TRACE_VOID(165, PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(166, PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y), (index, 0, 0))
+GLAD_TRACE_VOID(167, PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(168, PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y), (index, x, y))
+GLAD_TRACE_VOID(169, PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(170, PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), (index, 0, 0))
+GLAD_TRACE_VOID(171, PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(172, PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), (index, 0, 0))
+GLAD_TRACE_VOID(173, PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(174, PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), (index, x, y))
+GLAD_TRACE_VOID(175, PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(176, PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(177, PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(178, PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(179, PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), (index, x, y))
+GLAD_TRACE_VOID(180, PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(181, PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(182, PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(183, PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(184, PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), (index, 0, 0))
+GLAD_TRACE_VOID(185, PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(186, PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), (index, 0, 0))
+GLAD_TRACE_VOID(187, PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(188, PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(189, PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), (index, x, y))
+GLAD_TRACE_VOID(190, PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(191, PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(192, PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(193, PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv, (GLuint index, const GLushort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(194, PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer), (index, size, type))
+GLAD_TRACE_VOID(195, PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(196, PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(197, PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(198, PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(199, PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(200, PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), (location, count, transpose))
+GLAD_TRACE_VOID(201, PFNGLCOLORMASKIPROC, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), (index, r, g))
+GLAD_TRACE_VOID(202, PFNGLGETBOOLEANI_VPROC, glGetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data), (target, index, 0))
+GLAD_TRACE_VOID(203, PFNGLGETINTEGERI_VPROC, glGetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data), (target, index, 0))
+GLAD_TRACE_VOID(204, PFNGLENABLEIPROC, glEnablei, (GLenum target, GLuint index), (target, index), (target, index, 0))
+GLAD_TRACE_VOID(205, PFNGLDISABLEIPROC, glDisablei, (GLenum target, GLuint index), (target, index), (target, index, 0))
+GLAD_TRACE(206, GLboolean, PFNGLISENABLEDIPROC, glIsEnabledi, (GLenum target, GLuint index), (target, index), (target, index, 0))
+GLAD_TRACE_VOID(207, PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback, (GLenum primitiveMode), (primitiveMode), (primitiveMode, 0, 0))
+GLAD_TRACE_VOID(208, PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(209, PFNGLBINDBUFFERRANGEPROC, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), (target, index, buffer))
+GLAD_TRACE_VOID(210, PFNGLBINDBUFFERBASEPROC, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), (target, index, buffer))
+GLAD_TRACE_VOID(211, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode), (program, count, bufferMode))
+GLAD_TRACE_VOID(212, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), (program, index, bufSize))
+GLAD_TRACE_VOID(213, PFNGLCLAMPCOLORPROC, glClampColor, (GLenum target, GLenum clamp), (target, clamp), (target, clamp, 0))
+GLAD_TRACE_VOID(214, PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender, (GLuint id, GLenum mode), (id, mode), (id, mode, 0))
+GLAD_TRACE_VOID(215, PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(216, PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), (index, size, type))
+GLAD_TRACE_VOID(217, PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params), (index, pname, 0))
+GLAD_TRACE_VOID(218, PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params), (index, pname, 0))
+GLAD_TRACE_VOID(219, PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i, (GLuint index, GLint x), (index, x), (index, x, 0))
+GLAD_TRACE_VOID(220, PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y), (index, x, y))
+GLAD_TRACE_VOID(221, PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), (index, x, y))
+GLAD_TRACE_VOID(222, PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), (index, x, y))
+GLAD_TRACE_VOID(223, PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui, (GLuint index, GLuint x), (index, x), (index, x, 0))
+GLAD_TRACE_VOID(224, PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y), (index, x, y))
+GLAD_TRACE_VOID(225, PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), (index, x, y))
+GLAD_TRACE_VOID(226, PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), (index, x, y))
+GLAD_TRACE_VOID(227, PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(228, PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(229, PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(230, PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv, (GLuint index, const GLint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(231, PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(232, PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(233, PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(234, PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(235, PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(236, PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv, (GLuint index, const GLshort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(237, PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(238, PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv, (GLuint index, const GLushort *v), (index, v), (index, 0, 0))
+GLAD_TRACE_VOID(239, PFNGLGETUNIFORMUIVPROC, glGetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params), (program, location, 0))
+GLAD_TRACE_VOID(240, PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name), (program, color, 0))
+GLAD_TRACE(241, GLint, PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation, (GLuint program, const GLchar *name), (program, name), (program, 0, 0))
+GLAD_TRACE_VOID(242, PFNGLUNIFORM1UIPROC, glUniform1ui, (GLint location, GLuint v0), (location, v0), (location, v0, 0))
+GLAD_TRACE_VOID(243, PFNGLUNIFORM2UIPROC, glUniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), (location, v0, v1))
+GLAD_TRACE_VOID(244, PFNGLUNIFORM3UIPROC, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), (location, v0, v1))
+GLAD_TRACE_VOID(245, PFNGLUNIFORM4UIPROC, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), (location, v0, v1))
+GLAD_TRACE_VOID(246, PFNGLUNIFORM1UIVPROC, glUniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(247, PFNGLUNIFORM2UIVPROC, glUniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(248, PFNGLUNIFORM3UIVPROC, glUniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(249, PFNGLUNIFORM4UIVPROC, glUniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), (location, count, 0))
+GLAD_TRACE_VOID(250, PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(251, PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(252, PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(253, PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(254, PFNGLCLEARBUFFERIVPROC, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value), (buffer, drawbuffer, 0))
+GLAD_TRACE_VOID(255, PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value), (buffer, drawbuffer, 0))
+GLAD_TRACE_VOID(256, PFNGLCLEARBUFFERFVPROC, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value), (buffer, drawbuffer, 0))
+GLAD_TRACE_VOID(257, PFNGLCLEARBUFFERFIPROC, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), (buffer, drawbuffer, stencil))
+GLAD_TRACE(258, const GLubyte *, PFNGLGETSTRINGIPROC, glGetStringi, (GLenum name, GLuint index), (name, index), (name, index, 0))
+GLAD_TRACE(259, GLboolean, PFNGLISRENDERBUFFERPROC, glIsRenderbuffer, (GLuint renderbuffer), (renderbuffer), (renderbuffer, 0, 0))
+GLAD_TRACE_VOID(260, PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer), (target, renderbuffer, 0))
+GLAD_TRACE_VOID(261, PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers), (n, 0, 0))
+GLAD_TRACE_VOID(262, PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), (n, 0, 0))
+GLAD_TRACE_VOID(263, PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), (target, internalformat, width))
+GLAD_TRACE_VOID(264, PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE(265, GLboolean, PFNGLISFRAMEBUFFERPROC, glIsFramebuffer, (GLuint framebuffer), (framebuffer), (framebuffer, 0, 0))
+GLAD_TRACE_VOID(266, PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer), (target, framebuffer, 0))
+GLAD_TRACE_VOID(267, PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers), (n, 0, 0))
+GLAD_TRACE_VOID(268, PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers), (n, 0, 0))
+GLAD_TRACE(269, GLenum, PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus, (GLenum target), (target), (target, 0, 0))
+GLAD_TRACE_VOID(270, PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), (target, attachment, textarget))
+GLAD_TRACE_VOID(271, PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), (target, attachment, textarget))
+GLAD_TRACE_VOID(272, PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), (target, attachment, textarget))
+GLAD_TRACE_VOID(273, PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), (target, attachment, renderbuffertarget))
+GLAD_TRACE_VOID(274, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params), (target, attachment, pname))
+GLAD_TRACE_VOID(275, PFNGLGENERATEMIPMAPPROC, glGenerateMipmap, (GLenum target), (target), (target, 0, 0))
+GLAD_TRACE_VOID(276, PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), (srcX0, srcY0, srcX1))
+GLAD_TRACE_VOID(277, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), (target, samples, internalformat))
+GLAD_TRACE_VOID(278, PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), (target, attachment, texture))
+GLAD_TRACE(279, void *, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), (target, offset, length))
+GLAD_TRACE_VOID(280, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), (target, offset, length))
+GLAD_TRACE_VOID(281, PFNGLBINDVERTEXARRAYPROC, glBindVertexArray, (GLuint array), (array), (array, 0, 0))
+GLAD_TRACE_VOID(282, PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays), (n, 0, 0))
+GLAD_TRACE_VOID(283, PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays), (n, 0, 0))
+GLAD_TRACE(284, GLboolean, PFNGLISVERTEXARRAYPROC, glIsVertexArray, (GLuint array), (array), (array, 0, 0))
+GLAD_TRACE_VOID(285, PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), (mode, first, count))
+GLAD_TRACE_VOID(286, PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount), (mode, count, type))
+GLAD_TRACE_VOID(287, PFNGLTEXBUFFERPROC, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), (target, internalformat, buffer))
+GLAD_TRACE_VOID(288, PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex, (GLuint index), (index), (index, 0, 0))
+GLAD_TRACE_VOID(289, PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), (readTarget, writeTarget, readOffset))
+GLAD_TRACE_VOID(290, PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices), (program, uniformCount, 0))
+GLAD_TRACE_VOID(291, PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params), (program, uniformCount, pname))
+GLAD_TRACE_VOID(292, PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName), (program, uniformIndex, bufSize))
+GLAD_TRACE(293, GLuint, PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName), (program, 0, 0))
+GLAD_TRACE_VOID(294, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params), (program, uniformBlockIndex, pname))
+GLAD_TRACE_VOID(295, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), (program, uniformBlockIndex, bufSize))
+GLAD_TRACE_VOID(296, PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_TRACE_VOID(297, PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex), (mode, count, type))
+GLAD_TRACE_VOID(298, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), (mode, start, end))
+GLAD_TRACE_VOID(299, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), (mode, count, type))
+GLAD_TRACE_VOID(300, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex), (mode, type, drawcount))
+GLAD_TRACE_VOID(301, PFNGLPROVOKINGVERTEXPROC, glProvokingVertex, (GLenum mode), (mode), (mode, 0, 0))
+GLAD_TRACE(302, GLsync, PFNGLFENCESYNCPROC, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags), (condition, flags, 0))
+GLAD_TRACE(303, GLboolean, PFNGLISSYNCPROC, glIsSync, (GLsync sync), (sync), (0, 0, 0))
+GLAD_TRACE_VOID(304, PFNGLDELETESYNCPROC, glDeleteSync, (GLsync sync), (sync), (0, 0, 0))
+GLAD_TRACE(305, GLenum, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), (flags, timeout, 0))
+GLAD_TRACE_VOID(306, PFNGLWAITSYNCPROC, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), (flags, timeout, 0))
+GLAD_TRACE_VOID(307, PFNGLGETINTEGER64VPROC, glGetInteger64v, (GLenum pname, GLint64 *data), (pname, data), (pname, 0, 0))
+GLAD_TRACE_VOID(308, PFNGLGETSYNCIVPROC, glGetSynciv, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values), (pname, count, 0))
+GLAD_TRACE_VOID(309, PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data), (target, index, 0))
+GLAD_TRACE_VOID(310, PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params), (target, pname, 0))
+GLAD_TRACE_VOID(311, PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), (target, attachment, texture))
+GLAD_TRACE_VOID(312, PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), (target, samples, internalformat))
+GLAD_TRACE_VOID(313, PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), (target, samples, internalformat))
+GLAD_TRACE_VOID(314, PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val), (pname, index, 0))
+GLAD_TRACE_VOID(315, PFNGLSAMPLEMASKIPROC, glSampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), (maskNumber, mask, 0))
+GLAD_TRACE_VOID(316, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name), (program, colorNumber, index))
+GLAD_TRACE(317, GLint, PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex, (GLuint program, const GLchar *name), (program, name), (program, 0, 0))
+GLAD_TRACE_VOID(318, PFNGLGENSAMPLERSPROC, glGenSamplers, (GLsizei count, GLuint *samplers), (count, samplers), (count, 0, 0))
+GLAD_TRACE_VOID(319, PFNGLDELETESAMPLERSPROC, glDeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers), (count, 0, 0))
+GLAD_TRACE(320, GLboolean, PFNGLISSAMPLERPROC, glIsSampler, (GLuint sampler), (sampler), (sampler, 0, 0))
+GLAD_TRACE_VOID(321, PFNGLBINDSAMPLERPROC, glBindSampler, (GLuint unit, GLuint sampler), (unit, sampler), (unit, sampler, 0))
+GLAD_TRACE_VOID(322, PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), (sampler, pname, param))
+GLAD_TRACE_VOID(323, PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), (sampler, pname, 0))
+GLAD_TRACE_VOID(324, PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), (sampler, pname, 0))
+GLAD_TRACE_VOID(325, PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param), (sampler, pname, 0))
+GLAD_TRACE_VOID(326, PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), (sampler, pname, 0))
+GLAD_TRACE_VOID(327, PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param), (sampler, pname, 0))
+GLAD_TRACE_VOID(328, PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), (sampler, pname, 0))
+GLAD_TRACE_VOID(329, PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), (sampler, pname, 0))
+GLAD_TRACE_VOID(330, PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params), (sampler, pname, 0))
+GLAD_TRACE_VOID(331, PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params), (sampler, pname, 0))
+GLAD_TRACE_VOID(332, PFNGLQUERYCOUNTERPROC, glQueryCounter, (GLuint id, GLenum target), (id, target), (id, target, 0))
+GLAD_TRACE_VOID(333, PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params), (id, pname, 0))
+GLAD_TRACE_VOID(334, PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params), (id, pname, 0))
+GLAD_TRACE_VOID(335, PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor), (index, divisor, 0))
+GLAD_TRACE_VOID(336, PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(337, PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(338, PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(339, PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(340, PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(341, PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(342, PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(343, PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), (index, type, normalized))
+GLAD_TRACE_VOID(344, PFNGLVERTEXP2UIPROC, glVertexP2ui, (GLenum type, GLuint value), (type, value), (type, value, 0))
+GLAD_TRACE_VOID(345, PFNGLVERTEXP2UIVPROC, glVertexP2uiv, (GLenum type, const GLuint *value), (type, value), (type, 0, 0))
+GLAD_TRACE_VOID(346, PFNGLVERTEXP3UIPROC, glVertexP3ui, (GLenum type, GLuint value), (type, value), (type, value, 0))
+GLAD_TRACE_VOID(347, PFNGLVERTEXP3UIVPROC, glVertexP3uiv, (GLenum type, const GLuint *value), (type, value), (type, 0, 0))
+GLAD_TRACE_VOID(348, PFNGLVERTEXP4UIPROC, glVertexP4ui, (GLenum type, GLuint value), (type, value), (type, value, 0))
+GLAD_TRACE_VOID(349, PFNGLVERTEXP4UIVPROC, glVertexP4uiv, (GLenum type, const GLuint *value), (type, value), (type, 0, 0))
+GLAD_TRACE_VOID(350, PFNGLTEXCOORDP1UIPROC, glTexCoordP1ui, (GLenum type, GLuint coords), (type, coords), (type, coords, 0))
+GLAD_TRACE_VOID(351, PFNGLTEXCOORDP1UIVPROC, glTexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords), (type, 0, 0))
+GLAD_TRACE_VOID(352, PFNGLTEXCOORDP2UIPROC, glTexCoordP2ui, (GLenum type, GLuint coords), (type, coords), (type, coords, 0))
+GLAD_TRACE_VOID(353, PFNGLTEXCOORDP2UIVPROC, glTexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords), (type, 0, 0))
+GLAD_TRACE_VOID(354, PFNGLTEXCOORDP3UIPROC, glTexCoordP3ui, (GLenum type, GLuint coords), (type, coords), (type, coords, 0))
+GLAD_TRACE_VOID(355, PFNGLTEXCOORDP3UIVPROC, glTexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords), (type, 0, 0))
+GLAD_TRACE_VOID(356, PFNGLTEXCOORDP4UIPROC, glTexCoordP4ui, (GLenum type, GLuint coords), (type, coords), (type, coords, 0))
+GLAD_TRACE_VOID(357, PFNGLTEXCOORDP4UIVPROC, glTexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords), (type, 0, 0))
+GLAD_TRACE_VOID(358, PFNGLMULTITEXCOORDP1UIPROC, glMultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), (texture, type, coords))
+GLAD_TRACE_VOID(359, PFNGLMULTITEXCOORDP1UIVPROC, glMultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), (texture, type, 0))
+GLAD_TRACE_VOID(360, PFNGLMULTITEXCOORDP2UIPROC, glMultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), (texture, type, coords))
+GLAD_TRACE_VOID(361, PFNGLMULTITEXCOORDP2UIVPROC, glMultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), (texture, type, 0))
+GLAD_TRACE_VOID(362, PFNGLMULTITEXCOORDP3UIPROC, glMultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), (texture, type, coords))
+GLAD_TRACE_VOID(363, PFNGLMULTITEXCOORDP3UIVPROC, glMultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), (texture, type, 0))
+GLAD_TRACE_VOID(364, PFNGLMULTITEXCOORDP4UIPROC, glMultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), (texture, type, coords))
+GLAD_TRACE_VOID(365, PFNGLMULTITEXCOORDP4UIVPROC, glMultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), (texture, type, 0))
+GLAD_TRACE_VOID(366, PFNGLNORMALP3UIPROC, glNormalP3ui, (GLenum type, GLuint coords), (type, coords), (type, coords, 0))
+GLAD_TRACE_VOID(367, PFNGLNORMALP3UIVPROC, glNormalP3uiv, (GLenum type, const GLuint *coords), (type, coords), (type, 0, 0))
+GLAD_TRACE_VOID(368, PFNGLCOLORP3UIPROC, glColorP3ui, (GLenum type, GLuint color), (type, color), (type, color, 0))
+GLAD_TRACE_VOID(369, PFNGLCOLORP3UIVPROC, glColorP3uiv, (GLenum type, const GLuint *color), (type, color), (type, 0, 0))
+GLAD_TRACE_VOID(370, PFNGLCOLORP4UIPROC, glColorP4ui, (GLenum type, GLuint color), (type, color), (type, color, 0))
+GLAD_TRACE_VOID(371, PFNGLCOLORP4UIVPROC, glColorP4uiv, (GLenum type, const GLuint *color), (type, color), (type, 0, 0))
+GLAD_TRACE_VOID(372, PFNGLSECONDARYCOLORP3UIPROC, glSecondaryColorP3ui, (GLenum type, GLuint color), (type, color), (type, color, 0))
+GLAD_TRACE_VOID(373, PFNGLSECONDARYCOLORP3UIVPROC, glSecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color), (type, 0, 0))
+GLAD_TRACE_VOID(374, PFNGLDEBUGMESSAGECONTROLARBPROC, glDebugMessageControlARB, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), (source, type, severity))
+GLAD_TRACE_VOID(375, PFNGLDEBUGMESSAGEINSERTARBPROC, glDebugMessageInsertARB, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), (source, type, id))
+GLAD_TRACE_VOID(376, PFNGLDEBUGMESSAGECALLBACKARBPROC, glDebugMessageCallbackARB, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam), (0, 0, 0))
+GLAD_TRACE(377, GLuint, PFNGLGETDEBUGMESSAGELOGARBPROC, glGetDebugMessageLogARB, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), (count, bufSize, 0))
+GLAD_TRACE_VOID(378, PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary), (program, bufSize, 0))
+GLAD_TRACE_VOID(379, PFNGLPROGRAMBINARYPROC, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length), (program, binaryFormat, length))
+GLAD_TRACE_VOID(380, PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value), (program, pname, value))
+GLAD_TRACE_VOID(381, PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), (source, type, severity))
+GLAD_TRACE_VOID(382, PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), (source, type, id))
+GLAD_TRACE_VOID(383, PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam), (0, 0, 0))
+GLAD_TRACE(384, GLuint, PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), (count, bufSize, 0))
+GLAD_TRACE_VOID(385, PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message), (source, id, length))
+GLAD_TRACE_VOID(386, PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup, (void), (), (0, 0, 0))
+GLAD_TRACE_VOID(387, PFNGLOBJECTLABELPROC, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label), (identifier, name, length))
+GLAD_TRACE_VOID(388, PFNGLGETOBJECTLABELPROC, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label), (identifier, name, bufSize))
+GLAD_TRACE_VOID(389, PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label), (length, 0, 0))
+GLAD_TRACE_VOID(390, PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label), (bufSize, 0, 0))
+GLAD_TRACE_VOID(391, PFNGLGETPOINTERVPROC, glGetPointerv, (GLenum pname, void **params), (pname, params), (pname, 0, 0))
+GLAD_TRACE_VOID(392, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, glMaxShaderCompilerThreadsKHR, (GLuint count), (count), (count, 0, 0))
+
+struct glad_trace_info {
+    const char *name;
+    const char *args[GLAD_TRACE_ARGS]; /* NULL past the last summarized argument. */
+};
+
+static const struct glad_trace_info trace_infos[] = {
+    {"glCullFace", {"mode", NULL, NULL}},
+    {"glFrontFace", {"mode", NULL, NULL}},
+    {"glHint", {"target", "mode", NULL}},
+    {"glLineWidth", {NULL, NULL, NULL}},
+    {"glPointSize", {NULL, NULL, NULL}},
+    {"glPolygonMode", {"face", "mode", NULL}},
+    {"glScissor", {"x", "y", "width"}},
+    {"glTexParameterf", {"target", "pname", NULL}},
+    {"glTexParameterfv", {"target", "pname", NULL}},
+    {"glTexParameteri", {"target", "pname", "param"}},
+    {"glTexParameteriv", {"target", "pname", NULL}},
+    {"glTexImage1D", {"target", "level", "internalformat"}},
+    {"glTexImage2D", {"target", "level", "internalformat"}},
+    {"glDrawBuffer", {"buf", NULL, NULL}},
+    {"glClear", {"mask", NULL, NULL}},
+    {"glClearColor", {NULL, NULL, NULL}},
+    {"glClearStencil", {"s", NULL, NULL}},
+    {"glClearDepth", {NULL, NULL, NULL}},
+    {"glStencilMask", {"mask", NULL, NULL}},
+    {"glColorMask", {"red", "green", "blue"}},
+    {"glDepthMask", {"flag", NULL, NULL}},
+    {"glDisable", {"cap", NULL, NULL}},
+    {"glEnable", {"cap", NULL, NULL}},
+    {"glFinish", {NULL, NULL, NULL}},
+    {"glFlush", {NULL, NULL, NULL}},
+    {"glBlendFunc", {"sfactor", "dfactor", NULL}},
+    {"glLogicOp", {"opcode", NULL, NULL}},
+    {"glStencilFunc", {"func", "ref", "mask"}},
+    {"glStencilOp", {"fail", "zfail", "zpass"}},
+    {"glDepthFunc", {"func", NULL, NULL}},
+    {"glPixelStoref", {"pname", NULL, NULL}},
+    {"glPixelStorei", {"pname", "param", NULL}},
+    {"glReadBuffer", {"src", NULL, NULL}},
+    {"glReadPixels", {"x", "y", "width"}},
+    {"glGetBooleanv", {"pname", NULL, NULL}},
+    {"glGetDoublev", {"pname", NULL, NULL}},
+    {"glGetError", {NULL, NULL, NULL}},
+    {"glGetFloatv", {"pname", NULL, NULL}},
+    {"glGetIntegerv", {"pname", NULL, NULL}},
+    {"glGetString", {"name", NULL, NULL}},
+    {"glGetTexImage", {"target", "level", "format"}},
+    {"glGetTexParameterfv", {"target", "pname", NULL}},
+    {"glGetTexParameteriv", {"target", "pname", NULL}},
+    {"glGetTexLevelParameterfv", {"target", "level", "pname"}},
+    {"glGetTexLevelParameteriv", {"target", "level", "pname"}},
+    {"glIsEnabled", {"cap", NULL, NULL}},
+    {"glDepthRange", {NULL, NULL, NULL}},
+    {"glViewport", {"x", "y", "width"}},
+    {"glDrawArrays", {"mode", "first", "count"}},
+    {"glDrawElements", {"mode", "count", "type"}},
+    {"glPolygonOffset", {NULL, NULL, NULL}},
+    {"glCopyTexImage1D", {"target", "level", "internalformat"}},
+    {"glCopyTexImage2D", {"target", "level", "internalformat"}},
+    {"glCopyTexSubImage1D", {"target", "level", "xoffset"}},
+    {"glCopyTexSubImage2D", {"target", "level", "xoffset"}},
+    {"glTexSubImage1D", {"target", "level", "xoffset"}},
+    {"glTexSubImage2D", {"target", "level", "xoffset"}},
+    {"glBindTexture", {"target", "texture", NULL}},
+    {"glDeleteTextures", {"n", NULL, NULL}},
+    {"glGenTextures", {"n", NULL, NULL}},
+    {"glIsTexture", {"texture", NULL, NULL}},
+    {"glDrawRangeElements", {"mode", "start", "end"}},
+    {"glTexImage3D", {"target", "level", "internalformat"}},
+    {"glTexSubImage3D", {"target", "level", "xoffset"}},
+    {"glCopyTexSubImage3D", {"target", "level", "xoffset"}},
+    {"glActiveTexture", {"texture", NULL, NULL}},
+    {"glSampleCoverage", {"invert", NULL, NULL}},
+    {"glCompressedTexImage3D", {"target", "level", "internalformat"}},
+    {"glCompressedTexImage2D", {"target", "level", "internalformat"}},
+    {"glCompressedTexImage1D", {"target", "level", "internalformat"}},
+    {"glCompressedTexSubImage3D", {"target", "level", "xoffset"}},
+    {"glCompressedTexSubImage2D", {"target", "level", "xoffset"}},
+    {"glCompressedTexSubImage1D", {"target", "level", "xoffset"}},
+    {"glGetCompressedTexImage", {"target", "level", NULL}},
+    {"glBlendFuncSeparate", {"sfactorRGB", "dfactorRGB", "sfactorAlpha"}},
+    {"glMultiDrawArrays", {"mode", "drawcount", NULL}},
+    {"glMultiDrawElements", {"mode", "type", "drawcount"}},
+    {"glPointParameterf", {"pname", NULL, NULL}},
+    {"glPointParameterfv", {"pname", NULL, NULL}},
+    {"glPointParameteri", {"pname", "param", NULL}},
+    {"glPointParameteriv", {"pname", NULL, NULL}},
+    {"glBlendColor", {NULL, NULL, NULL}},
+    {"glBlendEquation", {"mode", NULL, NULL}},
+    {"glGenQueries", {"n", NULL, NULL}},
+    {"glDeleteQueries", {"n", NULL, NULL}},
+    {"glIsQuery", {"id", NULL, NULL}},
+    {"glBeginQuery", {"target", "id", NULL}},
+    {"glEndQuery", {"target", NULL, NULL}},
+    {"glGetQueryiv", {"target", "pname", NULL}},
+    {"glGetQueryObjectiv", {"id", "pname", NULL}},
+    {"glGetQueryObjectuiv", {"id", "pname", NULL}},
+    {"glBindBuffer", {"target", "buffer", NULL}},
+    {"glDeleteBuffers", {"n", NULL, NULL}},
+    {"glGenBuffers", {"n", NULL, NULL}},
+    {"glIsBuffer", {"buffer", NULL, NULL}},
+    {"glBufferData", {"target", "size", "usage"}},
+    {"glBufferSubData", {"target", "offset", "size"}},
+    {"glGetBufferSubData", {"target", "offset", "size"}},
+    {"glMapBuffer", {"target", "access", NULL}},
+    {"glUnmapBuffer", {"target", NULL, NULL}},
+    {"glGetBufferParameteriv", {"target", "pname", NULL}},
+    {"glGetBufferPointerv", {"target", "pname", NULL}},
+    {"glBlendEquationSeparate", {"modeRGB", "modeAlpha", NULL}},
+    {"glDrawBuffers", {"n", NULL, NULL}},
+    {"glStencilOpSeparate", {"face", "sfail", "dpfail"}},
+    {"glStencilFuncSeparate", {"face", "func", "ref"}},
+    {"glStencilMaskSeparate", {"face", "mask", NULL}},
+    {"glAttachShader", {"program", "shader", NULL}},
+    {"glBindAttribLocation", {"program", "index", NULL}},
+    {"glCompileShader", {"shader", NULL, NULL}},
+    {"glCreateProgram", {NULL, NULL, NULL}},
+    {"glCreateShader", {"type", NULL, NULL}},
+    {"glDeleteProgram", {"program", NULL, NULL}},
+    {"glDeleteShader", {"shader", NULL, NULL}},
+    {"glDetachShader", {"program", "shader", NULL}},
+    {"glDisableVertexAttribArray", {"index", NULL, NULL}},
+    {"glEnableVertexAttribArray", {"index", NULL, NULL}},
+    {"glGetActiveAttrib", {"program", "index", "bufSize"}},
+    {"glGetActiveUniform", {"program", "index", "bufSize"}},
+    {"glGetAttachedShaders", {"program", "maxCount", NULL}},
+    {"glGetAttribLocation", {"program", NULL, NULL}},
+    {"glGetProgramiv", {"program", "pname", NULL}},
+    {"glGetProgramInfoLog", {"program", "bufSize", NULL}},
+    {"glGetShaderiv", {"shader", "pname", NULL}},
+    {"glGetShaderInfoLog", {"shader", "bufSize", NULL}},
+    {"glGetShaderSource", {"shader", "bufSize", NULL}},
+    {"glGetUniformLocation", {"program", NULL, NULL}},
+    {"glGetUniformfv", {"program", "location", NULL}},
+    {"glGetUniformiv", {"program", "location", NULL}},
+    {"glGetVertexAttribdv", {"index", "pname", NULL}},
+    {"glGetVertexAttribfv", {"index", "pname", NULL}},
+    {"glGetVertexAttribiv", {"index", "pname", NULL}},
+    {"glGetVertexAttribPointerv", {"index", "pname", NULL}},
+    {"glIsProgram", {"program", NULL, NULL}},
+    {"glIsShader", {"shader", NULL, NULL}},
+    {"glLinkProgram", {"program", NULL, NULL}},
+    {"glShaderSource", {"shader", "count", NULL}},
+    {"glUseProgram", {"program", NULL, NULL}},
+    {"glUniform1f", {"location", NULL, NULL}},
+    {"glUniform2f", {"location", NULL, NULL}},
+    {"glUniform3f", {"location", NULL, NULL}},
+    {"glUniform4f", {"location", NULL, NULL}},
+    {"glUniform1i", {"location", "v0", NULL}},
+    {"glUniform2i", {"location", "v0", "v1"}},
+    {"glUniform3i", {"location", "v0", "v1"}},
+    {"glUniform4i", {"location", "v0", "v1"}},
+    {"glUniform1fv", {"location", "count", NULL}},
+    {"glUniform2fv", {"location", "count", NULL}},
+    {"glUniform3fv", {"location", "count", NULL}},
+    {"glUniform4fv", {"location", "count", NULL}},
+    {"glUniform1iv", {"location", "count", NULL}},
+    {"glUniform2iv", {"location", "count", NULL}},
+    {"glUniform3iv", {"location", "count", NULL}},
+    {"glUniform4iv", {"location", "count", NULL}},
+    {"glUniformMatrix2fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix3fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix4fv", {"location", "count", "transpose"}},
+    {"glValidateProgram", {"program", NULL, NULL}},
+    {"glVertexAttrib1d", {"index", NULL, NULL}},
+    {"glVertexAttrib1dv", {"index", NULL, NULL}},
+    {"glVertexAttrib1f", {"index", NULL, NULL}},
+    {"glVertexAttrib1fv", {"index", NULL, NULL}},
+    {"glVertexAttrib1s", {"index", "x", NULL}},
+    {"glVertexAttrib1sv", {"index", NULL, NULL}},
+    {"glVertexAttrib2d", {"index", NULL, NULL}},
+    {"glVertexAttrib2dv", {"index", NULL, NULL}},
+    {"glVertexAttrib2f", {"index", NULL, NULL}},
+    {"glVertexAttrib2fv", {"index", NULL, NULL}},
+    {"glVertexAttrib2s", {"index", "x", "y"}},
+    {"glVertexAttrib2sv", {"index", NULL, NULL}},
+    {"glVertexAttrib3d", {"index", NULL, NULL}},
+    {"glVertexAttrib3dv", {"index", NULL, NULL}},
+    {"glVertexAttrib3f", {"index", NULL, NULL}},
+    {"glVertexAttrib3fv", {"index", NULL, NULL}},
+    {"glVertexAttrib3s", {"index", "x", "y"}},
+    {"glVertexAttrib3sv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Nbv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Niv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Nsv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Nub", {"index", "x", "y"}},
+    {"glVertexAttrib4Nubv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Nuiv", {"index", NULL, NULL}},
+    {"glVertexAttrib4Nusv", {"index", NULL, NULL}},
+    {"glVertexAttrib4bv", {"index", NULL, NULL}},
+    {"glVertexAttrib4d", {"index", NULL, NULL}},
+    {"glVertexAttrib4dv", {"index", NULL, NULL}},
+    {"glVertexAttrib4f", {"index", NULL, NULL}},
+    {"glVertexAttrib4fv", {"index", NULL, NULL}},
+    {"glVertexAttrib4iv", {"index", NULL, NULL}},
+    {"glVertexAttrib4s", {"index", "x", "y"}},
+    {"glVertexAttrib4sv", {"index", NULL, NULL}},
+    {"glVertexAttrib4ubv", {"index", NULL, NULL}},
+    {"glVertexAttrib4uiv", {"index", NULL, NULL}},
+    {"glVertexAttrib4usv", {"index", NULL, NULL}},
+    {"glVertexAttribPointer", {"index", "size", "type"}},
+    {"glUniformMatrix2x3fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix3x2fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix2x4fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix4x2fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix3x4fv", {"location", "count", "transpose"}},
+    {"glUniformMatrix4x3fv", {"location", "count", "transpose"}},
+    {"glColorMaski", {"index", "r", "g"}},
+    {"glGetBooleani_v", {"target", "index", NULL}},
+    {"glGetIntegeri_v", {"target", "index", NULL}},
+    {"glEnablei", {"target", "index", NULL}},
+    {"glDisablei", {"target", "index", NULL}},
+    {"glIsEnabledi", {"target", "index", NULL}},
+    {"glBeginTransformFeedback", {"primitiveMode", NULL, NULL}},
+    {"glEndTransformFeedback", {NULL, NULL, NULL}},
+    {"glBindBufferRange", {"target", "index", "buffer"}},
+    {"glBindBufferBase", {"target", "index", "buffer"}},
+    {"glTransformFeedbackVaryings", {"program", "count", "bufferMode"}},
+    {"glGetTransformFeedbackVarying", {"program", "index", "bufSize"}},
+    {"glClampColor", {"target", "clamp", NULL}},
+    {"glBeginConditionalRender", {"id", "mode", NULL}},
+    {"glEndConditionalRender", {NULL, NULL, NULL}},
+    {"glVertexAttribIPointer", {"index", "size", "type"}},
+    {"glGetVertexAttribIiv", {"index", "pname", NULL}},
+    {"glGetVertexAttribIuiv", {"index", "pname", NULL}},
+    {"glVertexAttribI1i", {"index", "x", NULL}},
+    {"glVertexAttribI2i", {"index", "x", "y"}},
+    {"glVertexAttribI3i", {"index", "x", "y"}},
+    {"glVertexAttribI4i", {"index", "x", "y"}},
+    {"glVertexAttribI1ui", {"index", "x", NULL}},
+    {"glVertexAttribI2ui", {"index", "x", "y"}},
+    {"glVertexAttribI3ui", {"index", "x", "y"}},
+    {"glVertexAttribI4ui", {"index", "x", "y"}},
+    {"glVertexAttribI1iv", {"index", NULL, NULL}},
+    {"glVertexAttribI2iv", {"index", NULL, NULL}},
+    {"glVertexAttribI3iv", {"index", NULL, NULL}},
+    {"glVertexAttribI4iv", {"index", NULL, NULL}},
+    {"glVertexAttribI1uiv", {"index", NULL, NULL}},
+    {"glVertexAttribI2uiv", {"index", NULL, NULL}},
+    {"glVertexAttribI3uiv", {"index", NULL, NULL}},
+    {"glVertexAttribI4uiv", {"index", NULL, NULL}},
+    {"glVertexAttribI4bv", {"index", NULL, NULL}},
+    {"glVertexAttribI4sv", {"index", NULL, NULL}},
+    {"glVertexAttribI4ubv", {"index", NULL, NULL}},
+    {"glVertexAttribI4usv", {"index", NULL, NULL}},
+    {"glGetUniformuiv", {"program", "location", NULL}},
+    {"glBindFragDataLocation", {"program", "color", NULL}},
+    {"glGetFragDataLocation", {"program", NULL, NULL}},
+    {"glUniform1ui", {"location", "v0", NULL}},
+    {"glUniform2ui", {"location", "v0", "v1"}},
+    {"glUniform3ui", {"location", "v0", "v1"}},
+    {"glUniform4ui", {"location", "v0", "v1"}},
+    {"glUniform1uiv", {"location", "count", NULL}},
+    {"glUniform2uiv", {"location", "count", NULL}},
+    {"glUniform3uiv", {"location", "count", NULL}},
+    {"glUniform4uiv", {"location", "count", NULL}},
+    {"glTexParameterIiv", {"target", "pname", NULL}},
+    {"glTexParameterIuiv", {"target", "pname", NULL}},
+    {"glGetTexParameterIiv", {"target", "pname", NULL}},
+    {"glGetTexParameterIuiv", {"target", "pname", NULL}},
+    {"glClearBufferiv", {"buffer", "drawbuffer", NULL}},
+    {"glClearBufferuiv", {"buffer", "drawbuffer", NULL}},
+    {"glClearBufferfv", {"buffer", "drawbuffer", NULL}},
+    {"glClearBufferfi", {"buffer", "drawbuffer", "stencil"}},
+    {"glGetStringi", {"name", "index", NULL}},
+    {"glIsRenderbuffer", {"renderbuffer", NULL, NULL}},
+    {"glBindRenderbuffer", {"target", "renderbuffer", NULL}},
+    {"glDeleteRenderbuffers", {"n", NULL, NULL}},
+    {"glGenRenderbuffers", {"n", NULL, NULL}},
+    {"glRenderbufferStorage", {"target", "internalformat", "width"}},
+    {"glGetRenderbufferParameteriv", {"target", "pname", NULL}},
+    {"glIsFramebuffer", {"framebuffer", NULL, NULL}},
+    {"glBindFramebuffer", {"target", "framebuffer", NULL}},
+    {"glDeleteFramebuffers", {"n", NULL, NULL}},
+    {"glGenFramebuffers", {"n", NULL, NULL}},
+    {"glCheckFramebufferStatus", {"target", NULL, NULL}},
+    {"glFramebufferTexture1D", {"target", "attachment", "textarget"}},
+    {"glFramebufferTexture2D", {"target", "attachment", "textarget"}},
+    {"glFramebufferTexture3D", {"target", "attachment", "textarget"}},
+    {"glFramebufferRenderbuffer", {"target", "attachment", "renderbuffertarget"}},
+    {"glGetFramebufferAttachmentParameteriv", {"target", "attachment", "pname"}},
+    {"glGenerateMipmap", {"target", NULL, NULL}},
+    {"glBlitFramebuffer", {"srcX0", "srcY0", "srcX1"}},
+    {"glRenderbufferStorageMultisample", {"target", "samples", "internalformat"}},
+    {"glFramebufferTextureLayer", {"target", "attachment", "texture"}},
+    {"glMapBufferRange", {"target", "offset", "length"}},
+    {"glFlushMappedBufferRange", {"target", "offset", "length"}},
+    {"glBindVertexArray", {"array", NULL, NULL}},
+    {"glDeleteVertexArrays", {"n", NULL, NULL}},
+    {"glGenVertexArrays", {"n", NULL, NULL}},
+    {"glIsVertexArray", {"array", NULL, NULL}},
+    {"glDrawArraysInstanced", {"mode", "first", "count"}},
+    {"glDrawElementsInstanced", {"mode", "count", "type"}},
+    {"glTexBuffer", {"target", "internalformat", "buffer"}},
+    {"glPrimitiveRestartIndex", {"index", NULL, NULL}},
+    {"glCopyBufferSubData", {"readTarget", "writeTarget", "readOffset"}},
+    {"glGetUniformIndices", {"program", "uniformCount", NULL}},
+    {"glGetActiveUniformsiv", {"program", "uniformCount", "pname"}},
+    {"glGetActiveUniformName", {"program", "uniformIndex", "bufSize"}},
+    {"glGetUniformBlockIndex", {"program", NULL, NULL}},
+    {"glGetActiveUniformBlockiv", {"program", "uniformBlockIndex", "pname"}},
+    {"glGetActiveUniformBlockName", {"program", "uniformBlockIndex", "bufSize"}},
+    {"glUniformBlockBinding", {"program", "uniformBlockIndex", "uniformBlockBinding"}},
+    {"glDrawElementsBaseVertex", {"mode", "count", "type"}},
+    {"glDrawRangeElementsBaseVertex", {"mode", "start", "end"}},
+    {"glDrawElementsInstancedBaseVertex", {"mode", "count", "type"}},
+    {"glMultiDrawElementsBaseVertex", {"mode", "type", "drawcount"}},
+    {"glProvokingVertex", {"mode", NULL, NULL}},
+    {"glFenceSync", {"condition", "flags", NULL}},
+    {"glIsSync", {NULL, NULL, NULL}},
+    {"glDeleteSync", {NULL, NULL, NULL}},
+    {"glClientWaitSync", {"flags", "timeout", NULL}},
+    {"glWaitSync", {"flags", "timeout", NULL}},
+    {"glGetInteger64v", {"pname", NULL, NULL}},
+    {"glGetSynciv", {"pname", "count", NULL}},
+    {"glGetInteger64i_v", {"target", "index", NULL}},
+    {"glGetBufferParameteri64v", {"target", "pname", NULL}},
+    {"glFramebufferTexture", {"target", "attachment", "texture"}},
+    {"glTexImage2DMultisample", {"target", "samples", "internalformat"}},
+    {"glTexImage3DMultisample", {"target", "samples", "internalformat"}},
+    {"glGetMultisamplefv", {"pname", "index", NULL}},
+    {"glSampleMaski", {"maskNumber", "mask", NULL}},
+    {"glBindFragDataLocationIndexed", {"program", "colorNumber", "index"}},
+    {"glGetFragDataIndex", {"program", NULL, NULL}},
+    {"glGenSamplers", {"count", NULL, NULL}},
+    {"glDeleteSamplers", {"count", NULL, NULL}},
+    {"glIsSampler", {"sampler", NULL, NULL}},
+    {"glBindSampler", {"unit", "sampler", NULL}},
+    {"glSamplerParameteri", {"sampler", "pname", "param"}},
+    {"glSamplerParameteriv", {"sampler", "pname", NULL}},
+    {"glSamplerParameterf", {"sampler", "pname", NULL}},
+    {"glSamplerParameterfv", {"sampler", "pname", NULL}},
+    {"glSamplerParameterIiv", {"sampler", "pname", NULL}},
+    {"glSamplerParameterIuiv", {"sampler", "pname", NULL}},
+    {"glGetSamplerParameteriv", {"sampler", "pname", NULL}},
+    {"glGetSamplerParameterIiv", {"sampler", "pname", NULL}},
+    {"glGetSamplerParameterfv", {"sampler", "pname", NULL}},
+    {"glGetSamplerParameterIuiv", {"sampler", "pname", NULL}},
+    {"glQueryCounter", {"id", "target", NULL}},
+    {"glGetQueryObjecti64v", {"id", "pname", NULL}},
+    {"glGetQueryObjectui64v", {"id", "pname", NULL}},
+    {"glVertexAttribDivisor", {"index", "divisor", NULL}},
+    {"glVertexAttribP1ui", {"index", "type", "normalized"}},
+    {"glVertexAttribP1uiv", {"index", "type", "normalized"}},
+    {"glVertexAttribP2ui", {"index", "type", "normalized"}},
+    {"glVertexAttribP2uiv", {"index", "type", "normalized"}},
+    {"glVertexAttribP3ui", {"index", "type", "normalized"}},
+    {"glVertexAttribP3uiv", {"index", "type", "normalized"}},
+    {"glVertexAttribP4ui", {"index", "type", "normalized"}},
+    {"glVertexAttribP4uiv", {"index", "type", "normalized"}},
+    {"glVertexP2ui", {"type", "value", NULL}},
+    {"glVertexP2uiv", {"type", NULL, NULL}},
+    {"glVertexP3ui", {"type", "value", NULL}},
+    {"glVertexP3uiv", {"type", NULL, NULL}},
+    {"glVertexP4ui", {"type", "value", NULL}},
+    {"glVertexP4uiv", {"type", NULL, NULL}},
+    {"glTexCoordP1ui", {"type", "coords", NULL}},
+    {"glTexCoordP1uiv", {"type", NULL, NULL}},
+    {"glTexCoordP2ui", {"type", "coords", NULL}},
+    {"glTexCoordP2uiv", {"type", NULL, NULL}},
+    {"glTexCoordP3ui", {"type", "coords", NULL}},
+    {"glTexCoordP3uiv", {"type", NULL, NULL}},
+    {"glTexCoordP4ui", {"type", "coords", NULL}},
+    {"glTexCoordP4uiv", {"type", NULL, NULL}},
+    {"glMultiTexCoordP1ui", {"texture", "type", "coords"}},
+    {"glMultiTexCoordP1uiv", {"texture", "type", NULL}},
+    {"glMultiTexCoordP2ui", {"texture", "type", "coords"}},
+    {"glMultiTexCoordP2uiv", {"texture", "type", NULL}},
+    {"glMultiTexCoordP3ui", {"texture", "type", "coords"}},
+    {"glMultiTexCoordP3uiv", {"texture", "type", NULL}},
+    {"glMultiTexCoordP4ui", {"texture", "type", "coords"}},
+    {"glMultiTexCoordP4uiv", {"texture", "type", NULL}},
+    {"glNormalP3ui", {"type", "coords", NULL}},
+    {"glNormalP3uiv", {"type", NULL, NULL}},
+    {"glColorP3ui", {"type", "color", NULL}},
+    {"glColorP3uiv", {"type", NULL, NULL}},
+    {"glColorP4ui", {"type", "color", NULL}},
+    {"glColorP4uiv", {"type", NULL, NULL}},
+    {"glSecondaryColorP3ui", {"type", "color", NULL}},
+    {"glSecondaryColorP3uiv", {"type", NULL, NULL}},
+    {"glDebugMessageControlARB", {"source", "type", "severity"}},
+    {"glDebugMessageInsertARB", {"source", "type", "id"}},
+    {"glDebugMessageCallbackARB", {NULL, NULL, NULL}},
+    {"glGetDebugMessageLogARB", {"count", "bufSize", NULL}},
+    {"glGetProgramBinary", {"program", "bufSize", NULL}},
+    {"glProgramBinary", {"program", "binaryFormat", "length"}},
+    {"glProgramParameteri", {"program", "pname", "value"}},
+    {"glDebugMessageControl", {"source", "type", "severity"}},
+    {"glDebugMessageInsert", {"source", "type", "id"}},
+    {"glDebugMessageCallback", {NULL, NULL, NULL}},
+    {"glGetDebugMessageLog", {"count", "bufSize", NULL}},
+    {"glPushDebugGroup", {"source", "id", "length"}},
+    {"glPopDebugGroup", {NULL, NULL, NULL}},
+    {"glObjectLabel", {"identifier", "name", "length"}},
+    {"glGetObjectLabel", {"identifier", "name", "bufSize"}},
+    {"glObjectPtrLabel", {"length", NULL, NULL}},
+    {"glGetObjectPtrLabel", {"bufSize", NULL, NULL}},
+    {"glGetPointerv", {"pname", NULL, NULL}},
+    {"glMaxShaderCompilerThreadsKHR", {"count", NULL, NULL}},
+};
+
+#define GLAD_TRACE_COUNT ((int)(sizeof(trace_infos) / sizeof(trace_infos[0])))
+
+/* Pointers that already hold their shim keep the next pointer they have. */
+#define GLAD_TRACE_INSTALL(name) \
+    if(glad_##name != NULL && glad_##name != glad_trace_##name) { \
+        glad_trace_next_##name = glad_##name; \
+        glad_##name = glad_trace_##name; \
+    }
+
+static void trace_install(void) {
+	GLAD_TRACE_INSTALL(glCullFace);
+	GLAD_TRACE_INSTALL(glFrontFace);
+	GLAD_TRACE_INSTALL(glHint);
+	GLAD_TRACE_INSTALL(glLineWidth);
+	GLAD_TRACE_INSTALL(glPointSize);
+	GLAD_TRACE_INSTALL(glPolygonMode);
+	GLAD_TRACE_INSTALL(glScissor);
+	GLAD_TRACE_INSTALL(glTexParameterf);
+	GLAD_TRACE_INSTALL(glTexParameterfv);
+	GLAD_TRACE_INSTALL(glTexParameteri);
+	GLAD_TRACE_INSTALL(glTexParameteriv);
+	GLAD_TRACE_INSTALL(glTexImage1D);
+	GLAD_TRACE_INSTALL(glTexImage2D);
+	GLAD_TRACE_INSTALL(glDrawBuffer);
+	GLAD_TRACE_INSTALL(glClear);
+	GLAD_TRACE_INSTALL(glClearColor);
+	GLAD_TRACE_INSTALL(glClearStencil);
+	GLAD_TRACE_INSTALL(glClearDepth);
+	GLAD_TRACE_INSTALL(glStencilMask);
+	GLAD_TRACE_INSTALL(glColorMask);
+	GLAD_TRACE_INSTALL(glDepthMask);
+	GLAD_TRACE_INSTALL(glDisable);
+	GLAD_TRACE_INSTALL(glEnable);
+	GLAD_TRACE_INSTALL(glFinish);
+	GLAD_TRACE_INSTALL(glFlush);
+	GLAD_TRACE_INSTALL(glBlendFunc);
+	GLAD_TRACE_INSTALL(glLogicOp);
+	GLAD_TRACE_INSTALL(glStencilFunc);
+	GLAD_TRACE_INSTALL(glStencilOp);
+	GLAD_TRACE_INSTALL(glDepthFunc);
+	GLAD_TRACE_INSTALL(glPixelStoref);
+	GLAD_TRACE_INSTALL(glPixelStorei);
+	GLAD_TRACE_INSTALL(glReadBuffer);
+	GLAD_TRACE_INSTALL(glReadPixels);
+	GLAD_TRACE_INSTALL(glGetBooleanv);
+	GLAD_TRACE_INSTALL(glGetDoublev);
+	GLAD_TRACE_INSTALL(glGetError);
+	GLAD_TRACE_INSTALL(glGetFloatv);
+	GLAD_TRACE_INSTALL(glGetIntegerv);
+	GLAD_TRACE_INSTALL(glGetString);
+	GLAD_TRACE_INSTALL(glGetTexImage);
+	GLAD_TRACE_INSTALL(glGetTexParameterfv);
+	GLAD_TRACE_INSTALL(glGetTexParameteriv);
+	GLAD_TRACE_INSTALL(glGetTexLevelParameterfv);
+	GLAD_TRACE_INSTALL(glGetTexLevelParameteriv);
+	GLAD_TRACE_INSTALL(glIsEnabled);
+	GLAD_TRACE_INSTALL(glDepthRange);
+	GLAD_TRACE_INSTALL(glViewport);
+	GLAD_TRACE_INSTALL(glDrawArrays);
+	GLAD_TRACE_INSTALL(glDrawElements);
+	GLAD_TRACE_INSTALL(glPolygonOffset);
+	GLAD_TRACE_INSTALL(glCopyTexImage1D);
+	GLAD_TRACE_INSTALL(glCopyTexImage2D);
+	GLAD_TRACE_INSTALL(glCopyTexSubImage1D);
+	GLAD_TRACE_INSTALL(glCopyTexSubImage2D);
+	GLAD_TRACE_INSTALL(glTexSubImage1D);
+	GLAD_TRACE_INSTALL(glTexSubImage2D);
+	GLAD_TRACE_INSTALL(glBindTexture);
+	GLAD_TRACE_INSTALL(glDeleteTextures);
+	GLAD_TRACE_INSTALL(glGenTextures);
+	GLAD_TRACE_INSTALL(glIsTexture);
+	GLAD_TRACE_INSTALL(glDrawRangeElements);
+	GLAD_TRACE_INSTALL(glTexImage3D);
+	GLAD_TRACE_INSTALL(glTexSubImage3D);
+	GLAD_TRACE_INSTALL(glCopyTexSubImage3D);
+	GLAD_TRACE_INSTALL(glActiveTexture);
+	GLAD_TRACE_INSTALL(glSampleCoverage);
+	GLAD_TRACE_INSTALL(glCompressedTexImage3D);
+	GLAD_TRACE_INSTALL(glCompressedTexImage2D);
+	GLAD_TRACE_INSTALL(glCompressedTexImage1D);
+	GLAD_TRACE_INSTALL(glCompressedTexSubImage3D);
+	GLAD_TRACE_INSTALL(glCompressedTexSubImage2D);
+	GLAD_TRACE_INSTALL(glCompressedTexSubImage1D);
+	GLAD_TRACE_INSTALL(glGetCompressedTexImage);
+	GLAD_TRACE_INSTALL(glBlendFuncSeparate);
+	GLAD_TRACE_INSTALL(glMultiDrawArrays);
+	GLAD_TRACE_INSTALL(glMultiDrawElements);
+	GLAD_TRACE_INSTALL(glPointParameterf);
+	GLAD_TRACE_INSTALL(glPointParameterfv);
+	GLAD_TRACE_INSTALL(glPointParameteri);
+	GLAD_TRACE_INSTALL(glPointParameteriv);
+	GLAD_TRACE_INSTALL(glBlendColor);
+	GLAD_TRACE_INSTALL(glBlendEquation);
+	GLAD_TRACE_INSTALL(glGenQueries);
+	GLAD_TRACE_INSTALL(glDeleteQueries);
+	GLAD_TRACE_INSTALL(glIsQuery);
+	GLAD_TRACE_INSTALL(glBeginQuery);
+	GLAD_TRACE_INSTALL(glEndQuery);
+	GLAD_TRACE_INSTALL(glGetQueryiv);
+	GLAD_TRACE_INSTALL(glGetQueryObjectiv);
+	GLAD_TRACE_INSTALL(glGetQueryObjectuiv);
+	GLAD_TRACE_INSTALL(glBindBuffer);
+	GLAD_TRACE_INSTALL(glDeleteBuffers);
+	GLAD_TRACE_INSTALL(glGenBuffers);
+	GLAD_TRACE_INSTALL(glIsBuffer);
+	GLAD_TRACE_INSTALL(glBufferData);
+	GLAD_TRACE_INSTALL(glBufferSubData);
+	GLAD_TRACE_INSTALL(glGetBufferSubData);
+	GLAD_TRACE_INSTALL(glMapBuffer);
+	GLAD_TRACE_INSTALL(glUnmapBuffer);
+	GLAD_TRACE_INSTALL(glGetBufferParameteriv);
+	GLAD_TRACE_INSTALL(glGetBufferPointerv);
+	GLAD_TRACE_INSTALL(glBlendEquationSeparate);
+	GLAD_TRACE_INSTALL(glDrawBuffers);
+	GLAD_TRACE_INSTALL(glStencilOpSeparate);
+	GLAD_TRACE_INSTALL(glStencilFuncSeparate);
+	GLAD_TRACE_INSTALL(glStencilMaskSeparate);
+	GLAD_TRACE_INSTALL(glAttachShader);
+	GLAD_TRACE_INSTALL(glBindAttribLocation);
+	GLAD_TRACE_INSTALL(glCompileShader);
+	GLAD_TRACE_INSTALL(glCreateProgram);
+	GLAD_TRACE_INSTALL(glCreateShader);
+	GLAD_TRACE_INSTALL(glDeleteProgram);
+	GLAD_TRACE_INSTALL(glDeleteShader);
+	GLAD_TRACE_INSTALL(glDetachShader);
+	GLAD_TRACE_INSTALL(glDisableVertexAttribArray);
+	GLAD_TRACE_INSTALL(glEnableVertexAttribArray);
+	GLAD_TRACE_INSTALL(glGetActiveAttrib);
+	GLAD_TRACE_INSTALL(glGetActiveUniform);
+	GLAD_TRACE_INSTALL(glGetAttachedShaders);
+	GLAD_TRACE_INSTALL(glGetAttribLocation);
+	GLAD_TRACE_INSTALL(glGetProgramiv);
+	GLAD_TRACE_INSTALL(glGetProgramInfoLog);
+	GLAD_TRACE_INSTALL(glGetShaderiv);
+	GLAD_TRACE_INSTALL(glGetShaderInfoLog);
+	GLAD_TRACE_INSTALL(glGetShaderSource);
+	GLAD_TRACE_INSTALL(glGetUniformLocation);
+	GLAD_TRACE_INSTALL(glGetUniformfv);
+	GLAD_TRACE_INSTALL(glGetUniformiv);
+	GLAD_TRACE_INSTALL(glGetVertexAttribdv);
+	GLAD_TRACE_INSTALL(glGetVertexAttribfv);
+	GLAD_TRACE_INSTALL(glGetVertexAttribiv);
+	GLAD_TRACE_INSTALL(glGetVertexAttribPointerv);
+	GLAD_TRACE_INSTALL(glIsProgram);
+	GLAD_TRACE_INSTALL(glIsShader);
+	GLAD_TRACE_INSTALL(glLinkProgram);
+	GLAD_TRACE_INSTALL(glShaderSource);
+	GLAD_TRACE_INSTALL(glUseProgram);
+	GLAD_TRACE_INSTALL(glUniform1f);
+	GLAD_TRACE_INSTALL(glUniform2f);
+	GLAD_TRACE_INSTALL(glUniform3f);
+	GLAD_TRACE_INSTALL(glUniform4f);
+	GLAD_TRACE_INSTALL(glUniform1i);
+	GLAD_TRACE_INSTALL(glUniform2i);
+	GLAD_TRACE_INSTALL(glUniform3i);
+	GLAD_TRACE_INSTALL(glUniform4i);
+	GLAD_TRACE_INSTALL(glUniform1fv);
+	GLAD_TRACE_INSTALL(glUniform2fv);
+	GLAD_TRACE_INSTALL(glUniform3fv);
+	GLAD_TRACE_INSTALL(glUniform4fv);
+	GLAD_TRACE_INSTALL(glUniform1iv);
+	GLAD_TRACE_INSTALL(glUniform2iv);
+	GLAD_TRACE_INSTALL(glUniform3iv);
+	GLAD_TRACE_INSTALL(glUniform4iv);
+	GLAD_TRACE_INSTALL(glUniformMatrix2fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix3fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix4fv);
+	GLAD_TRACE_INSTALL(glValidateProgram);
+	GLAD_TRACE_INSTALL(glVertexAttrib1d);
+	GLAD_TRACE_INSTALL(glVertexAttrib1dv);
+	GLAD_TRACE_INSTALL(glVertexAttrib1f);
+	GLAD_TRACE_INSTALL(glVertexAttrib1fv);
+	GLAD_TRACE_INSTALL(glVertexAttrib1s);
+	GLAD_TRACE_INSTALL(glVertexAttrib1sv);
+	GLAD_TRACE_INSTALL(glVertexAttrib2d);
+	GLAD_TRACE_INSTALL(glVertexAttrib2dv);
+	GLAD_TRACE_INSTALL(glVertexAttrib2f);
+	GLAD_TRACE_INSTALL(glVertexAttrib2fv);
+	GLAD_TRACE_INSTALL(glVertexAttrib2s);
+	GLAD_TRACE_INSTALL(glVertexAttrib2sv);
+	GLAD_TRACE_INSTALL(glVertexAttrib3d);
+	GLAD_TRACE_INSTALL(glVertexAttrib3dv);
+	GLAD_TRACE_INSTALL(glVertexAttrib3f);
+	GLAD_TRACE_INSTALL(glVertexAttrib3fv);
+	GLAD_TRACE_INSTALL(glVertexAttrib3s);
+	GLAD_TRACE_INSTALL(glVertexAttrib3sv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nbv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Niv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nsv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nub);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nubv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nuiv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4Nusv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4bv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4d);
+	GLAD_TRACE_INSTALL(glVertexAttrib4dv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4f);
+	GLAD_TRACE_INSTALL(glVertexAttrib4fv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4iv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4s);
+	GLAD_TRACE_INSTALL(glVertexAttrib4sv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4ubv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4uiv);
+	GLAD_TRACE_INSTALL(glVertexAttrib4usv);
+	GLAD_TRACE_INSTALL(glVertexAttribPointer);
+	GLAD_TRACE_INSTALL(glUniformMatrix2x3fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix3x2fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix2x4fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix4x2fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix3x4fv);
+	GLAD_TRACE_INSTALL(glUniformMatrix4x3fv);
+	GLAD_TRACE_INSTALL(glColorMaski);
+	GLAD_TRACE_INSTALL(glGetBooleani_v);
+	GLAD_TRACE_INSTALL(glGetIntegeri_v);
+	GLAD_TRACE_INSTALL(glEnablei);
+	GLAD_TRACE_INSTALL(glDisablei);
+	GLAD_TRACE_INSTALL(glIsEnabledi);
+	GLAD_TRACE_INSTALL(glBeginTransformFeedback);
+	GLAD_TRACE_INSTALL(glEndTransformFeedback);
+	GLAD_TRACE_INSTALL(glBindBufferRange);
+	GLAD_TRACE_INSTALL(glBindBufferBase);
+	GLAD_TRACE_INSTALL(glTransformFeedbackVaryings);
+	GLAD_TRACE_INSTALL(glGetTransformFeedbackVarying);
+	GLAD_TRACE_INSTALL(glClampColor);
+	GLAD_TRACE_INSTALL(glBeginConditionalRender);
+	GLAD_TRACE_INSTALL(glEndConditionalRender);
+	GLAD_TRACE_INSTALL(glVertexAttribIPointer);
+	GLAD_TRACE_INSTALL(glGetVertexAttribIiv);
+	GLAD_TRACE_INSTALL(glGetVertexAttribIuiv);
+	GLAD_TRACE_INSTALL(glVertexAttribI1i);
+	GLAD_TRACE_INSTALL(glVertexAttribI2i);
+	GLAD_TRACE_INSTALL(glVertexAttribI3i);
+	GLAD_TRACE_INSTALL(glVertexAttribI4i);
+	GLAD_TRACE_INSTALL(glVertexAttribI1ui);
+	GLAD_TRACE_INSTALL(glVertexAttribI2ui);
+	GLAD_TRACE_INSTALL(glVertexAttribI3ui);
+	GLAD_TRACE_INSTALL(glVertexAttribI4ui);
+	GLAD_TRACE_INSTALL(glVertexAttribI1iv);
+	GLAD_TRACE_INSTALL(glVertexAttribI2iv);
+	GLAD_TRACE_INSTALL(glVertexAttribI3iv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4iv);
+	GLAD_TRACE_INSTALL(glVertexAttribI1uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribI2uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribI3uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4bv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4sv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4ubv);
+	GLAD_TRACE_INSTALL(glVertexAttribI4usv);
+	GLAD_TRACE_INSTALL(glGetUniformuiv);
+	GLAD_TRACE_INSTALL(glBindFragDataLocation);
+	GLAD_TRACE_INSTALL(glGetFragDataLocation);
+	GLAD_TRACE_INSTALL(glUniform1ui);
+	GLAD_TRACE_INSTALL(glUniform2ui);
+	GLAD_TRACE_INSTALL(glUniform3ui);
+	GLAD_TRACE_INSTALL(glUniform4ui);
+	GLAD_TRACE_INSTALL(glUniform1uiv);
+	GLAD_TRACE_INSTALL(glUniform2uiv);
+	GLAD_TRACE_INSTALL(glUniform3uiv);
+	GLAD_TRACE_INSTALL(glUniform4uiv);
+	GLAD_TRACE_INSTALL(glTexParameterIiv);
+	GLAD_TRACE_INSTALL(glTexParameterIuiv);
+	GLAD_TRACE_INSTALL(glGetTexParameterIiv);
+	GLAD_TRACE_INSTALL(glGetTexParameterIuiv);
+	GLAD_TRACE_INSTALL(glClearBufferiv);
+	GLAD_TRACE_INSTALL(glClearBufferuiv);
+	GLAD_TRACE_INSTALL(glClearBufferfv);
+	GLAD_TRACE_INSTALL(glClearBufferfi);
+	GLAD_TRACE_INSTALL(glGetStringi);
+	GLAD_TRACE_INSTALL(glIsRenderbuffer);
+	GLAD_TRACE_INSTALL(glBindRenderbuffer);
+	GLAD_TRACE_INSTALL(glDeleteRenderbuffers);
+	GLAD_TRACE_INSTALL(glGenRenderbuffers);
+	GLAD_TRACE_INSTALL(glRenderbufferStorage);
+	GLAD_TRACE_INSTALL(glGetRenderbufferParameteriv);
+	GLAD_TRACE_INSTALL(glIsFramebuffer);
+	GLAD_TRACE_INSTALL(glBindFramebuffer);
+	GLAD_TRACE_INSTALL(glDeleteFramebuffers);
+	GLAD_TRACE_INSTALL(glGenFramebuffers);
+	GLAD_TRACE_INSTALL(glCheckFramebufferStatus);
+	GLAD_TRACE_INSTALL(glFramebufferTexture1D);
+	GLAD_TRACE_INSTALL(glFramebufferTexture2D);
+	GLAD_TRACE_INSTALL(glFramebufferTexture3D);
+	GLAD_TRACE_INSTALL(glFramebufferRenderbuffer);
+	GLAD_TRACE_INSTALL(glGetFramebufferAttachmentParameteriv);
+	GLAD_TRACE_INSTALL(glGenerateMipmap);
+	GLAD_TRACE_INSTALL(glBlitFramebuffer);
+	GLAD_TRACE_INSTALL(glRenderbufferStorageMultisample);
+	GLAD_TRACE_INSTALL(glFramebufferTextureLayer);
+	GLAD_TRACE_INSTALL(glMapBufferRange);
+	GLAD_TRACE_INSTALL(glFlushMappedBufferRange);
+	GLAD_TRACE_INSTALL(glBindVertexArray);
+	GLAD_TRACE_INSTALL(glDeleteVertexArrays);
+	GLAD_TRACE_INSTALL(glGenVertexArrays);
+	GLAD_TRACE_INSTALL(glIsVertexArray);
+	GLAD_TRACE_INSTALL(glDrawArraysInstanced);
+	GLAD_TRACE_INSTALL(glDrawElementsInstanced);
+	GLAD_TRACE_INSTALL(glTexBuffer);
+	GLAD_TRACE_INSTALL(glPrimitiveRestartIndex);
+	GLAD_TRACE_INSTALL(glCopyBufferSubData);
+	GLAD_TRACE_INSTALL(glGetUniformIndices);
+	GLAD_TRACE_INSTALL(glGetActiveUniformsiv);
+	GLAD_TRACE_INSTALL(glGetActiveUniformName);
+	GLAD_TRACE_INSTALL(glGetUniformBlockIndex);
+	GLAD_TRACE_INSTALL(glGetActiveUniformBlockiv);
+	GLAD_TRACE_INSTALL(glGetActiveUniformBlockName);
+	GLAD_TRACE_INSTALL(glUniformBlockBinding);
+	GLAD_TRACE_INSTALL(glDrawElementsBaseVertex);
+	GLAD_TRACE_INSTALL(glDrawRangeElementsBaseVertex);
+	GLAD_TRACE_INSTALL(glDrawElementsInstancedBaseVertex);
+	GLAD_TRACE_INSTALL(glMultiDrawElementsBaseVertex);
+	GLAD_TRACE_INSTALL(glProvokingVertex);
+	GLAD_TRACE_INSTALL(glFenceSync);
+	GLAD_TRACE_INSTALL(glIsSync);
+	GLAD_TRACE_INSTALL(glDeleteSync);
+	GLAD_TRACE_INSTALL(glClientWaitSync);
+	GLAD_TRACE_INSTALL(glWaitSync);
+	GLAD_TRACE_INSTALL(glGetInteger64v);
+	GLAD_TRACE_INSTALL(glGetSynciv);
+	GLAD_TRACE_INSTALL(glGetInteger64i_v);
+	GLAD_TRACE_INSTALL(glGetBufferParameteri64v);
+	GLAD_TRACE_INSTALL(glFramebufferTexture);
+	GLAD_TRACE_INSTALL(glTexImage2DMultisample);
+	GLAD_TRACE_INSTALL(glTexImage3DMultisample);
+	GLAD_TRACE_INSTALL(glGetMultisamplefv);
+	GLAD_TRACE_INSTALL(glSampleMaski);
+	GLAD_TRACE_INSTALL(glBindFragDataLocationIndexed);
+	GLAD_TRACE_INSTALL(glGetFragDataIndex);
+	GLAD_TRACE_INSTALL(glGenSamplers);
+	GLAD_TRACE_INSTALL(glDeleteSamplers);
+	GLAD_TRACE_INSTALL(glIsSampler);
+	GLAD_TRACE_INSTALL(glBindSampler);
+	GLAD_TRACE_INSTALL(glSamplerParameteri);
+	GLAD_TRACE_INSTALL(glSamplerParameteriv);
+	GLAD_TRACE_INSTALL(glSamplerParameterf);
+	GLAD_TRACE_INSTALL(glSamplerParameterfv);
+	GLAD_TRACE_INSTALL(glSamplerParameterIiv);
+	GLAD_TRACE_INSTALL(glSamplerParameterIuiv);
+	GLAD_TRACE_INSTALL(glGetSamplerParameteriv);
+	GLAD_TRACE_INSTALL(glGetSamplerParameterIiv);
+	GLAD_TRACE_INSTALL(glGetSamplerParameterfv);
+	GLAD_TRACE_INSTALL(glGetSamplerParameterIuiv);
+	GLAD_TRACE_INSTALL(glQueryCounter);
+	GLAD_TRACE_INSTALL(glGetQueryObjecti64v);
+	GLAD_TRACE_INSTALL(glGetQueryObjectui64v);
+	GLAD_TRACE_INSTALL(glVertexAttribDivisor);
+	GLAD_TRACE_INSTALL(glVertexAttribP1ui);
+	GLAD_TRACE_INSTALL(glVertexAttribP1uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribP2ui);
+	GLAD_TRACE_INSTALL(glVertexAttribP2uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribP3ui);
+	GLAD_TRACE_INSTALL(glVertexAttribP3uiv);
+	GLAD_TRACE_INSTALL(glVertexAttribP4ui);
+	GLAD_TRACE_INSTALL(glVertexAttribP4uiv);
+	GLAD_TRACE_INSTALL(glVertexP2ui);
+	GLAD_TRACE_INSTALL(glVertexP2uiv);
+	GLAD_TRACE_INSTALL(glVertexP3ui);
+	GLAD_TRACE_INSTALL(glVertexP3uiv);
+	GLAD_TRACE_INSTALL(glVertexP4ui);
+	GLAD_TRACE_INSTALL(glVertexP4uiv);
+	GLAD_TRACE_INSTALL(glTexCoordP1ui);
+	GLAD_TRACE_INSTALL(glTexCoordP1uiv);
+	GLAD_TRACE_INSTALL(glTexCoordP2ui);
+	GLAD_TRACE_INSTALL(glTexCoordP2uiv);
+	GLAD_TRACE_INSTALL(glTexCoordP3ui);
+	GLAD_TRACE_INSTALL(glTexCoordP3uiv);
+	GLAD_TRACE_INSTALL(glTexCoordP4ui);
+	GLAD_TRACE_INSTALL(glTexCoordP4uiv);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP1ui);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP1uiv);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP2ui);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP2uiv);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP3ui);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP3uiv);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP4ui);
+	GLAD_TRACE_INSTALL(glMultiTexCoordP4uiv);
+	GLAD_TRACE_INSTALL(glNormalP3ui);
+	GLAD_TRACE_INSTALL(glNormalP3uiv);
+	GLAD_TRACE_INSTALL(glColorP3ui);
+	GLAD_TRACE_INSTALL(glColorP3uiv);
+	GLAD_TRACE_INSTALL(glColorP4ui);
+	GLAD_TRACE_INSTALL(glColorP4uiv);
+	GLAD_TRACE_INSTALL(glSecondaryColorP3ui);
+	GLAD_TRACE_INSTALL(glSecondaryColorP3uiv);
+	GLAD_TRACE_INSTALL(glDebugMessageControlARB);
+	GLAD_TRACE_INSTALL(glDebugMessageInsertARB);
+	GLAD_TRACE_INSTALL(glDebugMessageCallbackARB);
+	GLAD_TRACE_INSTALL(glGetDebugMessageLogARB);
+	GLAD_TRACE_INSTALL(glGetProgramBinary);
+	GLAD_TRACE_INSTALL(glProgramBinary);
+	GLAD_TRACE_INSTALL(glProgramParameteri);
+	GLAD_TRACE_INSTALL(glDebugMessageControl);
+	GLAD_TRACE_INSTALL(glDebugMessageInsert);
+	GLAD_TRACE_INSTALL(glDebugMessageCallback);
+	GLAD_TRACE_INSTALL(glGetDebugMessageLog);
+	GLAD_TRACE_INSTALL(glPushDebugGroup);
+	GLAD_TRACE_INSTALL(glPopDebugGroup);
+	GLAD_TRACE_INSTALL(glObjectLabel);
+	GLAD_TRACE_INSTALL(glGetObjectLabel);
+	GLAD_TRACE_INSTALL(glObjectPtrLabel);
+	GLAD_TRACE_INSTALL(glGetObjectPtrLabel);
+	GLAD_TRACE_INSTALL(glGetPointerv);
+	GLAD_TRACE_INSTALL(glMaxShaderCompilerThreadsKHR);
+}
+
+void gladSetTraceHooks(GLADtracebeginproc begin, GLADtraceendproc end) {
+    trace_begin = begin != NULL ? begin : trace_begin_none;
+    trace_end = end != NULL ? end : trace_end_none;
+}
+
+int gladTraceFunctionCount(void) {
+    return GLAD_TRACE_COUNT;
+}
+
+const char *gladTraceFunctionName(int function) {
+    return function >= 0 && function < GLAD_TRACE_COUNT ? trace_infos[function].name : NULL;
+}
+
+const char *gladTraceArgumentName(int function, int arg) {
+    if(function < 0 || function >= GLAD_TRACE_COUNT || arg < 0 || arg >= GLAD_TRACE_ARGS) return NULL;
+    return trace_infos[function].args[arg];
+}
+#endif
+/*
+ * Lazy loading: every pointer starts out at a trampoline that looks the
+ * function up, patches the pointer and forwards the call, so only functions
+ * that are actually called are ever looked up. The pointers are plain
+ * globals, so this is only for a single GL thread: load eagerly before a
+ * second thread makes GL calls.
+ */
+static GLADloadproc lazy_load = NULL;
+
+typedef void (*glad_proc)(void);
+
+/*
+ * ISO C has no cast from an object pointer to a function pointer, though
+ * every platform with GL has loaders return one as the other; a union does
+ * the conversion without one.
+ */
+static glad_proc glad_proc_from_object(void *object) {
+    union { void *object; glad_proc proc; } cast;
+    cast.object = object;
+    return cast.proc;
+}
+
+static glad_proc lazy_resolve(const char *name) {
+    void* proc = lazy_load(name);
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s could not be loaded\n", name);
+        abort();
+    }
+    return glad_proc_from_object(proc);
+}
+
+#ifdef GL_TRACE
+#define GLAD_LAZY(ret, type, name, params, args) \
+    static ret APIENTRY glad_lazy_##name params { \
+        glad_trace_next_##name = (type)lazy_resolve(#name); \
+        return glad_trace_next_##name args; \
+    }
+#define GLAD_LAZY_VOID(type, name, params, args) \
+    static void APIENTRY glad_lazy_##name params { \
+        glad_trace_next_##name = (type)lazy_resolve(#name); \
+        glad_trace_next_##name args; \
+    }
+#else
+#define GLAD_LAZY(ret, type, name, params, args) \
+    static ret APIENTRY glad_lazy_##name params { \
+        glad_##name = (type)lazy_resolve(#name); \
+        return glad_##name args; \
+    }
+#define GLAD_LAZY_VOID(type, name, params, args) \
+    static void APIENTRY glad_lazy_##name params { \
+        glad_##name = (type)lazy_resolve(#name); \
+        glad_##name args; \
+    }
+#endif
+GLAD_LAZY_VOID(PFNGLCULLFACEPROC, glCullFace, (GLenum mode), (mode))
+GLAD_LAZY_VOID(PFNGLFRONTFACEPROC, glFrontFace, (GLenum mode), (mode))
+GLAD_LAZY_VOID(PFNGLHINTPROC, glHint, (GLenum target, GLenum mode), (target, mode))
+GLAD_LAZY_VOID(PFNGLLINEWIDTHPROC, glLineWidth, (GLfloat width), (width))
+GLAD_LAZY_VOID(PFNGLPOINTSIZEPROC, glPointSize, (GLfloat size), (size))
+GLAD_LAZY_VOID(PFNGLPOLYGONMODEPROC, glPolygonMode, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(PFNGLSCISSORPROC, glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERFPROC, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERFVPROC, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERIPROC, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERIVPROC, glTexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLTEXIMAGE1DPROC, glTexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLTEXIMAGE2DPROC, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLDRAWBUFFERPROC, glDrawBuffer, (GLenum buf), (buf))
+GLAD_LAZY_VOID(PFNGLCLEARPROC, glClear, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(PFNGLCLEARCOLORPROC, glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(PFNGLCLEARSTENCILPROC, glClearStencil, (GLint s), (s))
+GLAD_LAZY_VOID(PFNGLCLEARDEPTHPROC, glClearDepth, (GLdouble depth), (depth))
+GLAD_LAZY_VOID(PFNGLSTENCILMASKPROC, glStencilMask, (GLuint mask), (mask))
+GLAD_LAZY_VOID(PFNGLCOLORMASKPROC, glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(PFNGLDEPTHMASKPROC, glDepthMask, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(PFNGLDISABLEPROC, glDisable, (GLenum cap), (cap))
+GLAD_LAZY_VOID(PFNGLENABLEPROC, glEnable, (GLenum cap), (cap))
+GLAD_LAZY_VOID(PFNGLFINISHPROC, glFinish, (void), ())
+GLAD_LAZY_VOID(PFNGLFLUSHPROC, glFlush, (void), ())
+GLAD_LAZY_VOID(PFNGLBLENDFUNCPROC, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_LAZY_VOID(PFNGLLOGICOPPROC, glLogicOp, (GLenum opcode), (opcode))
+GLAD_LAZY_VOID(PFNGLSTENCILFUNCPROC, glStencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_LAZY_VOID(PFNGLSTENCILOPPROC, glStencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_LAZY_VOID(PFNGLDEPTHFUNCPROC, glDepthFunc, (GLenum func), (func))
+GLAD_LAZY_VOID(PFNGLPIXELSTOREFPROC, glPixelStoref, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(PFNGLPIXELSTOREIPROC, glPixelStorei, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(PFNGLREADBUFFERPROC, glReadBuffer, (GLenum src), (src))
+GLAD_LAZY_VOID(PFNGLREADPIXELSPROC, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLGETBOOLEANVPROC, glGetBooleanv, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_LAZY_VOID(PFNGLGETDOUBLEVPROC, glGetDoublev, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_LAZY(GLenum, PFNGLGETERRORPROC, glGetError, (void), ())
+GLAD_LAZY_VOID(PFNGLGETFLOATVPROC, glGetFloatv, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_LAZY_VOID(PFNGLGETINTEGERVPROC, glGetIntegerv, (GLenum pname, GLint *data), (pname, data))
+GLAD_LAZY_VOID(PFNGLGETTEXIMAGEPROC, glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_LAZY_VOID(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_LAZY(GLboolean, PFNGLISENABLEDPROC, glIsEnabled, (GLenum cap), (cap))
+GLAD_LAZY_VOID(PFNGLDEPTHRANGEPROC, glDepthRange, (GLdouble n, GLdouble f), (n, f))
+GLAD_LAZY_VOID(PFNGLVIEWPORTPROC, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(PFNGLDRAWARRAYSPROC, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_LAZY_VOID(PFNGLDRAWELEMENTSPROC, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_LAZY_VOID(PFNGLPOLYGONOFFSETPROC, glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_LAZY_VOID(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_LAZY_VOID(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_LAZY_VOID(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLBINDTEXTUREPROC, glBindTexture, (GLenum target, GLuint texture), (target, texture))
+GLAD_LAZY_VOID(PFNGLDELETETEXTURESPROC, glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(PFNGLGENTEXTURESPROC, glGenTextures, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_LAZY(GLboolean, PFNGLISTEXTUREPROC, glIsTexture, (GLuint texture), (texture))
+GLAD_LAZY_VOID(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_LAZY_VOID(PFNGLTEXIMAGE3DPROC, glTexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(PFNGLACTIVETEXTUREPROC, glActiveTexture, (GLenum texture), (texture))
+GLAD_LAZY_VOID(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_LAZY_VOID(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_LAZY_VOID(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_LAZY_VOID(PFNGLPOINTPARAMETERFPROC, glPointParameterf, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(PFNGLPOINTPARAMETERIPROC, glPointParameteri, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(PFNGLBLENDCOLORPROC, glBlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(PFNGLBLENDEQUATIONPROC, glBlendEquation, (GLenum mode), (mode))
+GLAD_LAZY_VOID(PFNGLGENQUERIESPROC, glGenQueries, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(PFNGLDELETEQUERIESPROC, glDeleteQueries, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY(GLboolean, PFNGLISQUERYPROC, glIsQuery, (GLuint id), (id))
+GLAD_LAZY_VOID(PFNGLBEGINQUERYPROC, glBeginQuery, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(PFNGLENDQUERYPROC, glEndQuery, (GLenum target), (target))
+GLAD_LAZY_VOID(PFNGLGETQUERYIVPROC, glGetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(PFNGLBINDBUFFERPROC, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(PFNGLDELETEBUFFERSPROC, glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(PFNGLGENBUFFERSPROC, glGenBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY(GLboolean, PFNGLISBUFFERPROC, glIsBuffer, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(PFNGLBUFFERDATAPROC, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(PFNGLBUFFERSUBDATAPROC, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_LAZY(void *, PFNGLMAPBUFFERPROC, glMapBuffer, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY(GLboolean, PFNGLUNMAPBUFFERPROC, glUnmapBuffer, (GLenum target), (target))
+GLAD_LAZY_VOID(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_LAZY_VOID(PFNGLDRAWBUFFERSPROC, glDrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_LAZY_VOID(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_LAZY_VOID(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate, (GLenum face, GLuint mask), (face, mask))
+GLAD_LAZY_VOID(PFNGLATTACHSHADERPROC, glAttachShader, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_LAZY_VOID(PFNGLCOMPILESHADERPROC, glCompileShader, (GLuint shader), (shader))
+GLAD_LAZY(GLuint, PFNGLCREATEPROGRAMPROC, glCreateProgram, (void), ())
+GLAD_LAZY(GLuint, PFNGLCREATESHADERPROC, glCreateShader, (GLenum type), (type))
+GLAD_LAZY_VOID(PFNGLDELETEPROGRAMPROC, glDeleteProgram, (GLuint program), (program))
+GLAD_LAZY_VOID(PFNGLDELETESHADERPROC, glDeleteShader, (GLuint shader), (shader))
+GLAD_LAZY_VOID(PFNGLDETACHSHADERPROC, glDetachShader, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray, (GLuint index), (index))
+GLAD_LAZY_VOID(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray, (GLuint index), (index))
+GLAD_LAZY_VOID(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_LAZY(GLint, PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(PFNGLGETPROGRAMIVPROC, glGetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_LAZY_VOID(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_LAZY_VOID(PFNGLGETSHADERIVPROC, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_LAZY_VOID(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_LAZY_VOID(PFNGLGETSHADERSOURCEPROC, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_LAZY(GLint, PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(PFNGLGETUNIFORMFVPROC, glGetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_LAZY_VOID(PFNGLGETUNIFORMIVPROC, glGetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY(GLboolean, PFNGLISPROGRAMPROC, glIsProgram, (GLuint program), (program))
+GLAD_LAZY(GLboolean, PFNGLISSHADERPROC, glIsShader, (GLuint shader), (shader))
+GLAD_LAZY_VOID(PFNGLLINKPROGRAMPROC, glLinkProgram, (GLuint program), (program))
+GLAD_LAZY_VOID(PFNGLSHADERSOURCEPROC, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_LAZY_VOID(PFNGLUSEPROGRAMPROC, glUseProgram, (GLuint program), (program))
+GLAD_LAZY_VOID(PFNGLUNIFORM1FPROC, glUniform1f, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(PFNGLUNIFORM2FPROC, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(PFNGLUNIFORM3FPROC, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(PFNGLUNIFORM4FPROC, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(PFNGLUNIFORM1IPROC, glUniform1i, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(PFNGLUNIFORM2IPROC, glUniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(PFNGLUNIFORM3IPROC, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(PFNGLUNIFORM4IPROC, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(PFNGLUNIFORM1FVPROC, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM2FVPROC, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM3FVPROC, glUniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM4FVPROC, glUniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM1IVPROC, glUniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM2IVPROC, glUniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM3IVPROC, glUniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM4IVPROC, glUniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLVALIDATEPROGRAMPROC, glValidateProgram, (GLuint program), (program))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(PFNGLCOLORMASKIPROC, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_LAZY_VOID(PFNGLGETBOOLEANI_VPROC, glGetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_LAZY_VOID(PFNGLGETINTEGERI_VPROC, glGetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_LAZY_VOID(PFNGLENABLEIPROC, glEnablei, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(PFNGLDISABLEIPROC, glDisablei, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY(GLboolean, PFNGLISENABLEDIPROC, glIsEnabledi, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback, (GLenum primitiveMode), (primitiveMode))
+GLAD_LAZY_VOID(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback, (void), ())
+GLAD_LAZY_VOID(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_LAZY_VOID(PFNGLBINDBUFFERBASEPROC, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_LAZY_VOID(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_LAZY_VOID(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(PFNGLCLAMPCOLORPROC, glClampColor, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender, (GLuint id, GLenum mode), (id, mode))
+GLAD_LAZY_VOID(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender, (void), ())
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i, (GLuint index, GLint x), (index, x))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui, (GLuint index, GLuint x), (index, x))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(PFNGLGETUNIFORMUIVPROC, glGetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_LAZY_VOID(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_LAZY(GLint, PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(PFNGLUNIFORM1UIPROC, glUniform1ui, (GLint location, GLuint v0), (location, v0))
+GLAD_LAZY_VOID(PFNGLUNIFORM2UIPROC, glUniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_LAZY_VOID(PFNGLUNIFORM3UIPROC, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(PFNGLUNIFORM4UIPROC, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(PFNGLUNIFORM1UIVPROC, glUniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM2UIVPROC, glUniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM3UIVPROC, glUniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLUNIFORM4UIVPROC, glUniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLCLEARBUFFERIVPROC, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(PFNGLCLEARBUFFERFVPROC, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(PFNGLCLEARBUFFERFIPROC, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_LAZY(const GLubyte *, PFNGLGETSTRINGIPROC, glGetStringi, (GLenum name, GLuint index), (name, index))
+GLAD_LAZY(GLboolean, PFNGLISRENDERBUFFERPROC, glIsRenderbuffer, (GLuint renderbuffer), (renderbuffer))
+GLAD_LAZY_VOID(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_LAZY_VOID(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_LAZY_VOID(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY(GLboolean, PFNGLISFRAMEBUFFERPROC, glIsFramebuffer, (GLuint framebuffer), (framebuffer))
+GLAD_LAZY_VOID(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_LAZY_VOID(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY(GLenum, PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus, (GLenum target), (target))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_LAZY_VOID(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap, (GLenum target), (target))
+GLAD_LAZY_VOID(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY(void *, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_LAZY_VOID(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_LAZY_VOID(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray, (GLuint array), (array))
+GLAD_LAZY_VOID(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY(GLboolean, PFNGLISVERTEXARRAYPROC, glIsVertexArray, (GLuint array), (array))
+GLAD_LAZY_VOID(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_LAZY_VOID(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_LAZY_VOID(PFNGLTEXBUFFERPROC, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex, (GLuint index), (index))
+GLAD_LAZY_VOID(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_LAZY_VOID(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_LAZY_VOID(PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_LAZY(GLuint, PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_LAZY_VOID(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_LAZY_VOID(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_LAZY_VOID(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_LAZY_VOID(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_LAZY_VOID(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_LAZY_VOID(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_LAZY_VOID(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_LAZY_VOID(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex, (GLenum mode), (mode))
+GLAD_LAZY(GLsync, PFNGLFENCESYNCPROC, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_LAZY(GLboolean, PFNGLISSYNCPROC, glIsSync, (GLsync sync), (sync))
+GLAD_LAZY_VOID(PFNGLDELETESYNCPROC, glDeleteSync, (GLsync sync), (sync))
+GLAD_LAZY(GLenum, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(PFNGLWAITSYNCPROC, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(PFNGLGETINTEGER64VPROC, glGetInteger64v, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_LAZY_VOID(PFNGLGETSYNCIVPROC, glGetSynciv, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_LAZY_VOID(PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_LAZY_VOID(PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_LAZY_VOID(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_LAZY_VOID(PFNGLSAMPLEMASKIPROC, glSampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_LAZY_VOID(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_LAZY(GLint, PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(PFNGLGENSAMPLERSPROC, glGenSamplers, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(PFNGLDELETESAMPLERSPROC, glDeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_LAZY(GLboolean, PFNGLISSAMPLERPROC, glIsSampler, (GLuint sampler), (sampler))
+GLAD_LAZY_VOID(PFNGLBINDSAMPLERPROC, glBindSampler, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_LAZY_VOID(PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(PFNGLQUERYCOUNTERPROC, glQueryCounter, (GLuint id, GLenum target), (id, target))
+GLAD_LAZY_VOID(PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP2UIPROC, glVertexP2ui, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP2UIVPROC, glVertexP2uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP3UIPROC, glVertexP3ui, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP3UIVPROC, glVertexP3uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP4UIPROC, glVertexP4ui, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(PFNGLVERTEXP4UIVPROC, glVertexP4uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP1UIPROC, glTexCoordP1ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP1UIVPROC, glTexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP2UIPROC, glTexCoordP2ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP2UIVPROC, glTexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP3UIPROC, glTexCoordP3ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP3UIVPROC, glTexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP4UIPROC, glTexCoordP4ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLTEXCOORDP4UIVPROC, glTexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP1UIPROC, glMultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP1UIVPROC, glMultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP2UIPROC, glMultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP2UIVPROC, glMultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP3UIPROC, glMultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP3UIVPROC, glMultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP4UIPROC, glMultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLMULTITEXCOORDP4UIVPROC, glMultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(PFNGLNORMALP3UIPROC, glNormalP3ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLNORMALP3UIVPROC, glNormalP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(PFNGLCOLORP3UIPROC, glColorP3ui, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(PFNGLCOLORP3UIVPROC, glColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(PFNGLCOLORP4UIPROC, glColorP4ui, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(PFNGLCOLORP4UIVPROC, glColorP4uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(PFNGLSECONDARYCOLORP3UIPROC, glSecondaryColorP3ui, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(PFNGLSECONDARYCOLORP3UIVPROC, glSecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGECONTROLARBPROC, glDebugMessageControlARB, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGEINSERTARBPROC, glDebugMessageInsertARB, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGECALLBACKARBPROC, glDebugMessageCallbackARB, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam))
+GLAD_LAZY(GLuint, PFNGLGETDEBUGMESSAGELOGARBPROC, glGetDebugMessageLogARB, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_LAZY_VOID(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_LAZY_VOID(PFNGLPROGRAMBINARYPROC, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_LAZY_VOID(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_LAZY_VOID(PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+GLAD_LAZY(GLuint, PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_LAZY_VOID(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GLAD_LAZY_VOID(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup, (void), ())
+GLAD_LAZY_VOID(PFNGLOBJECTLABELPROC, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GLAD_LAZY_VOID(PFNGLGETOBJECTLABELPROC, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GLAD_LAZY_VOID(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GLAD_LAZY_VOID(PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GLAD_LAZY_VOID(PFNGLGETPOINTERVPROC, glGetPointerv, (GLenum pname, void **params), (pname, params))
+GLAD_LAZY_VOID(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, glMaxShaderCompilerThreadsKHR, (GLuint count), (count))
+#undef GLAD_LAZY
+#undef GLAD_LAZY_VOID
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_ARB_debug_output(void) {
+	if(!GLAD_GL_ARB_debug_output) return;
+	glad_glDebugMessageControlARB = glad_lazy_glDebugMessageControlARB;
+	glad_glDebugMessageInsertARB = glad_lazy_glDebugMessageInsertARB;
+	glad_glDebugMessageCallbackARB = glad_lazy_glDebugMessageCallbackARB;
+	glad_glGetDebugMessageLogARB = glad_lazy_glGetDebugMessageLogARB;
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_KHR_debug(void) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+static int find_extensionsGL(void) {
+	if (!get_exts()) return 0;
+	GLAD_GL_ARB_debug_output = has_ext("GL_ARB_debug_output");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_ARB_pipeline_statistics_query = has_ext("GL_ARB_pipeline_statistics_query");
+	GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	return 1;
+}
+
+static void find_coreGL(void) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int i, major, minor;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    max_loaded_major = major; max_loaded_minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
+		max_loaded_major = 3;
+		max_loaded_minor = 3;
+	}
+}
+
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+
+	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_debug_output(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_KHR_debug(load);
+	load_GL_KHR_parallel_shader_compile(load);
+#ifdef GL_TRACE
+	trace_install();
+#endif
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)glad_proc_from_object(load("glGetString"));
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	lazy_load = load;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_debug_output();
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_KHR_debug();
+	lazy_GL_KHR_parallel_shader_compile();
+#ifdef GL_TRACE
+	trace_install();
+#endif
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
@@ -0,0 +1,108 @@
+/**
+ * @file frame_loop.cpp
+ * @brief The render loop every example runs, from input to swapping buffers.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "frame_loop.h"
+
+#include "gl_trace.h"
+#include "profiler.h"
+
+#include <chrono>
+
+/**
+ * @brief Handler for input to the window.
+ *
+ * @param window instance of the window receiving the input
+ */
+static void processInput(GLFWwindow *window)
+{
+    // If escape key is pressed, close the window.
+    //
+    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    {
+        glfwSetWindowShouldClose(window, true);
+    }
+}
+
+void beginFrame(GlStateCache &state, const float clearColor[4])
+{
+    state.beginFrame();
+    state.clearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void runFrameLoop(Window &window, GlStateCache &state, const float clearColor[4], const std::function<void()> &draw,
+                  FrameStats *frameTimes, unsigned long frames)
+{
+    GLFWwindow *handle = window.handle();
+    std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+    for (unsigned long frame = 0; frames == 0 || frame < frames; ++frame)
+    {
+        PROFILE_ZONE("frame");
+
+        // Call the input handler first.
+        //
+        if (!window.headless())
+        {
+            PROFILE_ZONE("input");
+            if (glfwWindowShouldClose(handle))
+            {
+                break;
+            }
+            processInput(handle);
+        }
+
+        // Render.
+        //
+        if (clearColor == NULL)
+        {
+            if (draw)
+            {
+                draw();
+            }
+        }
+        else
+        {
+            {
+                PROFILE_ZONE("clear");
+                beginFrame(state, clearColor);
+            }
+            if (draw)
+            {
+                PROFILE_ZONE("draw");
+                draw();
+            }
+        }
+
+        // Check events, then swap the front/back buffers via glfw. Headless,
+        // waiting for the GPU stands in for the swap.
+        //
+        if (window.headless())
+        {
+            PROFILE_ZONE("swap");
+            glFinish();
+        }
+        else
+        {
+            {
+                PROFILE_ZONE("poll");
+                glfwPollEvents();
+            }
+            PROFILE_ZONE("swap");
+            glfwSwapBuffers(handle);
+        }
+        glTraceFrame();
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (frameTimes != NULL)
+        {
+            frameTimes->addSample(std::chrono::duration<double, std::milli>(now - last).count());
+        }
+        last = now;
+    }
+}
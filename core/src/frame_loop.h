@@ -0,0 +1,56 @@
+/**
+ * @file frame_loop.h
+ * @brief The render loop every example runs, from input to swapping buffers.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef FRAME_LOOP_H
+#define FRAME_LOOP_H
+
+#include "frame_stats.h"
+#include "gl_state_cache.h"
+#include "window.h"
+
+#include <functional>
+
+/**
+ * @brief Starts a frame: counts it in the state cache and clears the color buffer.
+ *
+ * The clear color is set through the cache, so it is only issued when it changes.
+ *
+ * @param state state cache to render through
+ * @param clearColor red, green, blue and alpha to clear to
+ */
+void beginFrame(GlStateCache &state, const float clearColor[4]);
+
+/**
+ * @brief Runs the render loop until the window is closed or enough frames are drawn.
+ *
+ * An iteration of the loop is typically referred to as a frame. Each one
+ * handles input, where escape closes the window, starts the frame with
+ * beginFrame(), draws, checks events and swaps the front/back buffers.
+ * Headless windows have no input, events or buffers to swap; each frame
+ * waits for the GPU with glFinish instead, so its time covers the GPU's work.
+ *
+ * Each frame is a profiler zone, "frame", with one for each of its phases:
+ * "input", "clear", "draw", "poll" and "swap". The end of each frame is
+ * marked for glTraceFrame().
+ *
+ * Without a clear color, draw starts the frame itself, such as to time its
+ * clear on the GPU, and records its own zones for it.
+ *
+ * @param window window to render to, with its context current
+ * @param state state cache to render through
+ * @param clearColor red, green, blue and alpha to clear to, or NULL to leave the clear to draw
+ * @param draw draws the frame after the clear; may be empty
+ * @param frameTimes receives the CPU time of each frame, or NULL
+ * @param frames frames to draw, or 0 to draw until the window is closed;
+ *               must not be 0 for headless windows
+ */
+void runFrameLoop(Window &window, GlStateCache &state, const float clearColor[4], const std::function<void()> &draw,
+                  FrameStats *frameTimes = NULL, unsigned long frames = 0);
+
+#endif // FRAME_LOOP_H
@@ -0,0 +1,110 @@
+/**
+ * @file frame_stats.cpp
+ * @brief Collects frame times and summarizes them as percentiles.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "frame_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+FrameStats::FrameStats(std::size_t expectedSamples, std::size_t maxSamples)
+    : maxSamples_(maxSamples), added_(0)
+{
+    samples_.reserve(maxSamples > 0 ? std::min(expectedSamples, maxSamples) : expectedSamples);
+}
+
+void FrameStats::addSample(double milliseconds)
+{
+    // Once full, samples_ is a ring and added_ points past the newest sample.
+    //
+    if (maxSamples_ > 0 && samples_.size() == maxSamples_)
+    {
+        samples_[added_ % maxSamples_] = milliseconds;
+    }
+    else
+    {
+        samples_.push_back(milliseconds);
+    }
+    ++added_;
+}
+
+void FrameStats::clear()
+{
+    samples_.clear();
+    added_ = 0;
+}
+
+double FrameStats::percentile(double percent) const
+{
+    if (samples_.empty())
+    {
+        return 0.0;
+    }
+
+    // Sort a copy so samples keep their frame order.
+    //
+    std::vector<double> sorted(samples_);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::size_t rank = (std::size_t)std::ceil(percent / 100.0 * (double)sorted.size());
+    if (rank > 0)
+    {
+        rank -= 1;
+    }
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+double FrameStats::total() const
+{
+    double sum = 0.0;
+    for (std::size_t i = 0; i < samples_.size(); ++i)
+    {
+        sum += samples_[i];
+    }
+    return sum;
+}
+
+double FrameStats::medianAbsoluteDeviation() const
+{
+    const double median = percentile(50.0);
+    FrameStats deviations(samples_.size());
+    for (std::size_t i = 0; i < samples_.size(); ++i)
+    {
+        deviations.addSample(std::fabs(samples_[i] - median));
+    }
+    return deviations.percentile(50.0);
+}
+
+void FrameStats::report(std::ostream &out, const char *label) const
+{
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << std::fixed << std::setprecision(3)
+        << "  " << std::left << std::setw(16) << label << std::right
+        << "  p50 " << std::setw(9) << percentile(50.0)
+        << "  p95 " << std::setw(9) << percentile(95.0)
+        << "  p99 " << std::setw(9) << percentile(99.0)
+        << "  ms" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool checkFrameBudget(const FrameStats &frameTimes, double budget)
+{
+    if (budget <= 0.0 || frameTimes.count() == 0 || frameTimes.percentile(95.0) <= budget)
+    {
+        return true;
+    }
+    std::cout << "ERROR::FRAME::OVER_BUDGET p95 " << frameTimes.percentile(95.0) << " ms, budget " << budget << " ms"
+              << std::endl;
+    return false;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file frame_stats.h
+ * @brief Collects frame times and summarizes them as percentiles.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+const std::size_t RECENT_FRAME_SAMPLES = 65536; //!< Samples kept by series that run for as long as a window is open.
+
+/**
+ * @brief A series of frame time samples in milliseconds.
+ *
+ * A series may be limited to its most recent samples, so one that takes a
+ * sample every frame of a window left open keeps a fixed amount of memory.
+ */
+class FrameStats
+{
+public:
+    /**
+     * @brief Creates an empty series.
+     *
+     * @param expectedSamples number of samples to reserve space for up front
+     * @param maxSamples most samples to keep, the oldest being replaced once full, or 0 to keep all
+     */
+    explicit FrameStats(std::size_t expectedSamples = 0, std::size_t maxSamples = 0);
+
+    /**
+     * @brief Adds a sample to the series.
+     *
+     * If the series is full, the sample replaces the oldest one.
+     *
+     * @param milliseconds duration of the frame
+     */
+    void addSample(double milliseconds);
+
+    /**
+     * @brief Removes all samples.
+     */
+    void clear();
+
+    std::size_t count() const { return samples_.size(); }
+
+    /**
+     * @brief Number of samples added since the series was created or cleared.
+     *
+     * More than count() once a limited series has replaced samples.
+     *
+     * @return the number of samples added
+     */
+    std::size_t added() const { return added_; }
+
+    /**
+     * @brief Nearest-rank percentile of the samples.
+     *
+     * @param percent percentile to compute, from 0 to 100
+     * @return the percentile, or 0 if there are no samples
+     */
+    double percentile(double percent) const;
+
+    /**
+     * @brief Sum of the samples kept.
+     *
+     * @return total duration in milliseconds
+     */
+    double total() const;
+
+    /**
+     * @brief Median of the distances of the samples from their median.
+     *
+     * A measure of the spread that, unlike the standard deviation, a few
+     * outliers such as a frame the OS preempted barely move.
+     *
+     * @return the median absolute deviation in milliseconds, or 0 if there are no samples
+     */
+    double medianAbsoluteDeviation() const;
+
+    /**
+     * @brief Writes a one line summary with p50/p95/p99.
+     *
+     * @param out stream to write to
+     * @param label name of the series
+     */
+    void report(std::ostream &out, const char *label) const;
+
+private:
+    std::vector<double> samples_;
+    std::size_t maxSamples_; // 0 for no limit.
+    std::size_t added_;      // Samples added, kept or not.
+};
+
+/**
+ * @brief Checks the p95 of frame times against a budget.
+ *
+ * An error is printed if the budget is exceeded.
+ *
+ * @param frameTimes the frame times
+ * @param budget most the p95 may be, in milliseconds, or 0 for no budget
+ * @return false if the budget was exceeded
+ */
+bool checkFrameBudget(const FrameStats &frameTimes, double budget);
+
+#endif // FRAME_STATS_H
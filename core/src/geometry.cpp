@@ -0,0 +1,143 @@
+/**
+ * @file geometry.cpp
+ * @brief Creating vertex data and the buffers and vertex arrays that hold it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "geometry.h"
+
+#include <cmath>
+#include <random>
+
+void createVertexArray(GlStateCache &state, const float *vertices, std::size_t bytes, unsigned int &VAO, unsigned int &VBO)
+{
+    createVertexArray<PositionLayout>(state, vertices, bytes, VAO, VBO);
+}
+
+void createIndexedVertexArray(GlStateCache &state, const std::vector<float> &vertices, const std::vector<GLuint> &indices,
+                              unsigned int &VAO, unsigned int &VBO, unsigned int &EBO)
+{
+    createVertexArray<PositionLayout>(state, vertices.empty() ? NULL : &vertices[0], vertices.size() * sizeof(float),
+                                      VAO, VBO);
+
+    // The element array binding is recorded in the vertex array, so it is
+    // bound while the vertex array is and left bound.
+    //
+    glGenBuffers(1, &EBO);
+    state.bindVertexArray(VAO);
+    state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(indices.size() * sizeof(GLuint)),
+                 indices.empty() ? NULL : &indices[0], GL_STATIC_DRAW);
+    state.bindVertexArray(0);
+}
+
+void packHalfPositions(const std::vector<float> &vertices, std::vector<Half> &halves)
+{
+    const std::size_t count = vertices.size() / FLOATS_PER_VERTEX;
+    halves.resize(count * 2);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        halves[i * 2] = floatToHalf(vertices[i * FLOATS_PER_VERTEX]);
+        halves[i * 2 + 1] = floatToHalf(vertices[i * FLOATS_PER_VERTEX + 1]);
+    }
+}
+
+void generateTriangles(std::size_t count, std::vector<float> &vertices)
+{
+    vertices.resize(count * VERTICES_PER_TRIANGLE * FLOATS_PER_VERTEX);
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Lay the triangles out on the smallest square grid that fits them, one per
+    // cell, each a smaller copy of the hello-triangle triangle.
+    //
+    const std::size_t columns = (std::size_t)std::ceil(std::sqrt((double)count));
+    const std::size_t rows = (count + columns - 1) / columns;
+    const float cellWidth = 2.0f / (float)columns;
+    const float cellHeight = 2.0f / (float)rows;
+
+    float *out = &vertices[0];
+    for (std::size_t triangle = 0; triangle < count; ++triangle)
+    {
+        const float left = -1.0f + (float)(triangle % columns) * cellWidth;
+        const float bottom = -1.0f + (float)(triangle / columns) * cellHeight;
+
+        // clang-format off
+        const float corners[] = {
+            left + 0.25f * cellWidth, bottom + 0.25f * cellHeight, 0.0f, // Left.
+            left + 0.75f * cellWidth, bottom + 0.25f * cellHeight, 0.0f, // Right.
+            left + 0.50f * cellWidth, bottom + 0.75f * cellHeight, 0.0f  // Top.
+        };
+        // clang-format on
+
+        for (std::size_t i = 0; i < VERTICES_PER_TRIANGLE * FLOATS_PER_VERTEX; ++i)
+        {
+            *out++ = corners[i];
+        }
+    }
+}
+
+void generateGrid(std::size_t columns, std::size_t rows, std::vector<float> &vertices, std::vector<GLuint> &indices)
+{
+    vertices.clear();
+    vertices.reserve((columns + 1) * (rows + 1) * FLOATS_PER_VERTEX);
+    for (std::size_t row = 0; row <= rows; ++row)
+    {
+        for (std::size_t column = 0; column <= columns; ++column)
+        {
+            vertices.push_back(-1.0f + 2.0f * (float)column / (float)columns);
+            vertices.push_back(-1.0f + 2.0f * (float)row / (float)rows);
+            vertices.push_back(0.0f);
+        }
+    }
+
+    indices.clear();
+    indices.reserve(columns * rows * 6);
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            const GLuint bottomLeft = (GLuint)(row * (columns + 1) + column);
+            const GLuint bottomRight = bottomLeft + 1;
+            const GLuint topLeft = bottomLeft + (GLuint)(columns + 1);
+            const GLuint topRight = topLeft + 1;
+
+            // Counter-clockwise, like the hello-triangle triangle.
+            //
+            const GLuint quad[] = {bottomLeft, bottomRight, topRight, bottomLeft, topRight, topLeft};
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+
+    // Shuffle whole triangles with a fixed seed. std::shuffle is not used
+    // because its order differs between standard libraries.
+    //
+    std::mt19937 random(12345);
+    for (std::size_t triangle = indices.size() / 3; triangle > 1; --triangle)
+    {
+        const std::size_t other = (std::size_t)(random() % triangle);
+        for (std::size_t corner = 0; corner < 3; ++corner)
+        {
+            const GLuint swapped = indices[(triangle - 1) * 3 + corner];
+            indices[(triangle - 1) * 3 + corner] = indices[other * 3 + corner];
+            indices[other * 3 + corner] = swapped;
+        }
+    }
+}
+
+void expandIndexed(const std::vector<float> &vertices, const std::vector<GLuint> &indices, std::vector<float> &expanded)
+{
+    expanded.resize(indices.size() * FLOATS_PER_VERTEX);
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        for (std::size_t j = 0; j < FLOATS_PER_VERTEX; ++j)
+        {
+            expanded[i * FLOATS_PER_VERTEX + j] = vertices[indices[i] * FLOATS_PER_VERTEX + j];
+        }
+    }
+}
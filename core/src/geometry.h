@@ -0,0 +1,132 @@
+/**
+ * @file geometry.h
+ * @brief Creating vertex data and the buffers and vertex arrays that hold it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+#include "vertex_layout.h"
+
+#include <cstddef>
+#include <vector>
+
+const std::size_t FLOATS_PER_VERTEX = 3;     //!< Each vertex is an x, y, z position.
+const std::size_t VERTICES_PER_TRIANGLE = 3; //!< Triangles are drawn unindexed.
+
+/**
+ * @brief Most triangles that can be generated; glDrawArrays takes a GLsizei count.
+ */
+const std::size_t MAX_TRIANGLES = 0x7fffffff / VERTICES_PER_TRIANGLE;
+
+typedef VertexLayout<Attribute<0, GLfloat, 3> > PositionLayout; //!< x, y, z as floats, 12 bytes.
+typedef VertexLayout<Attribute<0, Half, 2> > HalfPositionLayout; //!< x, y as halves, 4 bytes; z is 0.
+
+/**
+ * @brief Uploads vertices to a new vertex buffer and describes them in a new vertex array.
+ *
+ * @tparam Layout VertexLayout of the vertices
+ * @param state state cache to bind through
+ * @param vertices the vertices, Layout::STRIDE bytes each
+ * @param bytes size of the vertex data in bytes
+ * @param VAO receives the vertex array object
+ * @param VBO receives the vertex buffer object
+ */
+template <typename Layout>
+void createVertexArray(GlStateCache &state, const void *vertices, std::size_t bytes, unsigned int &VAO, unsigned int &VBO)
+{
+    glGenVertexArrays(1, &VAO); // Generate a vertex buffer array.
+    glGenBuffers(1, &VBO);      // Generate a vertex buffer object.
+    state.bindVertexArray(VAO); // Bind the vertex array first.
+
+    state.bindBuffer(GL_ARRAY_BUFFER, VBO);                                     // Bind the vertex buffer object.
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bytes, vertices, GL_STATIC_DRAW); // Set the buffer data using the array of vertices.
+
+    // Specify how the vertex data should be interpreted.
+    //
+    Layout::apply();
+
+    state.bindBuffer(GL_ARRAY_BUFFER, 0); // Safely unbind since VBO is now registered as vertex attributes bound vertex.
+    state.bindVertexArray(0);             // Safely unbind the VAO but this usually isn't necessary.
+}
+
+/**
+ * @brief Uploads positions to a new vertex buffer and describes them in a new vertex array.
+ *
+ * @param state state cache to bind through
+ * @param vertices x, y, z positions, FLOATS_PER_VERTEX floats per vertex
+ * @param bytes size of the vertex data in bytes
+ * @param VAO receives the vertex array object
+ * @param VBO receives the vertex buffer object
+ */
+void createVertexArray(GlStateCache &state, const float *vertices, std::size_t bytes, unsigned int &VAO, unsigned int &VBO);
+
+/**
+ * @brief Uploads positions and indices to new buffers and describes them in a new vertex array.
+ *
+ * The element buffer stays bound to the vertex array, so binding the array is
+ * enough to draw with glDrawElements.
+ *
+ * @param state state cache to bind through
+ * @param vertices x, y, z positions, FLOATS_PER_VERTEX floats per vertex
+ * @param indices three indices per triangle
+ * @param VAO receives the vertex array object
+ * @param VBO receives the vertex buffer object
+ * @param EBO receives the element buffer object
+ */
+void createIndexedVertexArray(GlStateCache &state, const std::vector<float> &vertices, const std::vector<GLuint> &indices,
+                              unsigned int &VAO, unsigned int &VBO, unsigned int &EBO);
+
+/**
+ * @brief Converts x, y, z positions with z = 0 to half x, y positions.
+ *
+ * A third of the size, and within 0.0005 of the original positions anywhere
+ * in clip space.
+ *
+ * @param vertices x, y, z positions, FLOATS_PER_VERTEX floats per vertex
+ * @param halves receives x, y halves, HalfPositionLayout::STRIDE bytes per vertex
+ */
+void packHalfPositions(const std::vector<float> &vertices, std::vector<Half> &halves);
+
+/**
+ * @brief Generates small triangles laid out on a grid that covers the viewport.
+ *
+ * The layout only depends on the count, so runs with the same count draw the
+ * same image.
+ *
+ * @param count number of triangles, at most MAX_TRIANGLES
+ * @param vertices receives the positions of the triangles
+ */
+void generateTriangles(std::size_t count, std::vector<float> &vertices);
+
+/**
+ * @brief Generates a grid of quads that covers the viewport, sharing vertices between neighbours.
+ *
+ * Each quad is two triangles, and each inner vertex is used by six triangles.
+ * The triangles are listed in a shuffled but repeatable order, the way meshes
+ * often come out of tools that do not care about vertex reuse.
+ *
+ * @param columns quads across
+ * @param rows quads down
+ * @param vertices receives (columns + 1) * (rows + 1) x, y, z positions
+ * @param indices receives three indices per triangle
+ */
+void generateGrid(std::size_t columns, std::size_t rows, std::vector<float> &vertices, std::vector<GLuint> &indices);
+
+/**
+ * @brief Expands indexed triangles into three separate vertices each, for glDrawArrays.
+ *
+ * @param vertices x, y, z positions, FLOATS_PER_VERTEX floats per vertex
+ * @param indices three indices per triangle
+ * @param expanded receives FLOATS_PER_VERTEX floats for each index
+ */
+void expandIndexed(const std::vector<float> &vertices, const std::vector<GLuint> &indices, std::vector<float> &expanded);
+
+#endif // GEOMETRY_H
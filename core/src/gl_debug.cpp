@@ -0,0 +1,241 @@
+/**
+ * @file gl_debug.cpp
+ * @brief Collects the driver's debug messages, performance warnings above all.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "gl_debug.h"
+
+#include <vector>
+
+const unsigned long GlDebugLog::REPEATS_WRITTEN;
+
+/**
+ * @brief Name of a message source, as written in the log.
+ */
+static const char *sourceName(GLenum source)
+{
+    switch (source)
+    {
+    case GL_DEBUG_SOURCE_API:
+        return "api";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+        return "window-system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER:
+        return "shader-compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:
+        return "third-party";
+    case GL_DEBUG_SOURCE_APPLICATION:
+        return "application";
+    default:
+        return "other";
+    }
+}
+
+/**
+ * @brief Name of a message type, as written in the log.
+ */
+static const char *typeName(GLenum type)
+{
+    switch (type)
+    {
+    case GL_DEBUG_TYPE_ERROR:
+        return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+        return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+        return "undefined";
+    case GL_DEBUG_TYPE_PORTABILITY:
+        return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:
+        return "performance";
+    case GL_DEBUG_TYPE_MARKER:
+        return "marker";
+    default:
+        return "other";
+    }
+}
+
+/**
+ * @brief Name of a message severity, as written in the log.
+ */
+static const char *severityName(GLenum severity)
+{
+    switch (severity)
+    {
+    case GL_DEBUG_SEVERITY_HIGH:
+        return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM:
+        return "medium";
+    case GL_DEBUG_SEVERITY_LOW:
+        return "low";
+    default:
+        return "notification";
+    }
+}
+
+GlDebugLog::GlDebugLog()
+    : out_(NULL), frame_(0), messages_(0), performance_(0), installed_(false), khr_(false)
+{
+}
+
+GlDebugLog::~GlDebugLog()
+{
+    uninstall();
+}
+
+bool GlDebugLog::install(std::ostream &out, bool synchronous)
+{
+    // Both extensions take the same callback and use the same values; only
+    // KHR_debug has an on switch and notifications, which would flood the log.
+    //
+    out_ = &out;
+    if (GLAD_GL_KHR_debug)
+    {
+        khr_ = true;
+        glDebugMessageCallback(callback, this);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+        glEnable(GL_DEBUG_OUTPUT);
+    }
+    else if (GLAD_GL_ARB_debug_output)
+    {
+        khr_ = false;
+        glDebugMessageCallbackARB(callback, this);
+        glDebugMessageControlARB(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+    }
+    else
+    {
+        return false;
+    }
+
+    if (synchronous)
+    {
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+    else
+    {
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+    installed_ = true;
+    return true;
+}
+
+void GlDebugLog::uninstall()
+{
+    if (!installed_)
+    {
+        return;
+    }
+    if (khr_)
+    {
+        glDisable(GL_DEBUG_OUTPUT);
+        glDebugMessageCallback(NULL, NULL);
+    }
+    else
+    {
+        glDebugMessageCallbackARB(NULL, NULL);
+    }
+    installed_ = false;
+}
+
+unsigned long GlDebugLog::performanceWarnings() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return performance_;
+}
+
+void GlDebugLog::report(std::ostream &out) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (messages_ == 0)
+    {
+        return;
+    }
+
+    // Performance warnings first, as that is what the log is for.
+    //
+    std::vector<const Entry *> ordered;
+    for (int performance = 1; performance >= 0; --performance)
+    {
+        for (std::map<unsigned long long, Entry>::const_iterator it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            if ((it->second.type == GL_DEBUG_TYPE_PERFORMANCE) == (performance == 1))
+            {
+                ordered.push_back(&it->second);
+            }
+        }
+    }
+
+    out << "  GL debug          " << messages_ << " messages, " << performance_ << " performance warnings, "
+        << entries_.size() << " distinct" << std::endl;
+    for (std::size_t i = 0; i < ordered.size(); ++i)
+    {
+        const Entry &entry = *ordered[i];
+        out << "    type=" << typeName(entry.type) << " severity=" << severityName(entry.severity)
+            << " source=" << sourceName(entry.source) << " id=" << entry.id << " count=" << entry.count
+            << " frames=" << entry.firstFrame << "-" << entry.lastFrame << " \"" << entry.text << "\"" << std::endl;
+    }
+}
+
+void APIENTRY GlDebugLog::callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                   const GLchar *message, const void *userParam)
+{
+    ((GlDebugLog *)userParam)->add(source, type, id, severity, length, message);
+}
+
+void GlDebugLog::add(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message)
+{
+    const unsigned long frame = frame_.load(std::memory_order_relaxed);
+
+    // Keep each message on one line, whatever the driver put in it.
+    //
+    std::string text = length >= 0 ? std::string(message, (std::size_t)length) : std::string(message);
+    while (!text.empty() && (text[text.size() - 1] == '\n' || text[text.size() - 1] == '\0'))
+    {
+        text.erase(text.size() - 1);
+    }
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (text[i] == '\n' || text[i] == '"')
+        {
+            text[i] = text[i] == '\n' ? ' ' : '\'';
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++messages_;
+    if (type == GL_DEBUG_TYPE_PERFORMANCE)
+    {
+        ++performance_;
+    }
+
+    const unsigned long long key = ((unsigned long long)(source & 0xffff) << 48) |
+                                   ((unsigned long long)(type & 0xffff) << 32) | id;
+    std::map<unsigned long long, Entry>::iterator it = entries_.find(key);
+    if (it == entries_.end())
+    {
+        Entry entry;
+        entry.source = source;
+        entry.type = type;
+        entry.id = id;
+        entry.severity = severity;
+        entry.text = text;
+        entry.count = 0;
+        entry.firstFrame = frame;
+        it = entries_.insert(std::make_pair(key, entry)).first;
+    }
+    Entry &entry = it->second;
+    ++entry.count;
+    entry.lastFrame = frame;
+
+    if (entry.count <= REPEATS_WRITTEN && out_ != NULL)
+    {
+        *out_ << "GL debug frame=" << frame << " type=" << typeName(type) << " severity=" << severityName(severity)
+              << " source=" << sourceName(source) << " id=" << id << " \"" << text << "\""
+              << (entry.count == REPEATS_WRITTEN ? " (repeats are only counted from here on)" : "") << std::endl;
+    }
+}
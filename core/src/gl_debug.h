@@ -0,0 +1,124 @@
+/**
+ * @file gl_debug.h
+ * @brief Collects the driver's debug messages, performance warnings above all.
+ *
+ * Drivers report what they do behind the application's back, such as stalls
+ * on a busy buffer, recompiling a shader for new state, or synchronizing with
+ * the GPU, through the debug output of KHR_debug, or ARB_debug_output on
+ * older drivers. Otherwise those only show up as slow frames. GlDebugLog
+ * installs a callback for them and writes each message as one line of
+ * key=value fields, with the frame it arrived in. A message that keeps
+ * repeating, which is usual for a stall in the render loop, is written a few
+ * times and only counted after that, and the report lists the counts.
+ *
+ * Notifications are not asked for. Drivers say more in debug contexts, so
+ * --gl-debug creates one.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GL_DEBUG_H
+#define GL_DEBUG_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Debug messages of one context, counted and written out as they arrive.
+ */
+class GlDebugLog
+{
+public:
+    static const unsigned long REPEATS_WRITTEN = 3; //!< Times the same message is written before it is only counted.
+
+    GlDebugLog();
+
+    /**
+     * @brief Uninstalls the callback; the context it was installed into must be current.
+     */
+    ~GlDebugLog();
+
+    /**
+     * @brief Installs the callback into the current context.
+     *
+     * @param out stream to write messages to; may be written from a driver thread
+     * @param synchronous have messages delivered during the call that caused
+     *                    them, which slows the driver down but makes them
+     *                    appear next to that call in a debugger or trace
+     * @return false if the context has neither KHR_debug nor ARB_debug_output
+     */
+    bool install(std::ostream &out, bool synchronous);
+
+    /**
+     * @brief Removes the callback from the current context, if it was installed.
+     */
+    void uninstall();
+
+    /**
+     * @brief Advances the frame number messages are tagged with.
+     */
+    void nextFrame() { frame_.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of performance warnings received so far.
+     */
+    unsigned long performanceWarnings() const;
+
+    /**
+     * @brief Reports how often each message arrived and in which frames.
+     *
+     * Writes nothing if no message arrived.
+     *
+     * @param out stream to write the report to
+     */
+    void report(std::ostream &out) const;
+
+private:
+    GlDebugLog(const GlDebugLog &);            // Not copyable.
+    GlDebugLog &operator=(const GlDebugLog &); // Not copyable.
+
+    /**
+     * @brief A distinct message and how often it arrived.
+     */
+    struct Entry
+    {
+        GLenum source;
+        GLenum type;
+        GLuint id;
+        GLenum severity;
+        std::string text;        // The first text it came with.
+        unsigned long count;
+        unsigned long firstFrame;
+        unsigned long lastFrame;
+    };
+
+    /**
+     * @brief The callback given to the driver; forwards to add().
+     */
+    static void APIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                  const GLchar *message, const void *userParam);
+
+    /**
+     * @brief Counts a message and writes it out unless it was written often enough.
+     */
+    void add(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message);
+
+    std::ostream *out_;
+    std::atomic<unsigned long> frame_;
+    std::map<unsigned long long, Entry> entries_; // By source, type and id.
+    unsigned long messages_;
+    unsigned long performance_;
+    bool installed_;
+    bool khr_;                                    // Installed through KHR_debug rather than ARB_debug_output.
+    mutable std::mutex mutex_;                    // Messages may arrive on any thread.
+};
+
+#endif // GL_DEBUG_H
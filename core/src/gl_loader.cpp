@@ -0,0 +1,185 @@
+/**
+ * @file gl_loader.cpp
+ * @brief Startup cost of resolving OpenGL functions eagerly and lazily.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "gl_loader.h"
+
+#include "frame_stats.h"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static GLADloadproc lazyLoad = NULL;    //!< Loader of functions still loaded lazily, or NULL if all are resolved.
+static GLADloadproc countedLoad = NULL; //!< Loader that countingLoad() forwards to.
+static unsigned long lookups = 0;       //!< Calls to countingLoad() so far.
+
+/**
+ * @brief Loader that counts its calls and forwards them to countedLoad.
+ */
+static void *countingLoad(const char *name)
+{
+    ++lookups;
+    return countedLoad(name);
+}
+
+/**
+ * @brief Ways of loading the functions that are compared.
+ */
+enum LoaderPath
+{
+    LOADER_EAGER, //!< gladLoadGLLoader.
+    LOADER_LAZY,  //!< gladLoadGLLoaderLazy.
+    LOADER_PATHS
+};
+
+const char *const LOADER_PATH_NAMES[LOADER_PATHS] = {"eager", "lazy"}; //!< Names for reports.
+
+const unsigned long EXTENSION_QUERY_ROUNDS = 1000; //!< Times each name is looked up in the extension benchmark.
+
+/**
+ * @brief Looks an extension up the way glad used to, comparing against every name in turn.
+ */
+static bool scanExtensions(const std::vector<std::string> &extensions, const char *name)
+{
+    for (std::size_t i = 0; i < extensions.size(); ++i)
+    {
+        if (std::strcmp(extensions[i].c_str(), name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool loadGl(GLADloadproc load, bool eager)
+{
+    if (!(eager ? gladLoadGLLoader : gladLoadGLLoaderLazy)(load))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return false;
+    }
+    lazyLoad = eager ? NULL : load;
+    return true;
+}
+
+bool resolveGl()
+{
+    if (lazyLoad == NULL)
+    {
+        return true;
+    }
+    if (!gladLoadGLLoader(lazyLoad))
+    {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return false;
+    }
+    lazyLoad = NULL;
+    return true;
+}
+
+void runLoaderBenchmark(GLADloadproc load, unsigned long runs, const std::function<void()> &firstFrame,
+                        std::ostream &out)
+{
+    countedLoad = load;
+
+    FrameStats loadTimes[LOADER_PATHS];
+    FrameStats frameTimes[LOADER_PATHS];
+    FrameStats totalTimes[LOADER_PATHS];
+    unsigned long loadLookups[LOADER_PATHS];
+    unsigned long frameLookups[LOADER_PATHS];
+    bool loaded = true;
+
+    // The paths take turns, so that both see the driver in the same state; the
+    // first round only warms up.
+    //
+    for (unsigned long run = 0; run <= runs; ++run)
+    {
+        for (int path = 0; path < LOADER_PATHS; ++path)
+        {
+            lookups = 0;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            loaded = (path == LOADER_EAGER ? gladLoadGLLoader(countingLoad) : gladLoadGLLoaderLazy(countingLoad)) &&
+                     loaded;
+            const std::chrono::steady_clock::time_point loadEnd = std::chrono::steady_clock::now();
+            loadLookups[path] = lookups;
+
+            lookups = 0;
+            firstFrame();
+            const std::chrono::steady_clock::time_point frameEnd = std::chrono::steady_clock::now();
+            frameLookups[path] = lookups;
+
+            if (run > 0)
+            {
+                loadTimes[path].addSample(std::chrono::duration<double, std::milli>(loadEnd - start).count());
+                frameTimes[path].addSample(std::chrono::duration<double, std::milli>(frameEnd - loadEnd).count());
+                totalTimes[path].addSample(std::chrono::duration<double, std::milli>(frameEnd - start).count());
+            }
+        }
+    }
+    lazyLoad = countingLoad;
+
+    // Query every name the driver reports, and as many it does not, through
+    // both lookups.
+    //
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    std::vector<std::string> extensions;
+    std::vector<std::string> queries;
+    for (GLint i = 0; i < count; ++i)
+    {
+        extensions.push_back((const char *)glGetStringi(GL_EXTENSIONS, (GLuint)i));
+        queries.push_back(extensions.back());
+        queries.push_back(extensions.back() + "_missing");
+    }
+    double queryNs[2] = {0.0, 0.0};
+    std::size_t found[2] = {0, 0};
+    for (int lookup = 0; lookup < 2; ++lookup)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (unsigned long round = 0; round < EXTENSION_QUERY_ROUNDS; ++round)
+        {
+            for (std::size_t i = 0; i < queries.size(); ++i)
+            {
+                const bool present = lookup == 0 ? gladHasExtension(queries[i].c_str()) != 0
+                                                 : scanExtensions(extensions, queries[i].c_str());
+                found[lookup] += present ? 1 : 0;
+            }
+        }
+        queryNs[lookup] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                          (double)(EXTENSION_QUERY_ROUNDS * queries.size());
+    }
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "GL loader: " << runs << " runs of loading the functions and drawing a first frame on "
+        << glGetString(GL_RENDERER) << std::endl;
+    out << std::fixed << std::setprecision(3);
+    for (int path = 0; path < LOADER_PATHS; ++path)
+    {
+        out << std::left << std::setw(7) << LOADER_PATH_NAMES[path] << std::right << loadLookups[path]
+            << " lookups while loading, " << frameLookups[path] << " during the first frame" << std::endl;
+        loadTimes[path].report(out, "load");
+        frameTimes[path].report(out, "first frame");
+        totalTimes[path].report(out, "load + frame");
+    }
+    out << std::setprecision(1) << "lazy vs eager load + frame at p50: "
+        << totalTimes[LOADER_EAGER].percentile(50.0) / totalTimes[LOADER_LAZY].percentile(50.0) << "x"
+        << (loaded ? "" : ", LOADING FAILED") << std::endl;
+    out << "extension queries over " << count << " extensions: hashed " << queryNs[0] << " ns, linear scan "
+        << queryNs[1] << " ns, " << queryNs[1] / queryNs[0] << "x, same answers: "
+        << (found[0] == found[1] && found[0] == (std::size_t)count * EXTENSION_QUERY_ROUNDS ? "yes" : "NO")
+        << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
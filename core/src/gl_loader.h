@@ -0,0 +1,76 @@
+/**
+ * @file gl_loader.h
+ * @brief Startup cost of resolving OpenGL functions eagerly and lazily.
+ *
+ * gladLoadGLLoader looks up every function of every GL version up to 3.3,
+ * hundreds of string lookups in the driver, although a frame of this example
+ * calls about twenty of them. gladLoadGLLoaderLazy instead points each
+ * function at a trampoline that looks it up on its first call and patches
+ * itself out, so startup only pays for the functions that are used.
+ *
+ * Lazy loading is only for a single GL thread; a second one gets every
+ * function resolved first by resolveGl().
+ *
+ * Extensions are answered by gladHasExtension from a hash table built while
+ * loading, rather than by scanning the list of names, which drivers make
+ * hundreds long.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GL_LOADER_H
+#define GL_LOADER_H
+
+#include <glad/glad.h>
+
+#include <functional>
+#include <ostream>
+
+/**
+ * @brief Loads the GL functions of the current context.
+ *
+ * Unless eager, each function is only looked up on its first call; a few
+ * dozen of the hundreds there are ever get called. Prints an error if they
+ * could not be loaded.
+ *
+ * @param load loader of the context, such as glfwGetProcAddress
+ * @param eager resolve every function now with gladLoadGLLoader
+ * @return true if the functions were loaded
+ */
+bool loadGl(GLADloadproc load, bool eager = false);
+
+/**
+ * @brief Resolves every GL function still loaded lazily, before a second thread makes GL calls.
+ *
+ * The trampolines patch plain pointers that every GL call reads, so two
+ * threads calling a function for the first time at once would race on it.
+ * Called when a context shared with another thread is created, while the
+ * calling thread's context is current and no other thread makes GL calls.
+ * Does nothing if the functions were loaded eagerly. Prints an error if they
+ * could not be loaded.
+ *
+ * @return true if every function is resolved
+ */
+bool resolveGl();
+
+/**
+ * @brief Compares loading GL functions with gladLoadGLLoader and gladLoadGLLoaderLazy.
+ *
+ * Each run loads the functions, then builds a scene, draws one frame and
+ * deletes the scene again, which is where lazy loading pays for its lookups.
+ * Reports the time and the number of lookups of both steps. Then times
+ * gladHasExtension against a linear scan of the extension names, for names
+ * that are there and names that are not. Needs a current context; leaves the
+ * functions loaded lazily.
+ *
+ * @param load loader to resolve functions with
+ * @param runs times to load and draw with each loader
+ * @param firstFrame builds a scene, draws a frame with it, waits for the GPU and deletes it
+ * @param out stream to write the report to
+ */
+void runLoaderBenchmark(GLADloadproc load, unsigned long runs, const std::function<void()> &firstFrame,
+                        std::ostream &out);
+
+#endif // GL_LOADER_H
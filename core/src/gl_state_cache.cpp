@@ -0,0 +1,274 @@
+/**
+ * @file gl_state_cache.cpp
+ * @brief Shadow copy of GL state that drops calls which would not change anything.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "gl_state_cache.h"
+
+GlStateCache::GlStateCache()
+{
+    reset();
+
+    frame_.issued = 0;
+    frame_.elided = 0;
+    total_ = frame_;
+}
+
+void GlStateCache::reset()
+{
+    program_ = 0;
+    vertexArray_ = 0;
+    programKnown_ = false;
+    vertexArrayKnown_ = false;
+    clearColorKnown_ = false;
+    viewportKnown_ = false;
+
+    for (unsigned int slot = 0; slot < BUFFER_TARGETS; ++slot)
+    {
+        buffers_[slot] = 0;
+        buffersKnown_[slot] = false;
+    }
+    for (unsigned int slot = 0; slot < CAPABILITIES; ++slot)
+    {
+        capabilities_[slot] = false;
+        capabilitiesKnown_[slot] = false;
+    }
+}
+
+void GlStateCache::beginFrame()
+{
+    frame_.issued = 0;
+    frame_.elided = 0;
+}
+
+void GlStateCache::useProgram(GLuint program)
+{
+    if (programKnown_ && program_ == program)
+    {
+        elided();
+        return;
+    }
+
+    glUseProgram(program);
+    program_ = program;
+    programKnown_ = true;
+    issued();
+}
+
+void GlStateCache::bindVertexArray(GLuint vertexArray)
+{
+    if (vertexArrayKnown_ && vertexArray_ == vertexArray)
+    {
+        elided();
+        return;
+    }
+
+    glBindVertexArray(vertexArray);
+    vertexArray_ = vertexArray;
+    vertexArrayKnown_ = true;
+    issued();
+
+    // The element array buffer binding is part of the vertex array's state, so
+    // it changes along with the vertex array.
+    //
+    buffersKnown_[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = false;
+}
+
+void GlStateCache::bindBuffer(GLenum target, GLuint buffer)
+{
+    const unsigned int slot = bufferSlot(target);
+    if (slot < BUFFER_TARGETS && buffersKnown_[slot] && buffers_[slot] == buffer)
+    {
+        elided();
+        return;
+    }
+
+    glBindBuffer(target, buffer);
+    issued();
+
+    if (slot < BUFFER_TARGETS)
+    {
+        buffers_[slot] = buffer;
+        buffersKnown_[slot] = true;
+    }
+}
+
+void GlStateCache::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    if (clearColorKnown_ && clearColor_[0] == red && clearColor_[1] == green &&
+        clearColor_[2] == blue && clearColor_[3] == alpha)
+    {
+        elided();
+        return;
+    }
+
+    glClearColor(red, green, blue, alpha);
+    clearColor_[0] = red;
+    clearColor_[1] = green;
+    clearColor_[2] = blue;
+    clearColor_[3] = alpha;
+    clearColorKnown_ = true;
+    issued();
+}
+
+void GlStateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    if (viewportKnown_ && viewport_[0] == x && viewport_[1] == y &&
+        viewport_[2] == width && viewport_[3] == height)
+    {
+        elided();
+        return;
+    }
+
+    glViewport(x, y, width, height);
+    viewport_[0] = x;
+    viewport_[1] = y;
+    viewport_[2] = width;
+    viewport_[3] = height;
+    viewportKnown_ = true;
+    issued();
+}
+
+void GlStateCache::enable(GLenum capability)
+{
+    setCapability(capability, true);
+}
+
+void GlStateCache::disable(GLenum capability)
+{
+    setCapability(capability, false);
+}
+
+void GlStateCache::deleteProgram(GLuint program)
+{
+    // Deleting the program in use does not unbind it; it stays bound until
+    // another program is used. Forget it anyway so the name can be reused.
+    //
+    if (program_ == program)
+    {
+        programKnown_ = false;
+    }
+    glDeleteProgram(program);
+}
+
+void GlStateCache::deleteVertexArray(GLuint vertexArray)
+{
+    // Deleting a bound vertex array reverts the binding to zero.
+    //
+    if (vertexArrayKnown_ && vertexArray_ == vertexArray)
+    {
+        vertexArray_ = 0;
+        buffersKnown_[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = false;
+    }
+    glDeleteVertexArrays(1, &vertexArray);
+}
+
+void GlStateCache::deleteBuffer(GLuint buffer)
+{
+    // Deleting a bound buffer reverts each binding of it to zero.
+    //
+    for (unsigned int slot = 0; slot < BUFFER_TARGETS; ++slot)
+    {
+        if (buffersKnown_[slot] && buffers_[slot] == buffer)
+        {
+            buffers_[slot] = 0;
+        }
+    }
+    glDeleteBuffers(1, &buffer);
+}
+
+unsigned int GlStateCache::bufferSlot(GLenum target)
+{
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER:
+        return 0;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        return 1;
+    case GL_COPY_READ_BUFFER:
+        return 2;
+    case GL_COPY_WRITE_BUFFER:
+        return 3;
+    case GL_PIXEL_PACK_BUFFER:
+        return 4;
+    case GL_PIXEL_UNPACK_BUFFER:
+        return 5;
+    case GL_UNIFORM_BUFFER:
+        return 6;
+    case GL_TEXTURE_BUFFER:
+        return 7;
+    default:
+        return BUFFER_TARGETS;
+    }
+}
+
+unsigned int GlStateCache::capabilitySlot(GLenum capability)
+{
+    switch (capability)
+    {
+    case GL_BLEND:
+        return 0;
+    case GL_CULL_FACE:
+        return 1;
+    case GL_DEPTH_TEST:
+        return 2;
+    case GL_SCISSOR_TEST:
+        return 3;
+    case GL_STENCIL_TEST:
+        return 4;
+    case GL_POLYGON_OFFSET_FILL:
+        return 5;
+    case GL_PRIMITIVE_RESTART:
+        return 6;
+    case GL_PROGRAM_POINT_SIZE:
+        return 7;
+    case GL_RASTERIZER_DISCARD:
+        return 8;
+    case GL_FRAMEBUFFER_SRGB:
+        return 9;
+    default:
+        return CAPABILITIES;
+    }
+}
+
+void GlStateCache::setCapability(GLenum capability, bool enabled)
+{
+    const unsigned int slot = capabilitySlot(capability);
+    if (slot < CAPABILITIES && capabilitiesKnown_[slot] && capabilities_[slot] == enabled)
+    {
+        elided();
+        return;
+    }
+
+    if (enabled)
+    {
+        glEnable(capability);
+    }
+    else
+    {
+        glDisable(capability);
+    }
+    issued();
+
+    if (slot < CAPABILITIES)
+    {
+        capabilities_[slot] = enabled;
+        capabilitiesKnown_[slot] = true;
+    }
+}
+
+void GlStateCache::issued()
+{
+    ++frame_.issued;
+    ++total_.issued;
+}
+
+void GlStateCache::elided()
+{
+    ++frame_.elided;
+    ++total_.elided;
+}
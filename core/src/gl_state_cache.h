@@ -0,0 +1,144 @@
+/**
+ * @file gl_state_cache.h
+ * @brief Shadow copy of GL state that drops calls which would not change anything.
+ *
+ * Binding the same program or vertex array again is not free; the driver still
+ * validates the call and may mark state dirty. Rendering goes through this cache,
+ * which only forwards a call when the value actually differs from what is bound.
+ *
+ * The cache assumes it sees every change to the state it tracks. Call reset()
+ * after anything else changes that state behind its back.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include <glad/glad.h>
+
+/**
+ * @brief Tracks bound objects, clear color, viewport and enable flags.
+ */
+class GlStateCache
+{
+public:
+    /**
+     * @brief Number of state calls made and skipped.
+     */
+    struct Counters
+    {
+        unsigned long issued; //!< Calls forwarded to GL.
+        unsigned long elided; //!< Calls dropped because nothing would change.
+    };
+
+    GlStateCache();
+
+    /**
+     * @brief Forgets all tracked state so the next call of each kind is issued.
+     */
+    void reset();
+
+    /**
+     * @brief Starts counting a new frame.
+     */
+    void beginFrame();
+
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint vertexArray);
+    void bindBuffer(GLenum target, GLuint buffer);
+    void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+    void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void enable(GLenum capability);
+    void disable(GLenum capability);
+
+    /**
+     * @brief Deletes a program, forgetting it if it is bound.
+     *
+     * @param program the program to delete
+     */
+    void deleteProgram(GLuint program);
+
+    /**
+     * @brief Deletes a vertex array, forgetting it if it is bound.
+     *
+     * @param vertexArray the vertex array to delete
+     */
+    void deleteVertexArray(GLuint vertexArray);
+
+    /**
+     * @brief Deletes a buffer, forgetting it wherever it is bound.
+     *
+     * @param buffer the buffer to delete
+     */
+    void deleteBuffer(GLuint buffer);
+
+    /**
+     * @brief Counts since beginFrame(), i.e. for the latest frame.
+     *
+     * @return the counts
+     */
+    const Counters &frame() const { return frame_; }
+
+    /**
+     * @brief Counts over all frames so far.
+     *
+     * @return the counts
+     */
+    const Counters &total() const { return total_; }
+
+private:
+    static const unsigned int BUFFER_TARGETS = 8; //!< Buffer binding points tracked.
+    static const unsigned int CAPABILITIES = 10;  //!< Enable flags tracked.
+
+    /**
+     * @brief Maps a buffer binding point to its slot in the cache.
+     *
+     * @param target the binding point
+     * @return the slot, or BUFFER_TARGETS if the binding point is not tracked
+     */
+    static unsigned int bufferSlot(GLenum target);
+
+    /**
+     * @brief Maps an enable flag to its slot in the cache.
+     *
+     * @param capability the flag
+     * @return the slot, or CAPABILITIES if the flag is not tracked
+     */
+    static unsigned int capabilitySlot(GLenum capability);
+
+    /**
+     * @brief Sets an enable flag through the cache.
+     *
+     * @param capability the flag
+     * @param enabled the new value
+     */
+    void setCapability(GLenum capability, bool enabled);
+
+    void issued();
+    void elided();
+
+    // State is stored alongside a flag saying whether it is known, since at
+    // start-up and after reset() the real value is not.
+    //
+    GLuint program_;
+    GLuint vertexArray_;
+    GLuint buffers_[BUFFER_TARGETS];
+    GLfloat clearColor_[4];
+    GLint viewport_[4];
+    bool capabilities_[CAPABILITIES];
+
+    bool programKnown_;
+    bool vertexArrayKnown_;
+    bool buffersKnown_[BUFFER_TARGETS];
+    bool clearColorKnown_;
+    bool viewportKnown_;
+    bool capabilitiesKnown_[CAPABILITIES];
+
+    Counters frame_;
+    Counters total_;
+};
+
+#endif // GL_STATE_CACHE_H
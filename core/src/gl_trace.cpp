@@ -0,0 +1,295 @@
+/**
+ * @file gl_trace.cpp
+ * @brief Counts and times every GL call in builds made with GL_TRACE.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifdef GL_TRACE
+
+#include "gl_trace.h"
+
+#include "trace_buffer.h"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+const std::size_t CHUNK_EVENTS = 16384;   //!< Events per buffer chunk.
+const std::size_t MAX_THREAD_CHUNKS = 64; //!< Chunks a thread fills before it only counts calls.
+const int FRAME_MARKER = -1;              //!< Function of the events glTraceFrame() records.
+const std::size_t REPORT_FUNCTIONS = 12;  //!< Functions listed by glTraceReport().
+
+/**
+ * @brief A call, or the end of a frame.
+ */
+struct TraceEvent
+{
+    std::uint64_t begin;             // Nanoseconds on the steady clock.
+    std::uint32_t duration;          // Nanoseconds.
+    std::int32_t function;           // Glad's number for the function, or FRAME_MARKER.
+    long long args[GLAD_TRACE_ARGS]; // The first integer arguments.
+};
+
+/**
+ * @brief Everything one thread recorded.
+ */
+struct ThreadTrace
+{
+    int index;                         // Order in which threads first called GL.
+    TraceEventBuffer<TraceEvent, CHUNK_EVENTS, MAX_THREAD_CHUNKS> events;
+    std::atomic<std::uint64_t> *calls; // Per function; written by the owner only.
+    std::atomic<std::uint64_t> *ns;    // Per function; written by the owner only.
+    std::atomic<std::uint64_t> frames;
+    ThreadTrace *next;
+};
+
+typedef TraceThreads<ThreadTrace> GlTraceThreads; //!< Every thread that called GL.
+
+static bool started = false; //!< Whether glTraceStart() was called.
+
+/**
+ * @brief The calling thread's buffer, which it gets and adds to the list on its first call.
+ */
+static ThreadTrace *thisThread()
+{
+    ThreadTrace *thread = GlTraceThreads::current();
+    if (thread != NULL)
+    {
+        return thread;
+    }
+
+    const int functions = gladTraceFunctionCount();
+    thread = new ThreadTrace;
+    thread->calls = new std::atomic<std::uint64_t>[functions];
+    thread->ns = new std::atomic<std::uint64_t>[functions];
+    for (int i = 0; i < functions; ++i)
+    {
+        thread->calls[i].store(0, std::memory_order_relaxed);
+        thread->ns[i].store(0, std::memory_order_relaxed);
+    }
+    thread->frames.store(0);
+    return GlTraceThreads::join(thread);
+}
+
+/**
+ * @brief Appends an event to the calling thread's buffer.
+ */
+static void record(ThreadTrace *thread, int function, std::uint64_t begin, std::uint64_t duration,
+                   const long long *args)
+{
+    TraceEvent event;
+    event.begin = begin;
+    event.duration = duration > 0xffffffffu ? 0xffffffffu : (std::uint32_t)duration;
+    event.function = function;
+    for (int i = 0; i < GLAD_TRACE_ARGS; ++i)
+    {
+        event.args[i] = args != NULL ? args[i] : 0;
+    }
+    thread->events.add(event);
+}
+
+/**
+ * @brief Begin hook: the time the call starts.
+ */
+static unsigned long long traceBegin()
+{
+    return traceNow();
+}
+
+/**
+ * @brief End hook: counts the call and records it.
+ */
+static void traceEnd(int function, unsigned long long begin, const long long *args)
+{
+    const std::uint64_t duration = traceNow() - begin;
+    ThreadTrace *thread = thisThread();
+
+    // Only this thread writes its counters, so a plain load and store does;
+    // the atomics are for the thread that reports them.
+    //
+    thread->calls[function].store(thread->calls[function].load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+    thread->ns[function].store(thread->ns[function].load(std::memory_order_relaxed) + duration,
+                               std::memory_order_relaxed);
+    record(thread, function, begin, duration, args);
+}
+
+void glTraceStart()
+{
+    GlTraceThreads::start();
+    started = true;
+    gladSetTraceHooks(traceBegin, traceEnd);
+}
+
+void glTraceFrame()
+{
+    if (!started)
+    {
+        return;
+    }
+    ThreadTrace *thread = thisThread();
+    thread->frames.store(thread->frames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    record(thread, FRAME_MARKER, traceNow(), 0, NULL);
+}
+
+bool glTraceWrite(const char *path)
+{
+    ChromeTraceWriter writer;
+    if (!writer.open(path, GlTraceThreads::epoch()))
+    {
+        std::cout << "ERROR::GL_TRACE::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+
+    const int functions = gladTraceFunctionCount();
+    std::vector<std::uint64_t> frameCalls(functions, 0);
+    char name[32];
+
+    for (const ThreadTrace *thread = GlTraceThreads::first(); thread != NULL; thread = thread->next)
+    {
+        const int tid = thread->index;
+        std::snprintf(name, sizeof(name), "GL thread %d", tid);
+        writer.threadName(tid, name);
+
+        // A frame spans from the end of the one before, or the thread's first
+        // call, to its marker.
+        //
+        std::uint64_t frameBegin = 0;
+        bool frameStarted = false;
+        std::uint64_t frameTotalCalls = 0;
+        std::uint64_t frameNs = 0;
+        unsigned long frame = 0;
+
+        thread->events.forEach(
+            [&](const TraceEvent &event)
+            {
+                if (!frameStarted)
+                {
+                    frameBegin = event.begin;
+                    frameStarted = true;
+                }
+
+                if (event.function == FRAME_MARKER)
+                {
+                    std::snprintf(name, sizeof(name), "frame %lu", frame);
+                    writer.beginEvent(name, "frame", tid, frameBegin, event.begin - frameBegin);
+                    writer.arg("calls", (long long)frameTotalCalls);
+                    writer.argMicroseconds("gl_us", frameNs);
+                    for (int function = 0; function < functions; ++function)
+                    {
+                        if (frameCalls[function] > 0)
+                        {
+                            writer.arg(gladTraceFunctionName(function), (long long)frameCalls[function]);
+                            frameCalls[function] = 0;
+                        }
+                    }
+                    writer.endEvent();
+
+                    frameBegin = event.begin;
+                    frameTotalCalls = 0;
+                    frameNs = 0;
+                    ++frame;
+                    return;
+                }
+
+                writer.beginEvent(gladTraceFunctionName(event.function), "gl", tid, event.begin, event.duration);
+                for (int arg = 0; arg < GLAD_TRACE_ARGS; ++arg)
+                {
+                    const char *argName = gladTraceArgumentName(event.function, arg);
+                    if (argName != NULL)
+                    {
+                        writer.arg(argName, event.args[arg]);
+                    }
+                }
+                writer.endEvent();
+
+                ++frameCalls[event.function];
+                ++frameTotalCalls;
+                frameNs += event.duration;
+            });
+        std::fill(frameCalls.begin(), frameCalls.end(), 0);
+    }
+
+    if (!writer.close())
+    {
+        std::cout << "ERROR::GL_TRACE::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void glTraceReport(std::ostream &out)
+{
+    // Sum every thread's counters per function.
+    //
+    const int functions = gladTraceFunctionCount();
+    std::vector<std::uint64_t> calls(functions, 0);
+    std::vector<std::uint64_t> ns(functions, 0);
+    std::uint64_t totalCalls = 0;
+    std::uint64_t totalNs = 0;
+    std::uint64_t frames = 0;
+    std::uint64_t dropped = 0;
+    for (const ThreadTrace *thread = GlTraceThreads::first(); thread != NULL; thread = thread->next)
+    {
+        for (int function = 0; function < functions; ++function)
+        {
+            calls[function] += thread->calls[function].load(std::memory_order_relaxed);
+            ns[function] += thread->ns[function].load(std::memory_order_relaxed);
+        }
+        frames = std::max(frames, thread->frames.load(std::memory_order_relaxed));
+        dropped += thread->events.dropped();
+    }
+    std::vector<int> order;
+    for (int function = 0; function < functions; ++function)
+    {
+        if (calls[function] > 0)
+        {
+            order.push_back(function);
+            totalCalls += calls[function];
+            totalNs += ns[function];
+        }
+    }
+    std::sort(order.begin(), order.end(),
+              [&ns](int a, int b)
+              {
+                  return ns[a] > ns[b];
+              });
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    const int threads = GlTraceThreads::count();
+    out << "GL trace: " << totalCalls << " calls to " << order.size() << " functions on " << threads
+        << (threads == 1 ? " thread" : " threads") << " over " << frames << " frames, " << std::fixed
+        << std::setprecision(3) << (double)totalNs / 1.0e6 << " ms in GL";
+    if (dropped > 0)
+    {
+        out << ", " << dropped << " calls counted but not recorded";
+    }
+    out << std::endl;
+    out << "  " << std::left << std::setw(28) << "function" << std::right << std::setw(10) << "calls"
+        << std::setw(13) << "calls/frame" << std::setw(12) << "total ms" << std::setw(10) << "ns/call"
+        << std::setw(8) << "share" << std::endl;
+    for (std::size_t i = 0; i < order.size() && i < REPORT_FUNCTIONS; ++i)
+    {
+        const int function = order[i];
+        out << "  " << std::left << std::setw(28) << gladTraceFunctionName(function) << std::right << std::setw(10)
+            << calls[function] << std::setprecision(1) << std::setw(13)
+            << (frames > 0 ? (double)calls[function] / (double)frames : 0.0) << std::setprecision(3)
+            << std::setw(12) << (double)ns[function] / 1.0e6 << std::setprecision(0) << std::setw(10)
+            << (double)ns[function] / (double)calls[function] << std::setprecision(1) << std::setw(7)
+            << (totalNs > 0 ? 100.0 * (double)ns[function] / (double)totalNs : 0.0) << "%" << std::endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+#endif // GL_TRACE
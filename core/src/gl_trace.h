@@ -0,0 +1,72 @@
+/**
+ * @file gl_trace.h
+ * @brief Counts and times every GL call in builds made with GL_TRACE.
+ *
+ * With GL_TRACE defined, glad puts a shim in front of each GL function that
+ * reports every call to the hooks installed by glTraceStart(). Each thread
+ * appends its calls to a buffer of its own, with the function, the CPU time
+ * spent in it and its first few integer arguments, and keeps a running count
+ * and total time per function. Nothing is shared between threads on that
+ * path except a list of the buffers, which a thread joins without a lock on
+ * its first call. glTraceFrame() marks where each frame ends.
+ *
+ * glTraceWrite() dumps everything as Chrome trace JSON, to open in
+ * chrome://tracing or Perfetto: one row per thread, each frame as a span over
+ * the calls it made, with its call counts per function.
+ *
+ * Without GL_TRACE these functions are empty and glad calls the driver
+ * directly, so tracing costs nothing unless it is built in.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <ostream>
+
+#ifdef GL_TRACE
+
+/**
+ * @brief Starts recording GL calls.
+ *
+ * Installs the hooks into glad. Call before any thread uses GL; the shims are
+ * only in place once the functions are loaded.
+ */
+void glTraceStart();
+
+/**
+ * @brief Marks the end of a frame on the calling thread.
+ */
+void glTraceFrame();
+
+/**
+ * @brief Writes the calls recorded so far as Chrome trace JSON.
+ *
+ * Other threads may keep calling GL; their calls after the ones written are
+ * left out.
+ *
+ * @param path file to write
+ * @return false if the file could not be written
+ */
+bool glTraceWrite(const char *path);
+
+/**
+ * @brief Reports the functions that took the most CPU time, with their calls per frame.
+ *
+ * @param out stream to write the report to
+ */
+void glTraceReport(std::ostream &out);
+
+#else
+
+inline void glTraceStart() {}
+inline void glTraceFrame() {}
+inline bool glTraceWrite(const char *) { return false; }
+inline void glTraceReport(std::ostream &) {}
+
+#endif // GL_TRACE
+
+#endif // GL_TRACE_H
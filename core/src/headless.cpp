@@ -0,0 +1,288 @@
+/**
+ * @file headless.cpp
+ * @brief Offscreen OpenGL context and render target for running without a display.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "headless.h"
+
+#include "gl_loader.h"
+
+#include <EGL/eglext.h>
+
+#include <cstring>
+#include <iostream>
+
+/**
+ * @brief Checks whether an extension is in an EGL extension string.
+ *
+ * @param extensions space separated list of extensions, may be NULL
+ * @param name name of the extension to look for
+ * @return true if the extension is listed
+ */
+static bool hasEglExtension(const char *extensions, const char *name)
+{
+    if (extensions == NULL)
+    {
+        return false;
+    }
+
+    const std::size_t length = std::strlen(name);
+    const char *found = extensions;
+    while ((found = std::strstr(found, name)) != NULL)
+    {
+        // Make sure the match is a whole word, not the prefix of another name.
+        //
+        if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+        {
+            return true;
+        }
+        found += length;
+    }
+    return false;
+}
+
+HeadlessContext::HeadlessContext()
+    : display_(EGL_NO_DISPLAY), config_(NULL), context_(EGL_NO_CONTEXT), surface_(EGL_NO_SURFACE),
+      surfaceless_(false), ownsDisplay_(true)
+{
+}
+
+HeadlessContext::~HeadlessContext()
+{
+    destroy();
+}
+
+bool HeadlessContext::create(bool debug)
+{
+    ownsDisplay_ = true;
+
+    // Prefer the surfaceless platform so no display server is needed at all. It
+    // is exposed by Mesa, which provides llvmpipe on machines without a GPU.
+    //
+    const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (hasEglExtension(clientExtensions, "EGL_MESA_platform_surfaceless") &&
+        hasEglExtension(clientExtensions, "EGL_EXT_platform_base"))
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay != NULL)
+        {
+            display_ = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        }
+    }
+    if (display_ == EGL_NO_DISPLAY)
+    {
+        display_ = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major;
+    EGLint minor;
+    if (display_ == EGL_NO_DISPLAY || !eglInitialize(display_, &major, &minor))
+    {
+        std::cout << "Failed to initialize EGL display" << std::endl;
+        display_ = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API))
+    {
+        std::cout << "EGL does not support the desktop OpenGL API" << std::endl;
+        destroy();
+        return false;
+    }
+
+    const char *displayExtensions = eglQueryString(display_, EGL_EXTENSIONS);
+    surfaceless_ = hasEglExtension(displayExtensions, "EGL_KHR_surfaceless_context");
+
+    // Pick a config. A pbuffer config is only required when the context cannot
+    // be made current without a surface.
+    //
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, surfaceless_ ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_NONE};
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display_, configAttributes, &config_, 1, &configCount) || configCount == 0)
+    {
+        if (!surfaceless_ || !hasEglExtension(displayExtensions, "EGL_KHR_no_config_context"))
+        {
+            std::cout << "Failed to find a suitable EGL config" << std::endl;
+            destroy();
+            return false;
+        }
+        config_ = EGL_NO_CONFIG_KHR;
+    }
+
+    if (!createContext(EGL_NO_CONTEXT, debug))
+    {
+        return false;
+    }
+
+    if (!makeCurrent())
+    {
+        std::cout << "Failed to make EGL context current" << std::endl;
+        destroy();
+        return false;
+    }
+
+    return true;
+}
+
+bool HeadlessContext::createShared(const HeadlessContext &share)
+{
+    if (share.context_ == EGL_NO_CONTEXT)
+    {
+        return false;
+    }
+
+    // Sharing needs both contexts on the same display with compatible configs,
+    // so take both from the other context; it keeps ownership of the display.
+    //
+    display_ = share.display_;
+    config_ = share.config_;
+    surfaceless_ = share.surfaceless_;
+    ownsDisplay_ = false;
+
+    // The context is for another thread, which must not race this one
+    // through the lazy GL trampolines.
+    //
+    return createContext(share.context_, false) && resolveGl();
+}
+
+bool HeadlessContext::createContext(EGLContext share, bool debug)
+{
+    // Same version and profile as the windowed path requests from GLFW.
+    //
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+        EGL_NONE};
+    context_ = eglCreateContext(display_, config_, share, contextAttributes);
+    if (context_ == EGL_NO_CONTEXT)
+    {
+        std::cout << "Failed to create EGL context (0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+        destroy();
+        return false;
+    }
+
+    if (!surfaceless_)
+    {
+        // All rendering goes to a framebuffer object, so the surface is tiny.
+        //
+        const EGLint surfaceAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        surface_ = eglCreatePbufferSurface(display_, config_, surfaceAttributes);
+        if (surface_ == EGL_NO_SURFACE)
+        {
+            std::cout << "Failed to create EGL pbuffer surface" << std::endl;
+            destroy();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool HeadlessContext::makeCurrent()
+{
+    return eglMakeCurrent(display_, surface_, surface_, context_) == EGL_TRUE;
+}
+
+void HeadlessContext::release()
+{
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+void HeadlessContext::destroy()
+{
+    if (display_ == EGL_NO_DISPLAY)
+    {
+        return;
+    }
+
+    // Only let go of the context if it is this one; a shared context is
+    // destroyed from a thread that still renders with the other.
+    //
+    if (context_ != EGL_NO_CONTEXT && eglGetCurrentContext() == context_)
+    {
+        release();
+    }
+    if (surface_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_, surface_);
+        surface_ = EGL_NO_SURFACE;
+    }
+    if (context_ != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(display_, context_);
+        context_ = EGL_NO_CONTEXT;
+    }
+    if (ownsDisplay_)
+    {
+        eglTerminate(display_);
+    }
+    display_ = EGL_NO_DISPLAY;
+}
+
+void *HeadlessContext::getProcAddress(const char *name)
+{
+    return (void *)eglGetProcAddress(name);
+}
+
+OffscreenTarget::OffscreenTarget()
+    : framebuffer_(0), colorBuffer_(0), width_(0), height_(0)
+{
+}
+
+OffscreenTarget::~OffscreenTarget()
+{
+    destroy();
+}
+
+bool OffscreenTarget::create(int width, int height)
+{
+    width_ = width;
+    height_ = height;
+
+    glGenRenderbuffers(1, &colorBuffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &framebuffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer_);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cout << "ERROR::FRAMEBUFFER::INCOMPLETE" << std::endl;
+        destroy();
+        return false;
+    }
+
+    glViewport(0, 0, width, height);
+    return true;
+}
+
+void OffscreenTarget::destroy()
+{
+    if (framebuffer_ != 0)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &framebuffer_);
+        framebuffer_ = 0;
+    }
+    if (colorBuffer_ != 0)
+    {
+        glDeleteRenderbuffers(1, &colorBuffer_);
+        colorBuffer_ = 0;
+    }
+}
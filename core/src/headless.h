@@ -0,0 +1,130 @@
+/**
+ * @file headless.h
+ * @brief Offscreen OpenGL context and render target for running without a display.
+ *
+ * The context is created through EGL, preferring the Mesa surfaceless platform so
+ * that it works on build machines without a GPU or a display server (llvmpipe).
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+
+/**
+ * @brief An OpenGL 3.3 core context created through EGL with no window.
+ */
+class HeadlessContext
+{
+public:
+    HeadlessContext();
+    ~HeadlessContext();
+
+    /**
+     * @brief Creates the context and makes it current on the calling thread.
+     *
+     * @param debug create a debug context, in which drivers report more through debug output
+     * @return true if the context was created and made current
+     */
+    bool create(bool debug = false);
+
+    /**
+     * @brief Creates a context that shares objects with another, without making it current.
+     *
+     * Buffers, textures, programs and sync objects made in either context can
+     * be used in the other; vertex arrays and framebuffers cannot. Meant to be
+     * made current on a second thread with makeCurrent(), so every GL function
+     * still loaded lazily is resolved first, with the other context current.
+     * Destroy it before the context it shares with.
+     *
+     * @param share a created context, whose display is reused
+     * @return true if the context was created and the functions resolved
+     */
+    bool createShared(const HeadlessContext &share);
+
+    /**
+     * @brief Makes the context current on the calling thread.
+     *
+     * @return true if the context is now current
+     */
+    bool makeCurrent();
+
+    /**
+     * @brief Makes no context current on the calling thread.
+     */
+    void release();
+
+    /**
+     * @brief Releases and destroys the context, if one was created.
+     */
+    void destroy();
+
+    /**
+     * @brief Loader passed to gladLoadGLLoader.
+     *
+     * @param name name of the OpenGL function to resolve
+     * @return address of the function, or NULL if not found
+     */
+    static void *getProcAddress(const char *name);
+
+private:
+    HeadlessContext(const HeadlessContext &);            // Not copyable.
+    HeadlessContext &operator=(const HeadlessContext &); // Not copyable.
+
+    /**
+     * @brief Creates the context and its surface, if it needs one, on display_.
+     */
+    bool createContext(EGLContext share, bool debug);
+
+    EGLDisplay display_;
+    EGLConfig config_;
+    EGLContext context_;
+    EGLSurface surface_; // Only used when surfaceless contexts are not supported.
+    bool surfaceless_;
+    bool ownsDisplay_;   // False for shared contexts, which use the other context's display.
+};
+
+/**
+ * @brief A framebuffer object with a single color renderbuffer to draw into.
+ */
+class OffscreenTarget
+{
+public:
+    OffscreenTarget();
+    ~OffscreenTarget();
+
+    /**
+     * @brief Creates the framebuffer and binds it for drawing.
+     *
+     * Requires a current context with function pointers loaded.
+     *
+     * @param width width of the color attachment in pixels
+     * @param height height of the color attachment in pixels
+     * @return true if the framebuffer is complete
+     */
+    bool create(int width, int height);
+
+    /**
+     * @brief Deletes the framebuffer and its attachment.
+     */
+    void destroy();
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+private:
+    OffscreenTarget(const OffscreenTarget &);            // Not copyable.
+    OffscreenTarget &operator=(const OffscreenTarget &); // Not copyable.
+
+    unsigned int framebuffer_;
+    unsigned int colorBuffer_;
+    int width_;
+    int height_;
+};
+
+#endif // HEADLESS_H
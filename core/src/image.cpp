@@ -0,0 +1,191 @@
+/**
+ * @file image.cpp
+ * @brief Reading back rendered frames and comparing them with reference images.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "image.h"
+
+#include <glad/glad.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+void readFramebuffer(int width, int height, Image &image)
+{
+    image.width = width;
+    image.height = height;
+    image.pixels.resize((std::size_t)width * height * 3);
+    if (image.pixels.empty())
+    {
+        return;
+    }
+
+    // Rows of three bytes are not 4-byte aligned for every width.
+    //
+    std::vector<unsigned char> rows(image.pixels.size());
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, &rows[0]);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    const std::size_t rowBytes = (std::size_t)width * 3;
+    for (int row = 0; row < height; ++row)
+    {
+        std::memcpy(&image.pixels[(std::size_t)row * rowBytes], &rows[(std::size_t)(height - 1 - row) * rowBytes],
+                    rowBytes);
+    }
+}
+
+std::uint64_t hashFramebuffer()
+{
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    std::vector<unsigned char> pixels((std::size_t)viewport[2] * (std::size_t)viewport[3] * 4);
+    if (pixels.empty())
+    {
+        return 0;
+    }
+    glReadPixels(viewport[0], viewport[1], viewport[2], viewport[3], GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+    {
+        hash = (hash ^ pixels[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+bool captureFramebuffer(const char *path, int width, int height)
+{
+    Image image;
+    readFramebuffer(width, height, image);
+    return writePpm(path, image);
+}
+
+bool writePpm(const char *path, const Image &image)
+{
+    std::FILE *file = std::fopen(path, "wb");
+    if (file == NULL)
+    {
+        std::cout << "ERROR::IMAGE::FILE_NOT_WRITTEN " << path << std::endl;
+        return false;
+    }
+    std::fprintf(file, "P6\n%d %d\n255\n", image.width, image.height);
+    const bool written = image.pixels.empty() ||
+                         std::fwrite(&image.pixels[0], 1, image.pixels.size(), file) == image.pixels.size();
+    if (std::fclose(file) != 0 || !written)
+    {
+        std::cout << "ERROR::IMAGE::FILE_NOT_WRITTEN " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a number from a PPM header, skipping whitespace and comments before it.
+ */
+static bool readPpmNumber(std::FILE *file, int &value)
+{
+    int c = std::fgetc(file);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\n' || c == '\r')
+    {
+        if (c == '#')
+        {
+            while (c != '\n' && c != EOF)
+            {
+                c = std::fgetc(file);
+            }
+        }
+        c = std::fgetc(file);
+    }
+    if (c < '0' || c > '9')
+    {
+        return false;
+    }
+    value = 0;
+    while (c >= '0' && c <= '9')
+    {
+        if (value > 100000)
+        {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+        c = std::fgetc(file);
+    }
+
+    // A single whitespace character ends the number; after the last number
+    // it is also where the pixels start.
+    //
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool readPpm(const char *path, Image &image)
+{
+    std::FILE *file = std::fopen(path, "rb");
+    if (file == NULL)
+    {
+        std::cout << "ERROR::IMAGE::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+        return false;
+    }
+
+    int maxValue = 0;
+    const bool header = std::fgetc(file) == 'P' && std::fgetc(file) == '6' && readPpmNumber(file, image.width) &&
+                        readPpmNumber(file, image.height) && readPpmNumber(file, maxValue) && maxValue == 255;
+    bool read = false;
+    if (header)
+    {
+        image.pixels.resize((std::size_t)image.width * image.height * 3);
+        read = image.pixels.empty() ||
+               std::fread(&image.pixels[0], 1, image.pixels.size(), file) == image.pixels.size();
+    }
+    std::fclose(file);
+
+    if (!read)
+    {
+        std::cout << "ERROR::IMAGE::NOT_AN_8_BIT_PPM " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool compareImages(const Image &expected, const Image &actual, int tolerance, ImageDifference &difference,
+                   Image *diff)
+{
+    difference.differing = 0;
+    difference.largest = 0;
+    if (expected.width != actual.width || expected.height != actual.height ||
+        expected.pixels.size() != actual.pixels.size())
+    {
+        return false;
+    }
+
+    if (diff != NULL)
+    {
+        *diff = expected;
+    }
+    for (std::size_t pixel = 0; pixel < expected.pixels.size(); pixel += 3)
+    {
+        int largest = 0;
+        for (std::size_t channel = pixel; channel < pixel + 3; ++channel)
+        {
+            const int channelDifference = std::abs((int)expected.pixels[channel] - (int)actual.pixels[channel]);
+            largest = channelDifference > largest ? channelDifference : largest;
+        }
+        difference.largest = largest > difference.largest ? largest : difference.largest;
+
+        const bool differs = largest > tolerance;
+        difference.differing += differs ? 1 : 0;
+        if (diff != NULL)
+        {
+            unsigned char *out = &diff->pixels[pixel];
+            out[0] = differs ? 255 : (unsigned char)(out[0] / 4);
+            out[1] = differs ? 0 : (unsigned char)(out[1] / 4);
+            out[2] = differs ? 0 : (unsigned char)(out[2] / 4);
+        }
+    }
+    return true;
+}
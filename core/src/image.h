@@ -0,0 +1,111 @@
+/**
+ * @file image.h
+ * @brief Reading back rendered frames and comparing them with reference images.
+ *
+ * Images are stored as binary PPM (P6), which needs no library to read or
+ * write and opens in most image viewers.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief An 8-bit RGB image, rows from the top down.
+ */
+struct Image
+{
+    int width;                         //!< Width in pixels.
+    int height;                        //!< Height in pixels.
+    std::vector<unsigned char> pixels; //!< Red, green and blue of each pixel, row by row.
+};
+
+/**
+ * @brief How far an image is from the one it is compared with.
+ */
+struct ImageDifference
+{
+    unsigned long differing; //!< Pixels with a channel further off than the tolerance.
+    int largest;             //!< Largest difference of any channel.
+};
+
+/**
+ * @brief Reads the color buffer of the bound framebuffer.
+ *
+ * Waits for rendering to finish. GL's rows go from the bottom up, so they are
+ * flipped.
+ *
+ * @param width width of the area to read, from the left
+ * @param height height of the area to read, from the bottom
+ * @param image receives the pixels
+ */
+void readFramebuffer(int width, int height, Image &image);
+
+/**
+ * @brief Hashes the pixels of the viewport in the bound framebuffer, to tell whether two frames look the same.
+ *
+ * Waits for rendering to finish. Equal frames give equal hashes; a frame
+ * that differs in any bit of any pixel almost surely does not.
+ *
+ * @return FNV-1a hash of the RGBA pixels
+ */
+std::uint64_t hashFramebuffer();
+
+/**
+ * @brief Reads the color buffer of the bound framebuffer and writes it as a binary PPM file.
+ *
+ * An error is printed if the file cannot be written.
+ *
+ * @param path path of the file
+ * @param width width of the area to read, from the left
+ * @param height height of the area to read, from the bottom
+ * @return true if the file was written
+ */
+bool captureFramebuffer(const char *path, int width, int height);
+
+/**
+ * @brief Writes an image as a binary PPM file.
+ *
+ * An error is printed if the file cannot be written.
+ *
+ * @param path path of the file
+ * @param image the image
+ * @return true if the file was written
+ */
+bool writePpm(const char *path, const Image &image);
+
+/**
+ * @brief Reads a binary PPM file with 8-bit channels.
+ *
+ * An error is printed if the file cannot be read or is not such a file.
+ *
+ * @param path path of the file
+ * @param image receives the image
+ * @return true if the file was read
+ */
+bool readPpm(const char *path, Image &image);
+
+/**
+ * @brief Compares two images of the same size pixel by pixel.
+ *
+ * A pixel differs when any of its channels is more than the tolerance off,
+ * which lets small rounding differences between drivers through.
+ *
+ * @param expected the reference image
+ * @param actual the image to check
+ * @param tolerance largest difference of a channel, 0 to 255, that still counts as equal
+ * @param difference receives how far the images are apart
+ * @param diff receives the differing pixels in red over a dimmed copy of
+ *             expected, or NULL
+ * @return false if the images are not the same size
+ */
+bool compareImages(const Image &expected, const Image &actual, int tolerance, ImageDifference &difference,
+                   Image *diff);
+
+#endif // IMAGE_H
@@ -0,0 +1,194 @@
+/**
+ * @file profiler.cpp
+ * @brief Zones and markers in the code, recorded as a Chrome trace in builds made with PROFILING.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifdef PROFILING
+
+#include "profiler.h"
+
+#include "trace_buffer.h"
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+const std::size_t CHUNK_EVENTS = 8192;    //!< Events per buffer chunk.
+const std::size_t MAX_THREAD_CHUNKS = 64; //!< Chunks a thread fills before it drops events.
+
+/**
+ * @brief A zone, or a marker if it has no duration.
+ */
+struct ProfileEvent
+{
+    const char *name;
+    std::uint64_t begin; // Nanoseconds on the steady clock.
+    std::uint64_t end;   // Same as begin for markers.
+    bool marker;
+};
+
+/**
+ * @brief Everything one thread recorded.
+ */
+struct ThreadProfile
+{
+    int index;                      // Order in which threads first recorded.
+    std::atomic<const char *> name; // From PROFILE_THREAD, or NULL.
+    TraceEventBuffer<ProfileEvent, CHUNK_EVENTS, MAX_THREAD_CHUNKS> events;
+    ThreadProfile *next;
+};
+
+typedef TraceThreads<ThreadProfile> ProfileThreads; //!< Every thread that recorded.
+
+std::atomic<bool> profilerRecording(false);
+
+std::uint64_t profileNow()
+{
+    return traceNow();
+}
+
+/**
+ * @brief The calling thread's buffer, which it gets and adds to the list on its first call.
+ */
+static ThreadProfile *thisThread()
+{
+    ThreadProfile *thread = ProfileThreads::current();
+    if (thread != NULL)
+    {
+        return thread;
+    }
+
+    thread = new ThreadProfile;
+    thread->name.store(NULL);
+    return ProfileThreads::join(thread);
+}
+
+/**
+ * @brief Appends an event to the calling thread's buffer.
+ */
+static void record(const char *name, std::uint64_t begin, std::uint64_t end, bool marker)
+{
+    ProfileEvent event;
+    event.name = name;
+    event.begin = begin;
+    event.end = end;
+    event.marker = marker;
+    thisThread()->events.add(event);
+}
+
+void profilerStart()
+{
+    ProfileThreads::start();
+    profilerRecording.store(true, std::memory_order_release);
+}
+
+void profileZone(const char *name, std::uint64_t begin, std::uint64_t end)
+{
+    record(name, begin, end, false);
+}
+
+void profileMarker(const char *name)
+{
+    if (profilerRecording.load(std::memory_order_relaxed))
+    {
+        const std::uint64_t now = profileNow();
+        record(name, now, now, true);
+    }
+}
+
+void profileThread(const char *name)
+{
+    thisThread()->name.store(name, std::memory_order_relaxed);
+}
+
+bool profilerWrite(const char *path)
+{
+    ChromeTraceWriter writer;
+    if (!writer.open(path, ProfileThreads::epoch()))
+    {
+        std::cout << "ERROR::PROFILER::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+
+    for (const ThreadProfile *thread = ProfileThreads::first(); thread != NULL; thread = thread->next)
+    {
+        const char *name = thread->name.load(std::memory_order_relaxed);
+        const std::string rowName = name != NULL ? std::string(name) : "thread " + std::to_string(thread->index);
+        writer.threadName(thread->index, rowName.c_str());
+
+        thread->events.forEach(
+            [&writer, thread](const ProfileEvent &event)
+            {
+                if (event.marker)
+                {
+                    writer.beginMarker(event.name, "zone", thread->index, event.begin);
+                }
+                else
+                {
+                    writer.beginEvent(event.name, "zone", thread->index, event.begin, event.end - event.begin);
+                }
+                writer.endEvent();
+            });
+    }
+
+    if (!writer.close())
+    {
+        std::cout << "ERROR::PROFILER::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void profilerReport(std::ostream &out)
+{
+    // Sum every thread's zones by name; zones of the same name on different
+    // threads are one line.
+    //
+    struct ZoneTotal
+    {
+        std::uint64_t count;
+        std::uint64_t ns;
+    };
+    std::map<std::string, ZoneTotal> zones;
+    std::uint64_t dropped = 0;
+    for (const ThreadProfile *thread = ProfileThreads::first(); thread != NULL; thread = thread->next)
+    {
+        dropped += thread->events.dropped();
+        thread->events.forEach(
+            [&zones](const ProfileEvent &event)
+            {
+                if (!event.marker)
+                {
+                    ZoneTotal &total = zones.insert(std::make_pair(std::string(event.name), ZoneTotal())).first->second;
+                    ++total.count;
+                    total.ns += event.end - event.begin;
+                }
+            });
+    }
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Profile: zones by name" << std::fixed << std::endl;
+    for (std::map<std::string, ZoneTotal>::const_iterator zone = zones.begin(); zone != zones.end(); ++zone)
+    {
+        out << "  " << std::left << std::setw(16) << zone->first << std::right << std::setw(9) << zone->second.count
+            << " x  total " << std::setprecision(3) << std::setw(10) << (double)zone->second.ns / 1.0e6
+            << " ms  mean " << std::setw(9) << (double)zone->second.ns / 1.0e3 / (double)zone->second.count << " us"
+            << std::endl;
+    }
+    if (dropped > 0)
+    {
+        out << "  " << dropped << " events dropped after the buffers filled" << std::endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+#endif // PROFILING
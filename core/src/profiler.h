@@ -0,0 +1,148 @@
+/**
+ * @file profiler.h
+ * @brief Zones and markers in the code, recorded as a Chrome trace in builds made with PROFILING.
+ *
+ * PROFILE_ZONE("name") times the rest of the enclosing scope, and
+ * PROFILE_MARKER("name") records a point in time. Names must be string
+ * literals, or otherwise live until the trace is written; only the pointer is
+ * kept. Zones nest, and each thread records into a buffer of its own, so
+ * nothing is shared between threads on that path except a list of the
+ * buffers, which a thread joins without a lock on its first zone.
+ *
+ * Nothing is recorded until profilerStart() is called; until then a zone
+ * costs a load of a flag and a branch, so release builds keep the zones in.
+ * profilerWrite() dumps everything as Chrome trace JSON, to open in
+ * chrome://tracing or Perfetto, one row per thread.
+ *
+ * Without PROFILING the macros expand to nothing and the functions are empty.
+ * The meson option enable-profiling, on by default, defines it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <ostream>
+
+#ifdef PROFILING
+
+#include <atomic>
+#include <cstdint>
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+/**
+ * @brief Times the rest of the enclosing scope as a zone with the given name.
+ */
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+/**
+ * @brief Records a point in time with the given name.
+ */
+#define PROFILE_MARKER(name) profileMarker(name)
+
+/**
+ * @brief Names the calling thread's row in the trace.
+ */
+#define PROFILE_THREAD(name) profileThread(name)
+
+extern std::atomic<bool> profilerRecording; //!< Set by profilerStart(); zones record nothing until then.
+
+/**
+ * @brief Starts recording zones and markers.
+ */
+void profilerStart();
+
+/**
+ * @brief Writes the zones and markers recorded so far as Chrome trace JSON.
+ *
+ * Other threads may keep recording; whatever they record after the events
+ * written is left out.
+ *
+ * @param path file to write
+ * @return false if the file could not be written
+ */
+bool profilerWrite(const char *path);
+
+/**
+ * @brief Reports each zone with its count and its total and mean time.
+ *
+ * @param out stream to write the report to
+ */
+void profilerReport(std::ostream &out);
+
+/**
+ * @brief Records a point in time on the calling thread.
+ *
+ * @param name name of the marker
+ */
+void profileMarker(const char *name);
+
+/**
+ * @brief Names the calling thread's row in the trace.
+ *
+ * @param name name of the thread
+ */
+void profileThread(const char *name);
+
+/**
+ * @brief Nanoseconds on the steady clock.
+ */
+std::uint64_t profileNow();
+
+/**
+ * @brief Records a zone on the calling thread.
+ *
+ * @param name name of the zone
+ * @param begin when it began, from profileNow()
+ * @param end when it ended, from profileNow()
+ */
+void profileZone(const char *name, std::uint64_t begin, std::uint64_t end);
+
+/**
+ * @brief Times its own lifetime as a zone, if recording when it was created.
+ *
+ * Use through PROFILE_ZONE.
+ */
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char *name)
+        : name_(profilerRecording.load(std::memory_order_relaxed) ? name : NULL),
+          begin_(name_ != NULL ? profileNow() : 0)
+    {
+    }
+
+    ~ProfileZone()
+    {
+        if (name_ != NULL)
+        {
+            profileZone(name_, begin_, profileNow());
+        }
+    }
+
+private:
+    ProfileZone(const ProfileZone &);            // Not copyable.
+    ProfileZone &operator=(const ProfileZone &); // Not copyable.
+
+    const char *name_;    // NULL if not recording.
+    std::uint64_t begin_;
+};
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_MARKER(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+
+inline void profilerStart() {}
+inline bool profilerWrite(const char *) { return false; }
+inline void profilerReport(std::ostream &) {}
+
+#endif // PROFILING
+
+#endif // PROFILER_H
@@ -0,0 +1,164 @@
+/**
+ * @file shader.cpp
+ * @brief Compiling and linking shader programs from source.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "shader.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @brief Hands a shader its source with the defines placed after the #version line.
+ *
+ * #version has to come first, so the source is passed as three strings rather
+ * than copied into one.
+ *
+ * @param shader the shader to set the source of
+ * @param source the shader source
+ * @param defines preprocessor lines to insert, may be empty
+ */
+static void setShaderSource(unsigned int shader, const char *source, const char *defines)
+{
+    const char *versionEnd = NULL;
+    if (*defines != '\0' && std::strncmp(source, "#version", 8) == 0)
+    {
+        versionEnd = std::strchr(source, '\n');
+    }
+    if (versionEnd == NULL)
+    {
+        const char *strings[] = {defines, source};
+        glShaderSource(shader, 2, strings, NULL);
+        return;
+    }
+
+    const char *strings[] = {source, defines, versionEnd + 1};
+    const GLint lengths[] = {(GLint)(versionEnd + 1 - source), -1, -1};
+    glShaderSource(shader, 3, strings, lengths);
+}
+
+bool readShaderFile(const std::string &path, std::string &source)
+{
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    if (!file.good())
+    {
+        std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+        return false;
+    }
+    source = contents.str();
+    return true;
+}
+
+void enableParallelShaderCompile()
+{
+    if (GLAD_GL_KHR_parallel_shader_compile)
+    {
+        // 0xFFFFFFFF leaves the number of threads up to the driver.
+        //
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+    }
+}
+
+PendingProgram startShaderProgram(const char *vertexShaderSource, const char *fragmentShaderSource,
+                                  const char *defines, bool retrievable)
+{
+    // Shaders are compiled and linked together into a kind of shader program,
+    // then used by OpenGL.
+    //
+    // Compile the vertex shader.
+    //
+    PendingProgram pending;
+    pending.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    setShaderSource(pending.vertexShader, vertexShaderSource, defines);
+    glCompileShader(pending.vertexShader);
+
+    // Compile the fragment shader.
+    //
+    pending.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    setShaderSource(pending.fragmentShader, fragmentShaderSource, defines);
+    glCompileShader(pending.fragmentShader);
+
+    // Link them into a shader program right away. The link waits for the
+    // compiles inside the driver, not here, and fails if either one failed.
+    //
+    pending.program = glCreateProgram();
+    glAttachShader(pending.program, pending.vertexShader);
+    glAttachShader(pending.program, pending.fragmentShader);
+    if (retrievable)
+    {
+        glProgramParameteri(pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(pending.program);
+
+    return pending;
+}
+
+bool isShaderProgramReady(const PendingProgram &pending)
+{
+    if (!GLAD_GL_KHR_parallel_shader_compile)
+    {
+        return true;
+    }
+
+    int complete = GL_FALSE;
+    glGetProgramiv(pending.program, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete != GL_FALSE;
+}
+
+unsigned int finishShaderProgram(PendingProgram &pending)
+{
+    // Ensure vertex shader compiled successfully.
+    //
+    int successful;
+    char infolog[512];
+    glGetShaderiv(pending.vertexShader, GL_COMPILE_STATUS, &successful);
+    if (!successful)
+    {
+        glGetShaderInfoLog(pending.vertexShader, 512, NULL, infolog);
+        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
+                  << infolog << std::endl;
+    }
+
+    // Ensure fragment shader compiled successfully.
+    //
+    glGetShaderiv(pending.fragmentShader, GL_COMPILE_STATUS, &successful);
+    if (!successful)
+    {
+        glGetShaderInfoLog(pending.fragmentShader, 512, NULL, infolog);
+        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
+                  << infolog << std::endl;
+    }
+
+    // Ensure the shader program built successfully.
+    //
+    glGetProgramiv(pending.program, GL_LINK_STATUS, &successful);
+    if (!successful)
+    {
+        glGetProgramInfoLog(pending.program, 512, NULL, infolog);
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
+                  << infolog << std::endl;
+    }
+
+    // Clean up - source objects are no longer needed.
+    glDeleteShader(pending.vertexShader);
+    glDeleteShader(pending.fragmentShader);
+    pending.vertexShader = 0;
+    pending.fragmentShader = 0;
+
+    return pending.program;
+}
+
+unsigned int buildShaderProgram(const char *vertexShaderSource, const char *fragmentShaderSource,
+                                const char *defines, bool retrievable)
+{
+    PendingProgram pending = startShaderProgram(vertexShaderSource, fragmentShaderSource, defines, retrievable);
+    return finishShaderProgram(pending);
+}
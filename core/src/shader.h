@@ -0,0 +1,100 @@
+/**
+ * @file shader.h
+ * @brief Compiling and linking shader programs from source.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+
+#include <string>
+
+/**
+ * @brief Reads a shader source file.
+ *
+ * An error is printed if the file cannot be read.
+ *
+ * @param path path of the file
+ * @param source receives the contents of the file
+ * @return true if the file was read
+ */
+bool readShaderFile(const std::string &path, std::string &source);
+
+/**
+ * @brief A program whose shaders have been compiled and linked but not yet checked.
+ */
+struct PendingProgram
+{
+    unsigned int program;        //!< The program being linked.
+    unsigned int vertexShader;   //!< Vertex shader, deleted once the program is finished.
+    unsigned int fragmentShader; //!< Fragment shader, deleted once the program is finished.
+};
+
+/**
+ * @brief Asks the driver to compile shaders on as many threads as it likes.
+ *
+ * Does nothing without GL_KHR_parallel_shader_compile. Without it, or before it
+ * is called, drivers may still compile on the calling thread.
+ */
+void enableParallelShaderCompile();
+
+/**
+ * @brief Issues the compiles and the link of a program without waiting for them.
+ *
+ * Querying a compile or link status makes the driver finish the work first,
+ * so nothing is queried here. Issue every program up front, then poll them
+ * with isShaderProgramReady() and collect them with finishShaderProgram().
+ *
+ * @param vertexShaderSource source of the vertex shader
+ * @param fragmentShaderSource source of the fragment shader
+ * @param defines preprocessor lines inserted after the #version line of both shaders
+ * @param retrievable ask the driver to keep the linked binary for glGetProgramBinary;
+ *                    needs GL_ARB_get_program_binary
+ * @return the program and its shaders
+ */
+PendingProgram startShaderProgram(const char *vertexShaderSource, const char *fragmentShaderSource,
+                                  const char *defines = "", bool retrievable = false);
+
+/**
+ * @brief Checks, without blocking, whether the driver has finished a program.
+ *
+ * Uses GL_COMPLETION_STATUS_KHR. Without GL_KHR_parallel_shader_compile there
+ * is no way to ask, so the program is always reported ready.
+ *
+ * @param pending the program to check
+ * @return true if finishShaderProgram() will not wait
+ */
+bool isShaderProgramReady(const PendingProgram &pending);
+
+/**
+ * @brief Checks the compiles and the link and deletes the shaders.
+ *
+ * Waits for the driver if the program is not ready yet. Compile and link
+ * errors are printed along with the info log.
+ *
+ * @param pending the program to finish; its shaders are cleared
+ * @return the shader program
+ */
+unsigned int finishShaderProgram(PendingProgram &pending);
+
+/**
+ * @brief Compiles and links a vertex and a fragment shader into a program.
+ *
+ * Compile and link errors are printed along with the info log.
+ *
+ * @param vertexShaderSource source of the vertex shader
+ * @param fragmentShaderSource source of the fragment shader
+ * @param defines preprocessor lines inserted after the #version line of both shaders
+ * @param retrievable ask the driver to keep the linked binary for glGetProgramBinary;
+ *                    needs GL_ARB_get_program_binary
+ * @return the shader program
+ */
+unsigned int buildShaderProgram(const char *vertexShaderSource, const char *fragmentShaderSource,
+                                const char *defines = "", bool retrievable = false);
+
+#endif // SHADER_H
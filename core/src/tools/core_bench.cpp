@@ -0,0 +1,594 @@
+/**
+ * @file core_bench.cpp
+ * @brief Times the hot path the examples share through the core library.
+ *
+ * Runs headless, so it needs EGL but no display. The suite, from micro to
+ * macro benchmarks:
+ *
+ * - startup.*: creating a context, loading GL and drawing the first frame,
+ *   each phase timed over a few fresh contexts
+ * - shader.compile: building a shader program, as the examples do
+ * - buffer.*: uploading a vertex buffer into a new buffer, into an orphaned
+ *   one with glBufferSubData, and through an invalidating map
+ * - draw.submit: submitting a draw call per triangle, without waiting
+ * - frame.*: the frame loop with the scene of each example: clearing only, as
+ *   example-first-project does, drawing a triangle, as example-hello-triangle
+ *   does by default, and drawing two instanced triangles, as the 5.8 exercise
+ *   does
+ *
+ * Each frame goes through beginFrame() and the state cache, as in the
+ * examples, and is waited for with glFinish, which stands in for the swap,
+ * so the driver's work is counted.
+ *
+ * The suite runs several rounds, and each benchmark is summarized over them.
+ * With --json the results are written out, and with --baseline they are
+ * compared with those of an earlier run; see benchmark.h. The exit status is
+ * then a failure if any benchmark got slower. `make bench-baseline` and
+ * `make bench` run it that way.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "benchmark.h"
+#include "frame_loop.h"
+#include "frame_stats.h"
+#include "geometry.h"
+#include "gl_loader.h"
+#include "gl_state_cache.h"
+#include "headless.h"
+#include "shader.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+const int TARGET_WIDTH = 800;                          //!< Width of the render target, that of the examples' windows.
+const int TARGET_HEIGHT = 600;                         //!< Height of the render target.
+const unsigned long WARMUP_FRAMES = 10;                //!< Frames drawn before timing each scene.
+const unsigned long STARTUP_RUNS = 10;                 //!< Contexts created to time the startup phases.
+const std::size_t UPLOAD_TRIANGLES = 10000;            //!< Triangles in each timed buffer upload.
+const std::size_t DRAW_CALLS = 1000;                   //!< Draw calls submitted in each timed frame.
+const float CLEAR_COLOR[4] = {0.2f, 0.3f, 0.3f, 1.0f}; //!< Color the scenes clear to.
+
+/**
+ * @brief Vertex shader of the 5.8 exercise; each instance is moved by its own offset.
+ *
+ * Without an instance buffer the offset attribute is 0, which draws the triangle where it is.
+ */
+const char *VERTEX_SHADER_SOURCE = "#version 330 core\n"
+                                   "layout (location = 0) in vec3 aPos;\n"
+                                   "layout (location = 1) in vec2 aOffset;\n"
+                                   "void main()\n"
+                                   "{\n"
+                                   "  gl_Position = vec4(aPos.x + aOffset.x, aPos.y + aOffset.y, aPos.z, 1.0);\n"
+                                   "}\n";
+
+/**
+ * @brief Fragment shader of the examples; always outputs an orange-ish color.
+ */
+const char *FRAGMENT_SHADER_SOURCE = "#version 330 core\n"
+                                     "out vec4 FragColor;\n"
+                                     "void main()\n"
+                                     "{\n"
+                                     "  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+                                     "}\n";
+
+/**
+ * @brief Milliseconds since a point in time.
+ */
+static double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Shader source with a define after its version line that makes it unique.
+ *
+ * @param source Shader source starting with a #version line.
+ * @param run    Number written into the define.
+ */
+static std::string uniqueShaderSource(const char *source, unsigned long long run)
+{
+    const char *body = std::strchr(source, '\n');
+    body = body ? body + 1 : source;
+
+    std::ostringstream unique;
+    unique.write(source, body - source);
+    unique << "#define CORE_BENCH_RUN " << run << "\n" << body;
+    return unique.str();
+}
+
+/**
+ * @brief Prints the command line usage.
+ *
+ * @param program name the program was invoked with
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "usage: " << program << " [--frames N] [--runs N] [--rounds N] [--json FILE] [--baseline FILE]\n"
+              << "  --frames N       frames to time with the scene of each example (default 500)\n"
+              << "  --runs N         shader builds, buffer uploads and draw submissions to time (default 50)\n"
+              << "  --rounds N       times to run the whole suite (default 5)\n"
+              << "  --json FILE      write the results to FILE as JSON\n"
+              << "  --baseline FILE  compare the results with those of an earlier --json run, and fail\n"
+              << "                   if any benchmark got slower" << std::endl;
+}
+
+/**
+ * @brief Parses a positive count from the command line.
+ */
+static bool parseCount(const char *text, unsigned long &value)
+{
+    char *end;
+    value = std::strtoul(text, &end, 10);
+    return *end == '\0' && value > 0 && value <= 1000000;
+}
+
+/**
+ * @brief Reports the times of a benchmark and adds its result.
+ *
+ * @param name name of the benchmark
+ * @param times its samples
+ * @param results receives the result
+ * @param out stream to write the report to
+ */
+static void record(const char *name, const FrameStats &times, std::vector<BenchmarkResult> &results,
+                   std::ostream &out)
+{
+    times.report(out, name);
+    results.push_back(summarizeBenchmark(name, times));
+}
+
+/**
+ * @brief Times creating a context, loading GL and drawing the first frame, from scratch.
+ *
+ * Each run creates a fresh context, so nothing the driver caches per context
+ * is warm. The first frame builds the shader program and vertex array of a
+ * triangle and draws it, as example-hello-triangle starts.
+ *
+ * @param runs contexts to create
+ * @param results receives a result for each phase
+ * @param out stream to write the report to
+ * @return false if a context could not be created
+ */
+static bool timeStartup(unsigned long runs, std::vector<BenchmarkResult> &results, std::ostream &out)
+{
+    // clang-format off
+    const float vertices[] = {
+        -0.5f, -0.5f, 0.0f, // Left.
+         0.5f, -0.5f, 0.0f, // Right.
+         0.0f,  0.5f, 0.0f  // Top.
+    };
+    // clang-format on
+
+    FrameStats contextTimes(runs);
+    FrameStats loadTimes(runs);
+    FrameStats firstFrameTimes(runs);
+    for (unsigned long run = 0; run < runs; ++run)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        HeadlessContext context;
+        if (!context.create())
+        {
+            std::cout << "Failed to create headless context" << std::endl;
+            return false;
+        }
+        contextTimes.addSample(millisecondsSince(start));
+
+        start = std::chrono::steady_clock::now();
+        if (!loadGl((GLADloadproc)HeadlessContext::getProcAddress))
+        {
+            return false;
+        }
+        loadTimes.addSample(millisecondsSince(start));
+
+        start = std::chrono::steady_clock::now();
+        OffscreenTarget target;
+        if (!target.create(TARGET_WIDTH, TARGET_HEIGHT))
+        {
+            return false;
+        }
+        GlStateCache state;
+        state.viewport(0, 0, TARGET_WIDTH, TARGET_HEIGHT);
+        const unsigned int program = buildShaderProgram(VERTEX_SHADER_SOURCE, FRAGMENT_SHADER_SOURCE);
+        unsigned int VAO;
+        unsigned int VBO;
+        createVertexArray(state, vertices, sizeof(vertices), VAO, VBO);
+        beginFrame(state, CLEAR_COLOR);
+        state.useProgram(program);
+        state.bindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glFinish();
+        firstFrameTimes.addSample(millisecondsSince(start));
+
+        state.deleteVertexArray(VAO);
+        state.deleteBuffer(VBO);
+        state.deleteProgram(program);
+        target.destroy();
+        context.destroy();
+    }
+    record("startup.context", contextTimes, results, out);
+    record("startup.load", loadTimes, results, out);
+    record("startup.first-frame", firstFrameTimes, results, out);
+    return true;
+}
+
+/**
+ * @brief Times uploading vertices into a buffer, waited for.
+ *
+ * @param upload uploads the vertices, with the buffer bound to GL_ARRAY_BUFFER
+ * @param runs uploads to time
+ * @param name name of the benchmark
+ * @param results receives the result
+ * @param out stream to write the report to
+ */
+static void timeUpload(const std::function<void()> &upload, unsigned long runs, const char *name,
+                       std::vector<BenchmarkResult> &results, std::ostream &out)
+{
+    FrameStats times(runs);
+    for (unsigned long run = 0; run < runs; ++run)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        upload();
+        glFinish();
+        times.addSample(millisecondsSince(start));
+    }
+    record(name, times, results, out);
+}
+
+/**
+ * @brief Times frames of a scene drawn through the frame loop's beginFrame().
+ *
+ * @param state state cache to render through
+ * @param draw draws the scene after the clear; may be empty
+ * @param frames frames to time, after WARMUP_FRAMES untimed ones
+ * @param name name of the benchmark
+ * @param results receives the result
+ * @param out stream to write the report to
+ */
+static void timeScene(GlStateCache &state, const std::function<void()> &draw, unsigned long frames, const char *name,
+                      std::vector<BenchmarkResult> &results, std::ostream &out)
+{
+    FrameStats times(frames);
+    for (unsigned long frame = 0; frame < WARMUP_FRAMES + frames; ++frame)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        beginFrame(state, CLEAR_COLOR);
+        if (draw)
+        {
+            draw();
+        }
+        glFinish();
+        if (frame >= WARMUP_FRAMES)
+        {
+            times.addSample(millisecondsSince(start));
+        }
+    }
+    record(name, times, results, out);
+    out << "    state calls in the last frame: " << state.frame().issued << " issued, " << state.frame().elided
+        << " elided" << std::endl;
+}
+
+/**
+ * @brief Runs one round of the suite.
+ *
+ * @param frames frames to time with the scene of each example
+ * @param runs shader builds, buffer uploads and draw submissions to time
+ * @param results set to the result of each benchmark, always in the same order
+ * @param renderer set to the GL renderer the suite ran on
+ * @param out stream to write the reports to
+ * @return false if a context or render target could not be created
+ */
+static bool runSuite(unsigned long frames, unsigned long runs, std::vector<BenchmarkResult> &results,
+                     std::string &renderer, std::ostream &out)
+{
+    // Startup, as the examples do it apart from the window.
+    //
+    results.clear();
+    out << "startup: " << STARTUP_RUNS << " fresh contexts" << std::endl;
+    if (!timeStartup(STARTUP_RUNS, results, out))
+    {
+        return false;
+    }
+
+    HeadlessContext context;
+    if (!context.create())
+    {
+        out << "Failed to create headless context" << std::endl;
+        return false;
+    }
+    if (!loadGl((GLADloadproc)HeadlessContext::getProcAddress))
+    {
+        return false;
+    }
+    OffscreenTarget target;
+    if (!target.create(TARGET_WIDTH, TARGET_HEIGHT))
+    {
+        return false;
+    }
+    GlStateCache state;
+    state.viewport(0, 0, TARGET_WIDTH, TARGET_HEIGHT);
+    renderer = (const char *)glGetString(GL_RENDERER);
+    out << "Core: hot path shared by the examples on " << renderer << std::endl;
+
+    // Shader programs, built and checked one at a time as the examples do.
+    // Drivers keep compiled shaders in a cache on disk, keyed by their
+    // source, so every run's source is made unique, also across processes;
+    // otherwise all but the first run would time cache lookups.
+    //
+    FrameStats shaderTimes(runs);
+    const unsigned long long firstRun =
+        (unsigned long long)std::chrono::system_clock::now().time_since_epoch().count();
+    for (unsigned long run = 0; run < runs; ++run)
+    {
+        const std::string vertexSource = uniqueShaderSource(VERTEX_SHADER_SOURCE, firstRun + run);
+        const std::string fragmentSource = uniqueShaderSource(FRAGMENT_SHADER_SOURCE, firstRun + run);
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const unsigned int program = buildShaderProgram(vertexSource.c_str(), fragmentSource.c_str());
+        shaderTimes.addSample(millisecondsSince(start));
+        state.deleteProgram(program);
+    }
+    record("shader.compile", shaderTimes, results, out);
+
+    // Vertex buffers, uploaded each way and waited for: into a new buffer
+    // with its vertex array, as the examples do, and refilling one buffer by
+    // orphaning its storage or by mapping it invalidated, as streaming does.
+    //
+    std::vector<float> triangles;
+    generateTriangles(UPLOAD_TRIANGLES, triangles);
+    const std::size_t uploadBytes = triangles.size() * sizeof(float);
+    out << "buffer upload: " << runs << " uploads of " << uploadBytes / 1024 << " KiB" << std::endl;
+    timeUpload(
+        [&]()
+        {
+            unsigned int VAO;
+            unsigned int VBO;
+            createVertexArray(state, &triangles[0], uploadBytes, VAO, VBO);
+            state.deleteVertexArray(VAO);
+            state.deleteBuffer(VBO);
+        },
+        runs, "buffer.static", results, out);
+
+    unsigned int streamVBO;
+    glGenBuffers(1, &streamVBO);
+    state.bindBuffer(GL_ARRAY_BUFFER, streamVBO);
+    glBufferData(GL_ARRAY_BUFFER, uploadBytes, NULL, GL_STREAM_DRAW);
+    timeUpload(
+        [&]()
+        {
+            state.bindBuffer(GL_ARRAY_BUFFER, streamVBO);
+            glBufferData(GL_ARRAY_BUFFER, uploadBytes, NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, uploadBytes, &triangles[0]);
+        },
+        runs, "buffer.orphan", results, out);
+    timeUpload(
+        [&]()
+        {
+            state.bindBuffer(GL_ARRAY_BUFFER, streamVBO);
+            void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, uploadBytes,
+                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            if (mapped != NULL)
+            {
+                std::memcpy(mapped, &triangles[0], uploadBytes);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+            }
+        },
+        runs, "buffer.map", results, out);
+    state.bindBuffer(GL_ARRAY_BUFFER, 0);
+    state.deleteBuffer(streamVBO);
+
+    // The scene of each example.
+    //
+    // clang-format off
+    const float vertices[] = {
+        -0.45f, -0.5f, 0.0f, // Left.
+         0.45f, -0.5f, 0.0f, // Right.
+         0.0f,   0.5f, 0.0f  // Top.
+    };
+    const float offsets[] = {
+        -0.5f, 0.0f, // Left triangle.
+         0.5f, 0.0f  // Right triangle.
+    };
+    // clang-format on
+
+    const unsigned int program = buildShaderProgram(VERTEX_SHADER_SOURCE, FRAGMENT_SHADER_SOURCE);
+    unsigned int VAO;
+    unsigned int VBO;
+    createVertexArray(state, vertices, sizeof(vertices), VAO, VBO);
+    unsigned int instancedVAO;
+    unsigned int instancedVBO;
+    unsigned int instanceVBO;
+    createVertexArray(state, vertices, sizeof(vertices), instancedVAO, instancedVBO);
+    glGenBuffers(1, &instanceVBO);
+    state.bindVertexArray(instancedVAO);
+    state.bindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(offsets), offsets, GL_STATIC_DRAW);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    state.bindBuffer(GL_ARRAY_BUFFER, 0);
+    state.bindVertexArray(0);
+
+    // Draw calls, one per small triangle, timed until the last is submitted;
+    // the frame is finished outside the timing, so this is the CPU side only.
+    //
+    std::vector<float> drawTriangles;
+    generateTriangles(DRAW_CALLS, drawTriangles);
+    unsigned int drawVAO;
+    unsigned int drawVBO;
+    createVertexArray(state, &drawTriangles[0], drawTriangles.size() * sizeof(float), drawVAO, drawVBO);
+    FrameStats drawTimes(runs);
+    for (unsigned long run = 0; run < WARMUP_FRAMES + runs; ++run)
+    {
+        beginFrame(state, CLEAR_COLOR);
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        state.useProgram(program);
+        state.bindVertexArray(drawVAO);
+        for (std::size_t draw = 0; draw < DRAW_CALLS; ++draw)
+        {
+            glDrawArrays(GL_TRIANGLES, (GLint)(draw * 3), 3);
+        }
+        if (run >= WARMUP_FRAMES)
+        {
+            drawTimes.addSample(millisecondsSince(start));
+        }
+        glFinish();
+    }
+    out << "draw submission: " << runs << " frames of " << DRAW_CALLS << " draw calls" << std::endl;
+    record("draw.submit", drawTimes, results, out);
+
+    out << "frame loop: " << frames << " frames of each scene, " << TARGET_WIDTH << "x" << TARGET_HEIGHT
+              << ", waited for with glFinish" << std::endl;
+    timeScene(state, std::function<void()>(), frames, "frame.clear", results, out);
+    timeScene(state,
+              [&]()
+              {
+                  state.useProgram(program);
+                  state.bindVertexArray(VAO);
+                  glDrawArrays(GL_TRIANGLES, 0, 3);
+              },
+              frames, "frame.triangle", results, out);
+    timeScene(state,
+              [&]()
+              {
+                  state.useProgram(program);
+                  state.bindVertexArray(instancedVAO);
+                  glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 2);
+              },
+              frames, "frame.instanced", results, out);
+
+    state.deleteVertexArray(drawVAO);
+    state.deleteBuffer(drawVBO);
+    state.deleteVertexArray(VAO);
+    state.deleteBuffer(VBO);
+    state.deleteVertexArray(instancedVAO);
+    state.deleteBuffer(instancedVBO);
+    state.deleteBuffer(instanceVBO);
+    state.deleteProgram(program);
+    target.destroy();
+    context.destroy();
+    context.destroy();
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long frames = 500;
+    unsigned long runs = 50;
+    unsigned long rounds = 5;
+    const char *jsonPath = NULL;
+    const char *baselinePath = NULL;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            if (!parseCount(argv[++i], frames))
+            {
+                std::cout << "Invalid frame count: " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+        {
+            if (!parseCount(argv[++i], runs))
+            {
+                std::cout << "Invalid run count: " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+        {
+            if (!parseCount(argv[++i], rounds))
+            {
+                std::cout << "Invalid round count: " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+        {
+            baselinePath = argv[++i];
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // The whole suite, repeated so that the noise from round to round shows.
+    //
+    std::string renderer;
+    std::vector<std::vector<BenchmarkResult> > roundResults(rounds);
+    for (unsigned long round = 0; round < rounds; ++round)
+    {
+        std::cout << "round " << round + 1 << " of " << rounds << std::endl;
+        if (!runSuite(frames, runs, roundResults[round], renderer, std::cout))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    std::vector<BenchmarkResult> results;
+    combineBenchmarkRounds(roundResults, results);
+    std::cout << "median of the " << rounds << " rounds, +- MAD between rounds:" << std::fixed << std::setprecision(3)
+              << std::endl;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        std::cout << "  " << std::left << std::setw(24) << results[i].name << std::right << std::setw(9)
+                  << results[i].median << " +- " << std::setw(7) << results[i].mad << " ms" << std::endl;
+    }
+
+    // Read the baseline before writing the results, in case they are the same file.
+    //
+    std::string baselineRenderer;
+    std::vector<BenchmarkResult> baseline;
+    bool compare = false;
+    if (baselinePath != NULL)
+    {
+        if (!std::ifstream(baselinePath))
+        {
+            std::cout << "No baseline at " << baselinePath << " to compare with; record one with make bench-baseline"
+                      << std::endl;
+        }
+        else if (!readBenchmarkJson(baselinePath, baselineRenderer, baseline))
+        {
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            compare = true;
+        }
+    }
+
+    if (jsonPath != NULL && !writeBenchmarkJson(jsonPath, renderer, results))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (compare)
+    {
+        std::cout << "compared with " << baselinePath << std::endl;
+        if (baselineRenderer != renderer)
+        {
+            std::cout << "The baseline is from " << baselineRenderer << ", not " << renderer
+                      << "; differences are not only from the change" << std::endl;
+        }
+        if (compareBenchmarks(baseline, results, std::cout) > 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
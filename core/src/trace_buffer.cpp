@@ -0,0 +1,135 @@
+/**
+ * @file trace_buffer.cpp
+ * @brief Per-thread event buffers and a Chrome trace JSON writer, shared by the profiler and the GL trace.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "trace_buffer.h"
+
+#include <chrono>
+
+std::uint64_t traceNow()
+{
+    return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ChromeTraceWriter::ChromeTraceWriter() : file_(NULL), epoch_(0), firstEntry_(true), firstArg_(true)
+{
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+    if (file_ != NULL)
+    {
+        std::fclose(file_);
+    }
+}
+
+bool ChromeTraceWriter::open(const char *path, std::uint64_t epoch)
+{
+    file_ = std::fopen(path, "w");
+    if (file_ == NULL)
+    {
+        return false;
+    }
+    epoch_ = epoch;
+    firstEntry_ = true;
+    std::fprintf(file_, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    return true;
+}
+
+void ChromeTraceWriter::threadName(int tid, const char *name)
+{
+    beginEntry();
+    std::fprintf(file_, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", tid);
+    writeString(name);
+    std::fprintf(file_, "}}");
+}
+
+void ChromeTraceWriter::beginEvent(const char *name, const char *category, int tid, std::uint64_t begin,
+                                   std::uint64_t duration)
+{
+    beginEntry();
+    std::fprintf(file_, "{\"name\":");
+    writeString(name);
+    std::fprintf(file_, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":", category, tid);
+    writeMicroseconds(begin > epoch_ ? begin - epoch_ : 0);
+    std::fprintf(file_, ",\"dur\":");
+    writeMicroseconds(duration);
+    firstArg_ = true;
+}
+
+void ChromeTraceWriter::beginMarker(const char *name, const char *category, int tid, std::uint64_t at)
+{
+    beginEntry();
+    std::fprintf(file_, "{\"name\":");
+    writeString(name);
+    std::fprintf(file_, ",\"cat\":\"%s\",\"ph\":\"i\",\"pid\":1,\"tid\":%d,\"ts\":", category, tid);
+    writeMicroseconds(at > epoch_ ? at - epoch_ : 0);
+    std::fprintf(file_, ",\"s\":\"t\"");
+    firstArg_ = true;
+}
+
+void ChromeTraceWriter::arg(const char *name, long long value)
+{
+    std::fprintf(file_, firstArg_ ? ",\"args\":{" : ",");
+    writeString(name);
+    std::fprintf(file_, ":%lld", value);
+    firstArg_ = false;
+}
+
+void ChromeTraceWriter::argMicroseconds(const char *name, std::uint64_t ns)
+{
+    std::fprintf(file_, firstArg_ ? ",\"args\":{" : ",");
+    writeString(name);
+    std::fputc(':', file_);
+    writeMicroseconds(ns);
+    firstArg_ = false;
+}
+
+void ChromeTraceWriter::endEvent()
+{
+    std::fprintf(file_, firstArg_ ? "}" : "}}");
+}
+
+bool ChromeTraceWriter::close()
+{
+    std::fprintf(file_, "\n]}\n");
+    const bool written = std::ferror(file_) == 0;
+    const bool closed = std::fclose(file_) == 0;
+    file_ = NULL;
+    return written && closed;
+}
+
+void ChromeTraceWriter::beginEntry()
+{
+    std::fprintf(file_, firstEntry_ ? "\n" : ",\n");
+    firstEntry_ = false;
+}
+
+void ChromeTraceWriter::writeString(const char *text)
+{
+    std::fputc('"', file_);
+    for (const char *c = text; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            std::fputc('\\', file_);
+        }
+        if ((unsigned char)*c >= 0x20)
+        {
+            std::fputc(*c, file_);
+        }
+    }
+    std::fputc('"', file_);
+}
+
+void ChromeTraceWriter::writeMicroseconds(std::uint64_t ns)
+{
+    std::fprintf(file_, "%llu.%03llu", (unsigned long long)(ns / 1000), (unsigned long long)(ns % 1000));
+}
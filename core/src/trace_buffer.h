@@ -0,0 +1,299 @@
+/**
+ * @file trace_buffer.h
+ * @brief Per-thread event buffers and a Chrome trace JSON writer, shared by the profiler and the GL trace.
+ *
+ * Each thread that records appends to a TraceEventBuffer of its own, made of
+ * chunks that are never freed, so the owner never waits for anyone and
+ * readers on other threads can walk it while it grows. TraceThreads keeps
+ * the list of every thread's buffer, which a thread joins without a lock.
+ * ChromeTraceWriter writes events as JSON to open in chrome://tracing or
+ * Perfetto, one row per thread.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef TRACE_BUFFER_H
+#define TRACE_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Nanoseconds on the steady clock.
+ */
+std::uint64_t traceNow();
+
+/**
+ * @brief Events one thread records, in chunks of ChunkEvents, up to MaxChunks of them.
+ *
+ * Only the owning thread adds; it publishes each event by storing the new
+ * count with release ordering, so readers see whole events. Once the last
+ * chunk is full, events are only counted as dropped.
+ *
+ * @tparam Event what is recorded; copied in whole
+ * @tparam ChunkEvents events per chunk
+ * @tparam MaxChunks chunks a thread fills before it drops events
+ */
+template <typename Event, std::size_t ChunkEvents, std::size_t MaxChunks>
+class TraceEventBuffer
+{
+public:
+    TraceEventBuffer() : first_(createChunk()), last_(first_), chunks_(1), dropped_(0) {}
+
+    /**
+     * @brief Appends an event; only the owning thread may call this.
+     *
+     * @param event the event
+     * @return false if the buffer is full and the event was dropped
+     */
+    bool add(const Event &event)
+    {
+        Chunk *chunk = last_;
+        std::size_t used = chunk->used.load(std::memory_order_relaxed);
+        if (used == ChunkEvents)
+        {
+            if (chunks_ == MaxChunks)
+            {
+                dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            Chunk *next = createChunk();
+            chunk->next.store(next, std::memory_order_release);
+            last_ = next;
+            ++chunks_;
+            chunk = next;
+            used = 0;
+        }
+
+        chunk->events[used] = event;
+        chunk->used.store(used + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Calls visit with each event added so far, in order; any thread may call this.
+     */
+    template <typename Visit>
+    void forEach(Visit visit) const
+    {
+        for (const Chunk *chunk = first_; chunk != NULL; chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            const std::size_t used = chunk->used.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < used; ++i)
+            {
+                visit(chunk->events[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of events that did not fit.
+     */
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    TraceEventBuffer(const TraceEventBuffer &);            // Not copyable.
+    TraceEventBuffer &operator=(const TraceEventBuffer &); // Not copyable.
+
+    /**
+     * @brief Part of the buffer.
+     */
+    struct Chunk
+    {
+        Event events[ChunkEvents];
+        std::atomic<std::size_t> used;
+        std::atomic<Chunk *> next;
+    };
+
+    /**
+     * @brief Makes an empty chunk.
+     */
+    static Chunk *createChunk()
+    {
+        Chunk *chunk = new Chunk;
+        chunk->used.store(0, std::memory_order_relaxed);
+        chunk->next.store(NULL, std::memory_order_relaxed);
+        return chunk;
+    }
+
+    Chunk *first_;
+    Chunk *last_;                        // Only touched by the owning thread.
+    std::size_t chunks_;                 // Only touched by the owning thread.
+    std::atomic<std::uint64_t> dropped_;
+};
+
+/**
+ * @brief Every thread's record of one kind, newest first, and when recording started.
+ *
+ * Thread needs an int index and a Thread *next, which join() sets. Records
+ * are never freed, since their thread may record until the process exits.
+ *
+ * @tparam Thread what each thread records into
+ */
+template <typename Thread>
+class TraceThreads
+{
+public:
+    /**
+     * @brief Notes the time recording starts; timestamps are written relative to it.
+     */
+    static void start() { epoch_ = traceNow(); }
+
+    /**
+     * @brief When start() was called, in nanoseconds on the steady clock.
+     */
+    static std::uint64_t epoch() { return epoch_; }
+
+    /**
+     * @brief The calling thread's record, or NULL if it has not joined.
+     */
+    static Thread *current() { return current_; }
+
+    /**
+     * @brief Adds the calling thread's record to the list; call once per thread.
+     *
+     * @param thread the record, which from now on is current() on this thread
+     * @return thread
+     */
+    static Thread *join(Thread *thread)
+    {
+        thread->index = count_.fetch_add(1);
+        thread->next = first_.load();
+        while (!first_.compare_exchange_weak(thread->next, thread))
+        {
+        }
+        current_ = thread;
+        return thread;
+    }
+
+    /**
+     * @brief The newest record; follow next for the others.
+     */
+    static Thread *first() { return first_.load(); }
+
+    /**
+     * @brief Number of threads that joined.
+     */
+    static int count() { return count_.load(); }
+
+private:
+    static std::atomic<Thread *> first_;
+    static std::atomic<int> count_;
+    static thread_local Thread *current_;
+    static std::uint64_t epoch_;
+};
+
+template <typename Thread>
+std::atomic<Thread *> TraceThreads<Thread>::first_(NULL);
+
+template <typename Thread>
+std::atomic<int> TraceThreads<Thread>::count_(0);
+
+template <typename Thread>
+thread_local Thread *TraceThreads<Thread>::current_ = NULL;
+
+template <typename Thread>
+std::uint64_t TraceThreads<Thread>::epoch_ = 0;
+
+/**
+ * @brief Writes events as Chrome trace JSON, with timestamps relative to an epoch.
+ *
+ * Events are written as beginEvent() or beginMarker(), any number of arg()
+ * calls, then endEvent().
+ */
+class ChromeTraceWriter
+{
+public:
+    ChromeTraceWriter();
+    ~ChromeTraceWriter();
+
+    /**
+     * @brief Creates the file and writes the start of the JSON.
+     *
+     * @param path file to write
+     * @param epoch time, from traceNow(), that timestamps are relative to
+     * @return false if the file could not be created
+     */
+    bool open(const char *path, std::uint64_t epoch);
+
+    /**
+     * @brief Names a thread's row.
+     *
+     * @param tid the thread's index
+     * @param name its name
+     */
+    void threadName(int tid, const char *name);
+
+    /**
+     * @brief Starts an event with a duration.
+     *
+     * @param name name of the event
+     * @param category category of the event
+     * @param tid the thread's index
+     * @param begin when it began, from traceNow()
+     * @param duration its length in nanoseconds
+     */
+    void beginEvent(const char *name, const char *category, int tid, std::uint64_t begin, std::uint64_t duration);
+
+    /**
+     * @brief Starts an event for a point in time.
+     *
+     * @param name name of the marker
+     * @param category category of the marker
+     * @param tid the thread's index
+     * @param at when it happened, from traceNow()
+     */
+    void beginMarker(const char *name, const char *category, int tid, std::uint64_t at);
+
+    /**
+     * @brief Adds a whole number argument to the event.
+     */
+    void arg(const char *name, long long value);
+
+    /**
+     * @brief Adds a length of time in nanoseconds as a microseconds argument to the event.
+     */
+    void argMicroseconds(const char *name, std::uint64_t ns);
+
+    /**
+     * @brief Ends the event.
+     */
+    void endEvent();
+
+    /**
+     * @brief Writes the end of the JSON and closes the file.
+     *
+     * @return false if anything could not be written
+     */
+    bool close();
+
+private:
+    ChromeTraceWriter(const ChromeTraceWriter &);            // Not copyable.
+    ChromeTraceWriter &operator=(const ChromeTraceWriter &); // Not copyable.
+
+    /**
+     * @brief Starts the next event of the array.
+     */
+    void beginEntry();
+
+    /**
+     * @brief Writes a string as a JSON string.
+     */
+    void writeString(const char *text);
+
+    /**
+     * @brief Writes nanoseconds as the microseconds Chrome traces use.
+     */
+    void writeMicroseconds(std::uint64_t ns);
+
+    std::FILE *file_;
+    std::uint64_t epoch_;
+    bool firstEntry_;
+    bool firstArg_;
+};
+
+#endif // TRACE_BUFFER_H
@@ -0,0 +1,105 @@
+/**
+ * @file vertex_layout.cpp
+ * @brief Converting values into the packed component types of vertex layouts.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "vertex_layout.h"
+
+#include <cmath>
+#include <cstring>
+
+Half floatToHalf(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    const std::uint32_t exponent = (bits >> 23) & 0xffu;
+    std::uint32_t mantissa = bits & 0x7fffffu;
+
+    Half half;
+    if (exponent == 0xffu)
+    {
+        // Infinity stays infinity and NaN stays a quiet NaN.
+        //
+        half.bits = (std::uint16_t)(sign | 0x7c00u | (mantissa != 0 ? 0x200u : 0u));
+        return half;
+    }
+
+    // Rebias the exponent from 127 to 15.
+    //
+    const int rebiased = (int)exponent - 127 + 15;
+    if (rebiased >= 0x1f)
+    {
+        half.bits = (std::uint16_t)(sign | 0x7c00u);
+        return half;
+    }
+
+    if (rebiased <= 0)
+    {
+        // Too small for a normal half: shift the mantissa, with its implicit
+        // leading one, into a subnormal, or to zero if it is smaller still.
+        //
+        if (rebiased < -10)
+        {
+            half.bits = (std::uint16_t)sign;
+            return half;
+        }
+        mantissa |= 0x800000u;
+        const int shift = 14 - rebiased;
+        std::uint32_t result = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (result & 1u) != 0))
+        {
+            ++result;
+        }
+        half.bits = (std::uint16_t)(sign | result);
+        return half;
+    }
+
+    // Keep the top 10 bits of the mantissa and round the 13 dropped ones to
+    // nearest even. A carry out of the mantissa correctly bumps the exponent,
+    // up to infinity.
+    //
+    std::uint32_t result = ((std::uint32_t)rebiased << 10) | (mantissa >> 13);
+    const std::uint32_t remainder = mantissa & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u) != 0))
+    {
+        ++result;
+    }
+    half.bits = (std::uint16_t)(sign | result);
+    return half;
+}
+
+/**
+ * @brief Converts a value in [-1, 1] to a signed normalized integer of some bits.
+ *
+ * @param value the value; out of range values are clamped
+ * @param maximum largest value of the integer, e.g. 511 for 10 bits
+ * @param mask bits of the integer, e.g. 0x3ff for 10 bits
+ * @return the integer in two's complement, in the low bits
+ */
+static std::uint32_t packSnorm(float value, float maximum, std::uint32_t mask)
+{
+    const float clamped = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return (std::uint32_t)(std::int32_t)std::lround(clamped * maximum) & mask;
+}
+
+Packed1010102 packSnorm1010102(float x, float y, float z, float w)
+{
+    Packed1010102 packed;
+    packed.bits = packSnorm(x, 511.0f, 0x3ffu) | (packSnorm(y, 511.0f, 0x3ffu) << 10) |
+                  (packSnorm(z, 511.0f, 0x3ffu) << 20) | (packSnorm(w, 1.0f, 0x3u) << 30);
+    return packed;
+}
+
+GLubyte packUnorm8(float value)
+{
+    const float clamped = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return (GLubyte)std::lround(clamped * 255.0f);
+}
@@ -0,0 +1,237 @@
+/**
+ * @file vertex_layout.h
+ * @brief Vertex formats described as types, with strides and offsets worked out by the compiler.
+ *
+ * A layout lists its attributes in the order they appear in a vertex:
+ *
+ *     typedef VertexLayout<Attribute<0, Half, 4>,                  // Position, 8 bytes.
+ *                          Attribute<1, Packed1010102, 4, true>,   // Normal, 4 bytes.
+ *                          Attribute<2, GLubyte, 4, true> >        // Color, 4 bytes.
+ *         MeshLayout;
+ *
+ * MeshLayout::STRIDE is 16 and MeshLayout::apply() makes the matching
+ * glVertexAttribPointer calls, with every offset a compile-time constant. The
+ * same vertex as floats would take 40 bytes.
+ *
+ * Attributes are packed back to back, so a vertex struct matching a layout
+ * must not have padding; compare it against STRIDE and Offset<Index>::VALUE
+ * with static_assert. Each attribute must be a multiple of four bytes, which is
+ * what GPUs fetch efficiently.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef VERTEX_LAYOUT_H
+#define VERTEX_LAYOUT_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief A 16-bit floating point component, stored as its bits.
+ */
+struct Half
+{
+    std::uint16_t bits; //!< IEEE 754 binary16.
+};
+
+/**
+ * @brief Four signed components packed into 32 bits as 10, 10, 10 and 2 bits.
+ *
+ * The layout of GL_INT_2_10_10_10_REV, normally used normalized for normals.
+ */
+struct Packed1010102
+{
+    std::uint32_t bits; //!< x in the lowest 10 bits, w in the highest 2.
+};
+
+/**
+ * @brief GL type of a component, and whether one value holds a whole attribute.
+ */
+template <typename Component>
+struct ComponentType;
+
+template <>
+struct ComponentType<GLfloat>
+{
+    static const GLenum TYPE = GL_FLOAT;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<Half>
+{
+    static const GLenum TYPE = GL_HALF_FLOAT;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<GLbyte>
+{
+    static const GLenum TYPE = GL_BYTE;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<GLubyte>
+{
+    static const GLenum TYPE = GL_UNSIGNED_BYTE;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<GLshort>
+{
+    static const GLenum TYPE = GL_SHORT;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<GLushort>
+{
+    static const GLenum TYPE = GL_UNSIGNED_SHORT;
+    static const bool PACKED = false;
+};
+
+template <>
+struct ComponentType<Packed1010102>
+{
+    static const GLenum TYPE = GL_INT_2_10_10_10_REV;
+    static const bool PACKED = true;
+};
+
+/**
+ * @brief One vertex attribute: where it goes, what it is made of and how many.
+ *
+ * @tparam Location attribute location in the vertex shader
+ * @tparam Component type of each component, or of the whole attribute if packed
+ * @tparam Count number of components the shader sees, 1 to 4
+ * @tparam Normalized map integer components to [0, 1] or [-1, 1]
+ */
+template <GLuint Location, typename Component, GLint Count, bool Normalized = false>
+struct Attribute
+{
+    static_assert(Count >= 1 && Count <= 4, "An attribute has one to four components");
+    static_assert(!ComponentType<Component>::PACKED || Count == 4, "Packed attributes have four components");
+
+    static const GLuint LOCATION = Location;
+    static const GLint COUNT = Count;
+    static const GLenum TYPE = ComponentType<Component>::TYPE;
+    static const GLboolean NORMALIZED = Normalized ? GL_TRUE : GL_FALSE;
+    static const std::size_t SIZE = ComponentType<Component>::PACKED ? sizeof(Component) : sizeof(Component) * Count;
+
+    static_assert(SIZE % 4 == 0, "Pad attributes to a multiple of four bytes");
+};
+
+/**
+ * @brief Offset of an attribute in a vertex, i.e. the size of the ones before it.
+ *
+ * @tparam Index position of the attribute in the list
+ * @tparam Attributes the attributes of the layout
+ */
+template <std::size_t Index, typename... Attributes>
+struct AttributeOffset;
+
+template <typename First, typename... Rest>
+struct AttributeOffset<0, First, Rest...>
+{
+    static const std::size_t VALUE = 0;
+};
+
+template <std::size_t Index, typename First, typename... Rest>
+struct AttributeOffset<Index, First, Rest...>
+{
+    static const std::size_t VALUE = First::SIZE + AttributeOffset<Index - 1, Rest...>::VALUE;
+};
+
+/**
+ * @brief A vertex format made of attributes packed back to back.
+ *
+ * @tparam Attributes Attribute types, in the order they appear in a vertex
+ */
+template <typename... Attributes>
+struct VertexLayout;
+
+template <>
+struct VertexLayout<>
+{
+    static const std::size_t STRIDE = 0;
+
+    template <std::size_t Offset>
+    static void applyFrom(GLsizei, GLuint)
+    {
+    }
+};
+
+template <typename First, typename... Rest>
+struct VertexLayout<First, Rest...>
+{
+    static const std::size_t STRIDE = First::SIZE + VertexLayout<Rest...>::STRIDE; //!< Bytes per vertex.
+
+    /**
+     * @brief Offset of the attribute at Index in a vertex.
+     */
+    template <std::size_t Index>
+    struct Offset : AttributeOffset<Index, First, Rest...>
+    {
+    };
+
+    /**
+     * @brief Points the attributes at the buffer bound to GL_ARRAY_BUFFER and enables them.
+     *
+     * @param divisor 0 to advance per vertex, or the number of instances per element
+     */
+    static void apply(GLuint divisor = 0)
+    {
+        applyFrom<0>((GLsizei)STRIDE, divisor);
+    }
+
+    /**
+     * @brief Sets up the first attribute at Offset and the rest after it.
+     *
+     * @tparam Offset byte offset of the first attribute in the vertex
+     * @param stride bytes per vertex of the whole layout
+     * @param divisor 0 to advance per vertex, or the number of instances per element
+     */
+    template <std::size_t Offset>
+    static void applyFrom(GLsizei stride, GLuint divisor)
+    {
+        glVertexAttribPointer(First::LOCATION, First::COUNT, First::TYPE, First::NORMALIZED, stride, (void *)Offset);
+        glEnableVertexAttribArray(First::LOCATION);
+        glVertexAttribDivisor(First::LOCATION, divisor);
+        VertexLayout<Rest...>::template applyFrom<Offset + First::SIZE>(stride, divisor);
+    }
+};
+
+/**
+ * @brief Converts a float to a half, rounding to nearest even.
+ *
+ * @param value the float
+ * @return the half; out of range values become infinity
+ */
+Half floatToHalf(float value);
+
+/**
+ * @brief Packs a direction into GL_INT_2_10_10_10_REV, for use normalized.
+ *
+ * @param x x component in [-1, 1]
+ * @param y y component in [-1, 1]
+ * @param z z component in [-1, 1]
+ * @param w w component in [-1, 1], with only -1, 0 and 1 representable
+ * @return the packed components
+ */
+Packed1010102 packSnorm1010102(float x, float y, float z, float w = 0.0f);
+
+/**
+ * @brief Converts a value in [0, 1] to a normalized unsigned byte.
+ *
+ * @param value the value; out of range values are clamped
+ * @return the byte
+ */
+GLubyte packUnorm8(float value);
+
+#endif // VERTEX_LAYOUT_H
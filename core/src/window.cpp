@@ -0,0 +1,216 @@
+/**
+ * @file window.cpp
+ * @brief GLFW window with an OpenGL 3.3 core context, as every example opens it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "window.h"
+
+#include "gl_loader.h"
+#ifdef HAVE_EGL
+#include "headless.h"
+#endif
+
+#include <iostream>
+
+#define UNUSED(x) (void)(x) //!< Voids unused parameters to resolve unnused parameters warnings.
+
+/**
+ * @brief Handler for resizing of the viewport with resizing of the window.
+ *
+ * @param window instance of the window being resized
+ * @param width width of the window
+ * @param height height of the window
+ */
+static void framebufferSizeCallback(GLFWwindow *window, int width, int height)
+{
+    // Whenever the window size changes, change the view port size to match.
+    //
+    glViewport(0, 0, width, height);
+    UNUSED(window);
+}
+
+Window::Window()
+    : window_(NULL), context_(NULL), target_(NULL), width_(0), height_(0), ownsGlfw_(false)
+{
+}
+
+Window::~Window()
+{
+    destroy();
+}
+
+bool Window::create(int width, int height, const char *title, bool debug, bool eagerGl)
+{
+    // Init and configure glwf.
+    //
+    if (!glfwInit())
+    {
+        std::cout << "Failed to initialize GLFW" << std::endl;
+        return false;
+    }
+    ownsGlfw_ = true;
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, debug ? GLFW_TRUE : GLFW_FALSE);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+    // Create a window / context using GLFW.
+    //
+    window_ = glfwCreateWindow(width, height, title, NULL, NULL);
+    if (window_ == NULL)
+    {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        destroy();
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    glfwMakeContextCurrent(window_);
+    glfwSetFramebufferSizeCallback(window_, framebufferSizeCallback); // Set handler resizing.
+
+    // Init GLAD to get function pointers for OpenGL.
+    //
+    if (!loadGl((GLADloadproc)glfwGetProcAddress, eagerGl))
+    {
+        destroy();
+        return false;
+    }
+    return true;
+}
+
+bool Window::createHeadless(int width, int height, bool debug, bool eagerGl)
+{
+#ifdef HAVE_EGL
+    // Create an offscreen context instead of a window; no display is needed.
+    //
+    context_ = new HeadlessContext;
+    if (!context_->create(debug))
+    {
+        std::cout << "Failed to create headless context" << std::endl;
+        destroy();
+        return false;
+    }
+    if (!loadGl((GLADloadproc)HeadlessContext::getProcAddress, eagerGl))
+    {
+        destroy();
+        return false;
+    }
+
+    // Render into a framebuffer object the size the window would have been.
+    //
+    target_ = new OffscreenTarget;
+    if (!target_->create(width, height))
+    {
+        destroy();
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    return true;
+#else
+    UNUSED(width);
+    UNUSED(height);
+    UNUSED(debug);
+    UNUSED(eagerGl);
+    std::cout << "Headless mode requires EGL, which was not found at build time" << std::endl;
+    return false;
+#endif
+}
+
+bool Window::createShared(const Window &share)
+{
+#ifdef HAVE_EGL
+    if (share.context_ != NULL)
+    {
+        context_ = new HeadlessContext;
+        if (!context_->createShared(*share.context_))
+        {
+            destroy();
+            return false;
+        }
+        return true;
+    }
+#endif
+    ownsGlfw_ = false;
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    window_ = glfwCreateWindow(1, 1, "Shared context", NULL, share.window_);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+    // The context is for another thread, which must not race this one
+    // through the lazy GL trampolines.
+    //
+    return window_ != NULL && resolveGl();
+}
+
+bool Window::makeCurrent()
+{
+#ifdef HAVE_EGL
+    if (context_ != NULL)
+    {
+        return context_->makeCurrent();
+    }
+#endif
+    glfwMakeContextCurrent(window_);
+    return window_ != NULL && glfwGetCurrentContext() == window_;
+}
+
+void Window::release()
+{
+#ifdef HAVE_EGL
+    if (context_ != NULL)
+    {
+        context_->release();
+        return;
+    }
+#endif
+    glfwMakeContextCurrent(NULL);
+}
+
+GLADloadproc Window::glLoader() const
+{
+#ifdef HAVE_EGL
+    if (context_ != NULL)
+    {
+        return (GLADloadproc)HeadlessContext::getProcAddress;
+    }
+#endif
+    return (GLADloadproc)glfwGetProcAddress;
+}
+
+void Window::destroy()
+{
+#ifdef HAVE_EGL
+    if (target_ != NULL)
+    {
+        target_->destroy();
+        delete target_;
+        target_ = NULL;
+    }
+    if (context_ != NULL)
+    {
+        context_->destroy();
+        delete context_;
+        context_ = NULL;
+    }
+#endif
+    if (window_ != NULL)
+    {
+        glfwDestroyWindow(window_);
+        window_ = NULL;
+    }
+
+    // Clean up after glfw.
+    //
+    if (ownsGlfw_)
+    {
+        glfwTerminate();
+        ownsGlfw_ = false;
+    }
+}
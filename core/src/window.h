@@ -0,0 +1,121 @@
+/**
+ * @file window.h
+ * @brief GLFW window with an OpenGL 3.3 core context, as every example opens it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef WINDOW_H
+#define WINDOW_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <cstddef>
+
+class HeadlessContext;
+class OffscreenTarget;
+
+/**
+ * @brief A window and its context, with GLFW initialized for as long as it exists.
+ *
+ * Can instead stand in for a window without a display, for tests and
+ * benchmarks, by rendering offscreen through EGL.
+ */
+class Window
+{
+public:
+    Window();
+    ~Window();
+
+    /**
+     * @brief Initializes GLFW, creates the window and loads the GL functions.
+     *
+     * The context is made current on the calling thread. Resizing the window
+     * sets the viewport to match until another framebuffer size callback is set.
+     *
+     * @param width width of the window
+     * @param height height of the window
+     * @param title title of the window
+     * @param debug create a debug context, in which drivers report more through debug output
+     * @param eagerGl resolve every GL function now rather than on its first call
+     * @return true if the window was created and the functions loaded
+     */
+    bool create(int width, int height, const char *title, bool debug = false, bool eagerGl = false);
+
+    /**
+     * @brief Creates an offscreen context and a render target the size of the window, without GLFW.
+     *
+     * The context is made current on the calling thread with the target
+     * bound, and the GL functions are loaded. Needs EGL; without it an error
+     * is printed.
+     *
+     * @param width width of the render target
+     * @param height height of the render target
+     * @param debug create a debug context, in which drivers report more through debug output
+     * @param eagerGl resolve every GL function now rather than on its first call
+     * @return true if the context and target were created and the functions loaded
+     */
+    bool createHeadless(int width, int height, bool debug = false, bool eagerGl = false);
+
+    /**
+     * @brief Creates a hidden window whose context shares objects with another, without making it current.
+     *
+     * GLFW only makes contexts along with windows. If the other window is
+     * headless, so is this one, with only an offscreen context and no render
+     * target. Meant to be made current on a second thread with makeCurrent(),
+     * so every GL function still loaded lazily is resolved first, with the
+     * other window's context current. Destroy it before the window it shares
+     * with.
+     *
+     * @param share a created window
+     * @return true if the window was created and the functions resolved
+     */
+    bool createShared(const Window &share);
+
+    /**
+     * @brief Makes the context current on the calling thread.
+     *
+     * @return true if the context is now current
+     */
+    bool makeCurrent();
+
+    /**
+     * @brief Makes no context current on the calling thread.
+     */
+    void release();
+
+    /**
+     * @brief Destroys the window or offscreen context, and terminates GLFW if create() initialized it.
+     */
+    void destroy();
+
+    /**
+     * @brief Looks up GL functions in the window's context, for gladLoadGLLoader.
+     */
+    GLADloadproc glLoader() const;
+
+    /**
+     * @brief GLFW's window, or NULL if headless.
+     */
+    GLFWwindow *handle() const { return window_; }
+
+    bool headless() const { return context_ != NULL; }
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+private:
+    Window(const Window &);            // Not copyable.
+    Window &operator=(const Window &); // Not copyable.
+
+    GLFWwindow *window_;
+    HeadlessContext *context_; // Only when headless.
+    OffscreenTarget *target_;  // Only when headless.
+    int width_;
+    int height_;
+    bool ownsGlfw_;            // False for shared windows, which leave GLFW to the window they share with.
+};
+
+#endif // WINDOW_H
@@ -7,106 +7,56 @@
  *
  * @copyright Copyright (c) 2024
  */
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include "example_options.h"
+#include "frame_loop.h"
+#include "gl_state_cache.h"
+#include "window.h"
 
-#include <iostream>
 #include <cstdlib>
 
-#define UNUSED(x) (void)(x) //!< Voids unused parameters to resolve unnused parameters warnings.
-
-/**
- * @brief Handler for resizing of the viewport with resizing of the window.
- *
- * @param window instance of the window being resized
- * @param width width of the window
- * @param height height of the window
- */
-void framebufferSizeCallback(GLFWwindow *window, int width, int height);
+const unsigned int WINDOW_WIDTH = 800;  //!< Window width.
+const unsigned int WINDOW_HEIGHT = 600; //!< Window height.
 
 /**
- * @brief Handler for input to the window.
+ * @brief Color to clear the window to.
  *
- * @param window instance of the window receiving the input
+ * I changed this to a nicer color than the ugly green set in the book.
  */
-void processInput(GLFWwindow *window);
+const float CLEAR_COLOR[4] = {0.0f, 0.145f, 1.0f, 1.0f};
 
-const unsigned int WINDOW_WIDTH = 800;  //!< Window width.
-const unsigned int WINDOW_HEIGHT = 600; //!< Window height.
-
-int main()
+int main(int argc, char *argv[])
 {
-    // Init and configure glwf.
-    //
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
-
-    // Create a window / context using GLFW.
-    //
-    GLFWwindow *window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Work-Through: Learn OpenGL  |  Hello Window!", NULL, NULL);
-    if (window == NULL)
+    ExampleOptions options;
+    if (!parseExampleOptions(argc, argv, options))
     {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+        return EXIT_FAILURE;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback); // Set handler resizing.
 
-    // Init GLAD to get function pointers for OpenGL.
+    // Create a window / context using GLFW, and init GLAD to get function
+    // pointers for OpenGL. Headless, render offscreen instead.
     //
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    Window window;
+    if (!createExampleWindow(window, options, WINDOW_WIDTH, WINDOW_HEIGHT,
+                             "Work-Through: Learn OpenGL  |  Hello Window!"))
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
         return -1;
     }
 
-    // Set color for opengl to use to clear the buffer.
-    //
-    // NOTE: This was not included in the book example. Without this, the window
-    //       flickered rapidly between red and black.
-    //
-    // glClear(GL_COLOR_BUFFER_BIT);
-
     // Rendering loop.
     //
-    // An iteration of the loop is typically referred to as a frame.
+    // Nothing is drawn; each frame only clears the window.
     //
-    while (!glfwWindowShouldClose(window))
-    {
-        processInput(window);
-
-        // I changed this to a nicer color than the ugly green set in the book.
-        glClearColor(0.0f, 0.145f, 1.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // Check events, then swap the front/back buffers.
-        glfwPollEvents();
-        glfwSwapBuffers(window);
-    }
+    // NOTE: Without the clear, which was not included in the book example, the
+    //       window flickered rapidly between red and black.
+    //
+    GlStateCache state;
+    FrameStats frameTimes(0, RECENT_FRAME_SAMPLES);
+    runFrameLoop(window, state, CLEAR_COLOR, std::function<void()>(), &frameTimes, options.frames);
+    const bool passed = finishExampleRun(options, window, frameTimes);
 
     // Clean up.
     //
-    glfwTerminate();
-
-    return EXIT_SUCCESS;
-}
+    window.destroy();
 
-void processInput(GLFWwindow *window)
-{
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-    {
-        glfwSetWindowShouldClose(window, true);
-    }
-}
-
-void framebufferSizeCallback(GLFWwindow *window, int width, int height)
-{
-    glViewport(0, 0, width, height);
-    UNUSED(window);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
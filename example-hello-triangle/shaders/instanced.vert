@@ -0,0 +1,11 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aOffset;
+layout (location = 2) in vec3 aColor;
+layout (location = 3) in float aScale;
+out vec3 color;
+void main()
+{
+  gl_Position = vec4(aPos.xy * aScale + aOffset, aPos.z, 1.0);
+  color = aColor;
+}
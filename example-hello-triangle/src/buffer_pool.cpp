@@ -0,0 +1,503 @@
+/**
+ * @file buffer_pool.cpp
+ * @brief Many small meshes carved out of a few large vertex and element buffers.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "buffer_pool.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+#include "image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+const std::uint32_t BufferPool::NO_MESH;
+
+BufferPool::BufferPool(GlStateCache &state)
+    : state_(state), stride_(0), applyLayout_(NULL), arenaVertices_(0), arenaIndices_(0), scratch_(0),
+      scratchBytes_(0), compactions_(0), movedBytes_(0)
+{
+}
+
+BufferPool::~BufferPool()
+{
+    destroy();
+}
+
+bool BufferPool::create(std::size_t stride, void (*applyLayout)(GLuint), std::size_t arenaVertices,
+                        std::size_t arenaIndices)
+{
+    destroy();
+    stride_ = stride;
+    applyLayout_ = applyLayout;
+    arenaVertices_ = arenaVertices;
+    arenaIndices_ = arenaIndices;
+    return addArena(arenaVertices_, arenaIndices_);
+}
+
+void BufferPool::destroy()
+{
+    for (std::size_t i = 0; i < arenas_.size(); ++i)
+    {
+        state_.deleteVertexArray(arenas_[i]->VAO);
+        state_.deleteBuffer(arenas_[i]->VBO);
+        state_.deleteBuffer(arenas_[i]->EBO);
+        delete arenas_[i];
+    }
+    arenas_.clear();
+    meshes_.clear();
+    spareMeshes_.clear();
+    if (scratch_ != 0)
+    {
+        state_.deleteBuffer(scratch_);
+        scratch_ = 0;
+        scratchBytes_ = 0;
+    }
+}
+
+std::uint32_t BufferPool::add(const void *vertices, std::size_t vertexCount, const GLuint *indices,
+                              std::size_t indexCount)
+{
+    Mesh mesh;
+    mesh.indexCount = (GLsizei)indexCount;
+    mesh.live = true;
+
+    // First fit among the arenas, then an arena that only has room once its
+    // free space is joined up, then a new arena.
+    //
+    bool placed = false;
+    for (std::size_t a = 0; a < arenas_.size() && !placed; ++a)
+    {
+        placed = allocate(*arenas_[a], vertexCount, indexCount, mesh);
+        mesh.arena = (std::uint32_t)a;
+    }
+    for (std::size_t a = 0; a < arenas_.size() && !placed; ++a)
+    {
+        Arena &arena = *arenas_[a];
+        if (arena.vertices.capacity() - arena.vertices.used() >= vertexCount &&
+            arena.indices.capacity() - arena.indices.used() >= indexCount)
+        {
+            compact(arena);
+            placed = allocate(arena, vertexCount, indexCount, mesh);
+            mesh.arena = (std::uint32_t)a;
+        }
+    }
+    if (!placed)
+    {
+        if (!addArena(std::max(arenaVertices_, vertexCount), std::max(arenaIndices_, indexCount)))
+        {
+            return NO_MESH;
+        }
+        mesh.arena = (std::uint32_t)(arenas_.size() - 1);
+        allocate(*arenas_.back(), vertexCount, indexCount, mesh);
+    }
+
+    // Upload through the copy target, which leaves the vertex array bindings alone.
+    //
+    const Arena &arena = *arenas_[mesh.arena];
+    state_.bindBuffer(GL_COPY_WRITE_BUFFER, arena.VBO);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(arena.vertices.offset(mesh.vertexRange) * stride_),
+                    (GLsizeiptr)(vertexCount * stride_), vertices);
+    state_.bindBuffer(GL_COPY_WRITE_BUFFER, arena.EBO);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(arena.indices.offset(mesh.indexRange) * sizeof(GLuint)),
+                    (GLsizeiptr)(indexCount * sizeof(GLuint)), indices);
+
+    std::uint32_t handle;
+    if (!spareMeshes_.empty())
+    {
+        handle = spareMeshes_.back();
+        spareMeshes_.pop_back();
+        meshes_[handle] = mesh;
+    }
+    else
+    {
+        handle = (std::uint32_t)meshes_.size();
+        meshes_.push_back(mesh);
+    }
+    return handle;
+}
+
+void BufferPool::remove(std::uint32_t mesh)
+{
+    Mesh &removed = meshes_[mesh];
+    Arena &arena = *arenas_[removed.arena];
+    arena.vertices.free(removed.vertexRange);
+    arena.indices.free(removed.indexRange);
+    removed.live = false;
+    spareMeshes_.push_back(mesh);
+}
+
+void BufferPool::draw(std::uint32_t mesh)
+{
+    const Mesh &drawn = meshes_[mesh];
+    const Arena &arena = *arenas_[drawn.arena];
+    state_.bindVertexArray(arena.VAO);
+    glDrawElementsBaseVertex(GL_TRIANGLES, drawn.indexCount, GL_UNSIGNED_INT,
+                             (void *)(arena.indices.offset(drawn.indexRange) * sizeof(GLuint)),
+                             (GLint)arena.vertices.offset(drawn.vertexRange));
+}
+
+void BufferPool::defragment()
+{
+    for (std::size_t a = 0; a < arenas_.size(); ++a)
+    {
+        compact(*arenas_[a]);
+    }
+}
+
+BufferPool::Stats BufferPool::stats() const
+{
+    Stats stats;
+    stats.arenas = arenas_.size();
+    stats.meshes = meshes_.size() - spareMeshes_.size();
+    stats.usedBytes = 0;
+    stats.capacityBytes = 0;
+    stats.freeVertices = 0;
+    stats.largestFreeRange = 0;
+    for (std::size_t a = 0; a < arenas_.size(); ++a)
+    {
+        const Arena &arena = *arenas_[a];
+        stats.usedBytes += arena.vertices.used() * stride_ + arena.indices.used() * sizeof(GLuint);
+        stats.capacityBytes += arena.vertices.capacity() * stride_ + arena.indices.capacity() * sizeof(GLuint);
+        stats.freeVertices += arena.vertices.capacity() - arena.vertices.used();
+        stats.largestFreeRange = std::max(stats.largestFreeRange, arena.vertices.largestFree());
+    }
+    stats.compactions = compactions_;
+    stats.movedBytes = movedBytes_;
+    return stats;
+}
+
+bool BufferPool::addArena(std::size_t vertices, std::size_t indices)
+{
+    // Clear earlier errors so that only the allocation's is seen below.
+    //
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+
+    // Meshes are written into the arenas piece by piece and moved around by
+    // defragmentation, so they are dynamic rather than static.
+    //
+    Arena *arena = new Arena;
+    glGenVertexArrays(1, &arena->VAO);
+    glGenBuffers(1, &arena->VBO);
+    glGenBuffers(1, &arena->EBO);
+    state_.bindVertexArray(arena->VAO);
+    state_.bindBuffer(GL_ARRAY_BUFFER, arena->VBO);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(vertices * stride_), NULL, GL_DYNAMIC_DRAW);
+    applyLayout_(0);
+    state_.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, arena->EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(indices * sizeof(GLuint)), NULL, GL_DYNAMIC_DRAW);
+    state_.bindVertexArray(0);
+    if (glGetError() != GL_NO_ERROR)
+    {
+        std::cout << "ERROR::BUFFER_POOL::ALLOCATION_FAILED" << std::endl;
+        state_.deleteVertexArray(arena->VAO);
+        state_.deleteBuffer(arena->VBO);
+        state_.deleteBuffer(arena->EBO);
+        delete arena;
+        return false;
+    }
+
+    arena->vertices.reset(vertices);
+    arena->indices.reset(indices);
+    arenas_.push_back(arena);
+    return true;
+}
+
+bool BufferPool::allocate(Arena &arena, std::size_t vertexCount, std::size_t indexCount, Mesh &mesh)
+{
+    mesh.vertexRange = arena.vertices.allocate(vertexCount);
+    if (mesh.vertexRange == RangeAllocator::NO_RANGE)
+    {
+        return false;
+    }
+    mesh.indexRange = arena.indices.allocate(indexCount);
+    if (mesh.indexRange == RangeAllocator::NO_RANGE)
+    {
+        arena.vertices.free(mesh.vertexRange);
+        return false;
+    }
+    return true;
+}
+
+void BufferPool::compact(Arena &arena)
+{
+    std::vector<RangeAllocator::Move> moves;
+    arena.vertices.compact(moves);
+    moveRanges(arena.VBO, stride_, moves);
+    arena.indices.compact(moves);
+    moveRanges(arena.EBO, sizeof(GLuint), moves);
+    ++compactions_;
+}
+
+void BufferPool::moveRanges(unsigned int buffer, std::size_t unit, const std::vector<RangeAllocator::Move> &moves)
+{
+    std::size_t i = 0;
+    while (i < moves.size())
+    {
+        // Neighbours that moved by the same distance move as one copy.
+        //
+        const std::size_t from = moves[i].from;
+        const std::size_t to = moves[i].to;
+        std::size_t size = moves[i].size;
+        for (++i; i < moves.size() && moves[i].from == from + size && moves[i].to == to + size; ++i)
+        {
+            size += moves[i].size;
+        }
+
+        const GLsizeiptr bytes = (GLsizeiptr)(size * unit);
+        if (to + size <= from)
+        {
+            state_.bindBuffer(GL_COPY_READ_BUFFER, buffer);
+            state_.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)(from * unit),
+                                (GLintptr)(to * unit), bytes);
+        }
+        else
+        {
+            // A copy within one buffer may not overlap itself, so go through
+            // the scratch buffer.
+            //
+            if (scratch_ == 0)
+            {
+                glGenBuffers(1, &scratch_);
+            }
+            if (scratchBytes_ < (std::size_t)bytes)
+            {
+                scratchBytes_ = (std::size_t)bytes;
+                state_.bindBuffer(GL_COPY_WRITE_BUFFER, scratch_);
+                glBufferData(GL_COPY_WRITE_BUFFER, bytes, NULL, GL_STREAM_COPY);
+            }
+            state_.bindBuffer(GL_COPY_READ_BUFFER, buffer);
+            state_.bindBuffer(GL_COPY_WRITE_BUFFER, scratch_);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)(from * unit), 0, bytes);
+            state_.bindBuffer(GL_COPY_READ_BUFFER, scratch_);
+            state_.bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, (GLintptr)(to * unit), bytes);
+        }
+        movedBytes_ += (std::size_t)bytes;
+    }
+}
+
+/**
+ * @brief Vertices and indices of one small mesh.
+ */
+struct SmallMesh
+{
+    std::vector<float> vertices;
+    std::vector<GLuint> indices;
+};
+
+/**
+ * @brief Makes a grid of 1 to 4 quads a side, shrunk into its own tile of the viewport.
+ *
+ * @param index position of the tile, row by row
+ * @param columns tiles per row
+ * @param random source of the grid size
+ * @param mesh receives the mesh
+ */
+static void makeSmallMesh(std::size_t index, std::size_t columns, std::mt19937 &random, SmallMesh &mesh)
+{
+    const std::size_t quads = 1 + random() % 4;
+    generateGrid(quads, quads, mesh.vertices, mesh.indices);
+    const float tile = 2.0f / (float)columns;
+    const float centerX = -1.0f + ((float)(index % columns) + 0.5f) * tile;
+    const float centerY = -1.0f + ((float)(index / columns) + 0.5f) * tile;
+    for (std::size_t i = 0; i < mesh.vertices.size(); i += FLOATS_PER_VERTEX)
+    {
+        mesh.vertices[i] = centerX + mesh.vertices[i] * 0.4f * tile;
+        mesh.vertices[i + 1] = centerY + mesh.vertices[i + 1] * 0.4f * tile;
+    }
+}
+
+/**
+ * @brief Ways of drawing the meshes that are compared.
+ */
+enum PoolPath
+{
+    POOL_SEPARATE, //!< A vertex array, vertex buffer and element buffer per mesh.
+    POOL_POOLED,   //!< Shared arenas from a BufferPool.
+    POOL_PATHS
+};
+
+const char *const POOL_PATH_NAMES[POOL_PATHS] = {"separate", "pooled"}; //!< Names for reports.
+
+void runBufferPoolBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t meshes,
+                            unsigned long frames, std::ostream &out)
+{
+    static const std::size_t ARENA_VERTICES = 1 << 18;
+    static const std::size_t ARENA_INDICES = 1 << 20;
+
+    std::mt19937 random(12345);
+    const std::size_t columns = (std::size_t)std::ceil(std::sqrt((double)meshes));
+    std::vector<SmallMesh> source(meshes);
+    std::size_t triangles = 0;
+    for (std::size_t i = 0; i < meshes; ++i)
+    {
+        makeSmallMesh(i, columns, random, source[i]);
+        triangles += source[i].indices.size() / 3;
+    }
+
+    // Set both paths up, timing until the GPU has the data.
+    //
+    double setupMs[POOL_PATHS];
+    std::vector<unsigned int> objects(meshes * 3);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < meshes; ++i)
+    {
+        createIndexedVertexArray(state, source[i].vertices, source[i].indices, objects[i * 3], objects[i * 3 + 1],
+                                 objects[i * 3 + 2]);
+    }
+    glFinish();
+    setupMs[POOL_SEPARATE] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    BufferPool pool(state);
+    std::vector<std::uint32_t> handles(meshes);
+    start = std::chrono::steady_clock::now();
+    pool.create<PositionLayout>(ARENA_VERTICES, ARENA_INDICES);
+    for (std::size_t i = 0; i < meshes; ++i)
+    {
+        handles[i] = pool.add(&source[i].vertices[0], source[i].vertices.size() / FLOATS_PER_VERTEX,
+                              &source[i].indices[0], source[i].indices.size());
+    }
+    glFinish();
+    setupMs[POOL_POOLED] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // Draws every mesh once, through the given path.
+    //
+    const auto drawFrame = [&](int path) {
+        state.beginFrame();
+        state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        state.useProgram(shaderProgram);
+        for (std::size_t i = 0; i < meshes; ++i)
+        {
+            if (path == POOL_SEPARATE)
+            {
+                state.bindVertexArray(objects[i * 3]);
+                glDrawElements(GL_TRIANGLES, (GLsizei)source[i].indices.size(), GL_UNSIGNED_INT, (void *)0);
+            }
+            else
+            {
+                pool.draw(handles[i]);
+            }
+        }
+    };
+
+    FrameStats frameTimes[POOL_PATHS];
+    unsigned long stateCalls[POOL_PATHS];
+    std::uint64_t images[POOL_PATHS];
+    for (int path = 0; path < POOL_PATHS; ++path)
+    {
+        // The first frame of each path pays for lazy setup, so skip it.
+        //
+        for (unsigned long frame = 0; frame <= frames; ++frame)
+        {
+            const std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+            drawFrame(path);
+            glFinish();
+            if (frame > 0)
+            {
+                frameTimes[path].addSample(
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+            }
+        }
+        stateCalls[path] = state.frame().issued;
+        images[path] = hashFramebuffer();
+    }
+
+    // Churn: take out a random half and put them back in a different order,
+    // then take out a quarter, defragment, and put those back too.
+    //
+    std::vector<std::size_t> order(meshes);
+    for (std::size_t i = 0; i < meshes; ++i)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), random);
+    for (std::size_t i = 0; i < meshes / 2; ++i)
+    {
+        pool.remove(handles[order[i]]);
+    }
+    const BufferPool::Stats holes = pool.stats();
+    std::shuffle(order.begin(), order.begin() + meshes / 2, random);
+    for (std::size_t i = 0; i < meshes / 2; ++i)
+    {
+        const SmallMesh &mesh = source[order[i]];
+        handles[order[i]] = pool.add(&mesh.vertices[0], mesh.vertices.size() / FLOATS_PER_VERTEX, &mesh.indices[0],
+                                     mesh.indices.size());
+    }
+    drawFrame(POOL_POOLED);
+    const std::uint64_t churnedImage = hashFramebuffer();
+
+    std::shuffle(order.begin(), order.end(), random);
+    for (std::size_t i = 0; i < meshes / 4; ++i)
+    {
+        pool.remove(handles[order[i]]);
+    }
+    const BufferPool::Stats beforeDefragment = pool.stats();
+    glFinish();
+    start = std::chrono::steady_clock::now();
+    pool.defragment();
+    glFinish();
+    const double defragmentMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const BufferPool::Stats afterDefragment = pool.stats();
+    for (std::size_t i = 0; i < meshes / 4; ++i)
+    {
+        const SmallMesh &mesh = source[order[i]];
+        handles[order[i]] = pool.add(&mesh.vertices[0], mesh.vertices.size() / FLOATS_PER_VERTEX, &mesh.indices[0],
+                                     mesh.indices.size());
+    }
+    drawFrame(POOL_POOLED);
+    const std::uint64_t defragmentedImage = hashFramebuffer();
+    const BufferPool::Stats finished = pool.stats();
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Buffer pool: " << meshes << " meshes, " << triangles << " triangles, " << frames << " frames per path on "
+        << glGetString(GL_RENDERER) << std::endl;
+    out << std::fixed << std::setprecision(3);
+    for (int path = 0; path < POOL_PATHS; ++path)
+    {
+        const std::size_t buffers = path == POOL_SEPARATE ? meshes * 2 : finished.arenas * 2;
+        const std::size_t vertexArrays = path == POOL_SEPARATE ? meshes : finished.arenas;
+        out << std::left << std::setw(10) << POOL_PATH_NAMES[path] << std::right << buffers << " buffers, "
+            << vertexArrays << " vertex arrays, " << stateCalls[path] << " state calls per frame, set up in "
+            << setupMs[path] << " ms" << std::endl;
+        frameTimes[path].report(out, "frame");
+    }
+    out << std::setprecision(1) << "pooled vs separate at p50: "
+        << frameTimes[POOL_SEPARATE].percentile(50.0) / frameTimes[POOL_POOLED].percentile(50.0) << "x, same image: "
+        << (images[POOL_SEPARATE] == images[POOL_POOLED] ? "yes" : "NO") << std::endl;
+    out << std::setprecision(3) << "after removing half: largest free range " << holes.largestFreeRange << " of "
+        << holes.freeVertices << " free vertices; re-added, same image: "
+        << (churnedImage == images[POOL_SEPARATE] ? "yes" : "NO") << std::endl;
+    out << "defragmented " << beforeDefragment.largestFreeRange << " -> " << afterDefragment.largestFreeRange
+        << " vertices largest free range in " << defragmentMs << " ms, " << afterDefragment.movedBytes / 1024
+        << " KiB moved; re-added, same image: " << (defragmentedImage == images[POOL_SEPARATE] ? "yes" : "NO")
+        << std::endl;
+    out << "pool: " << finished.arenas << " arenas, " << finished.usedBytes / 1024 << " of " << finished.capacityBytes / 1024
+        << " KiB used, " << finished.compactions << " arenas compacted" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+
+    for (std::size_t i = 0; i < meshes; ++i)
+    {
+        state.deleteVertexArray(objects[i * 3]);
+        state.deleteBuffer(objects[i * 3 + 1]);
+        state.deleteBuffer(objects[i * 3 + 2]);
+    }
+    pool.destroy();
+}
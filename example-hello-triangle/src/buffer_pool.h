@@ -0,0 +1,183 @@
+/**
+ * @file buffer_pool.h
+ * @brief Many small meshes carved out of a few large vertex and element buffers.
+ *
+ * Giving every mesh its own vertex array, vertex buffer and element buffer
+ * means a vertex array bind before every draw and thousands of buffer objects
+ * for the driver to track. The pool instead puts meshes with the same vertex
+ * layout side by side in shared buffers, one vertex array per pair, and draws
+ * each with glDrawElementsBaseVertex. The base vertex is added to every index,
+ * so a mesh's indices stay relative to its own first vertex wherever it lands.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+#include "range_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Shared buffers, called arenas, holding the vertices and indices of many meshes.
+ *
+ * Space in each arena is managed by a RangeAllocator. When no arena has room
+ * for a mesh, an arena with enough free space in total is defragmented first,
+ * and only if there is none is a new arena created.
+ */
+class BufferPool
+{
+public:
+    static const std::uint32_t NO_MESH = 0xFFFFFFFFu; //!< Returned when a mesh cannot be added.
+
+    /**
+     * @brief How full the pool is.
+     */
+    struct Stats
+    {
+        std::size_t arenas;           //!< Vertex array, vertex buffer and element buffer sets.
+        std::size_t meshes;           //!< Meshes in the pool.
+        std::size_t usedBytes;        //!< Bytes of vertices and indices in use.
+        std::size_t capacityBytes;    //!< Bytes of buffer storage.
+        std::size_t freeVertices;     //!< Free vertex slots in all arenas.
+        std::size_t largestFreeRange; //!< Most vertices that fit in one allocation.
+        unsigned long compactions;    //!< Arenas defragmented so far.
+        std::size_t movedBytes;       //!< Bytes copied by defragmenting.
+    };
+
+    explicit BufferPool(GlStateCache &state);
+    ~BufferPool();
+
+    /**
+     * @brief Sets up the pool for meshes with one vertex layout and creates the first arena.
+     *
+     * @tparam Layout a VertexLayout, whose attributes are set up on each arena's vertex array
+     * @param arenaVertices vertices per arena
+     * @param arenaIndices indices per arena
+     * @return true if the first arena was created
+     */
+    template <typename Layout>
+    bool create(std::size_t arenaVertices, std::size_t arenaIndices)
+    {
+        return create(Layout::STRIDE, &Layout::apply, arenaVertices, arenaIndices);
+    }
+
+    /**
+     * @brief Deletes every arena. Meshes become invalid.
+     */
+    void destroy();
+
+    /**
+     * @brief Copies a mesh into the pool.
+     *
+     * @param vertices vertices in the pool's layout
+     * @param vertexCount number of vertices
+     * @param indices indices, counting from the mesh's first vertex
+     * @param indexCount number of indices
+     * @return handle of the mesh, or NO_MESH if a new arena could not be created
+     */
+    std::uint32_t add(const void *vertices, std::size_t vertexCount, const GLuint *indices, std::size_t indexCount);
+
+    /**
+     * @brief Frees a mesh's space for other meshes.
+     *
+     * @param mesh handle from add()
+     */
+    void remove(std::uint32_t mesh);
+
+    /**
+     * @brief Draws a mesh as triangles.
+     *
+     * Binds the mesh's arena through the state cache, so consecutive draws
+     * from the same arena bind nothing. Uses whatever program is bound.
+     *
+     * @param mesh handle from add()
+     */
+    void draw(std::uint32_t mesh);
+
+    /**
+     * @brief Moves meshes down in every arena so its free space is in one piece.
+     *
+     * Copies on the GPU, with glCopyBufferSubData; mesh handles stay valid.
+     */
+    void defragment();
+
+    Stats stats() const;
+
+private:
+    BufferPool(const BufferPool &);            // Not copyable.
+    BufferPool &operator=(const BufferPool &); // Not copyable.
+
+    /**
+     * @brief One vertex array with its own vertex and element buffers.
+     */
+    struct Arena
+    {
+        unsigned int VAO;
+        unsigned int VBO;
+        unsigned int EBO;
+        RangeAllocator vertices; //!< In vertices.
+        RangeAllocator indices;  //!< In indices.
+    };
+
+    /**
+     * @brief Where a mesh lives.
+     */
+    struct Mesh
+    {
+        std::uint32_t arena;
+        std::uint32_t vertexRange; //!< Handle in the arena's vertex allocator.
+        std::uint32_t indexRange;  //!< Handle in the arena's index allocator.
+        GLsizei indexCount;
+        bool live;
+    };
+
+    bool create(std::size_t stride, void (*applyLayout)(GLuint), std::size_t arenaVertices, std::size_t arenaIndices);
+    bool addArena(std::size_t vertices, std::size_t indices);
+    bool allocate(Arena &arena, std::size_t vertexCount, std::size_t indexCount, Mesh &mesh);
+    void compact(Arena &arena);
+    void moveRanges(unsigned int buffer, std::size_t unit, const std::vector<RangeAllocator::Move> &moves);
+
+    GlStateCache &state_;
+    std::size_t stride_;
+    void (*applyLayout_)(GLuint);
+    std::size_t arenaVertices_;
+    std::size_t arenaIndices_;
+    std::vector<Arena *> arenas_;
+    std::vector<Mesh> meshes_;
+    std::vector<std::uint32_t> spareMeshes_; // Entries of meshes_ that are not live.
+    unsigned int scratch_;                   // Staging buffer for moves that overlap themselves.
+    std::size_t scratchBytes_;
+    unsigned long compactions_;
+    std::size_t movedBytes_;
+};
+
+/**
+ * @brief Compares drawing many small meshes from their own buffers against a BufferPool.
+ *
+ * Each path draws the same meshes, small grids of 2 to 32 triangles, once per
+ * frame. Reports the buffer objects and vertex arrays each path needs, the
+ * state calls it issues per frame, setup and frame times. Then removes and
+ * adds meshes at random to fragment the pool, defragments it, and checks the
+ * rendered image is unchanged. Every frame is waited on with glFinish. Needs
+ * a current context with a render target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the meshes with
+ * @param meshes number of meshes
+ * @param frames frames to time for each path
+ * @param out stream to write the report to
+ */
+void runBufferPoolBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t meshes,
+                            unsigned long frames, std::ostream &out);
+
+#endif // BUFFER_POOL_H
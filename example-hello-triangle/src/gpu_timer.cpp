@@ -0,0 +1,200 @@
+/**
+ * @file gpu_timer.cpp
+ * @brief Per-pass GPU timing with timer queries read back without stalling.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "gpu_timer.h"
+
+#include <iostream>
+#include <string>
+
+static const unsigned int NO_PASS = ~0u; //!< Marks that no pass is being timed.
+
+GpuTimer::GpuTimer()
+    : frameStats_(0, RECENT_FRAME_SAMPLES), passCount_(0), current_(0), activePass_(NO_PASS), dropped_(0),
+      created_(false)
+{
+    // The timer runs for as long as a window is open, so keep recent frames only.
+    //
+    for (unsigned int i = 0; i < MAX_PASSES; ++i)
+    {
+        passStats_[i] = FrameStats(0, RECENT_FRAME_SAMPLES);
+    }
+}
+
+GpuTimer::~GpuTimer()
+{
+    destroy();
+}
+
+bool GpuTimer::create(const char *const *passNames, unsigned int passCount)
+{
+    if (passCount > MAX_PASSES)
+    {
+        std::cout << "ERROR::GPU_TIMER::TOO_MANY_PASSES" << std::endl;
+        return false;
+    }
+
+    // Timer queries are core in 3.3, but an implementation may report zero
+    // bits of precision, in which case the results are meaningless.
+    //
+    int bits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+    if (bits == 0)
+    {
+        std::cout << "GPU timer queries are not supported by this implementation" << std::endl;
+        return false;
+    }
+
+    passCount_ = passCount;
+    for (unsigned int pass = 0; pass < passCount; ++pass)
+    {
+        passNames_[pass] = passNames[pass];
+    }
+
+    for (unsigned int slot = 0; slot < RING_SIZE; ++slot)
+    {
+        FrameQueries &queries = ring_[slot];
+        glGenQueries(passCount, queries.passes);
+        glGenQueries(1, &queries.frameBegin);
+        glGenQueries(1, &queries.frameEnd);
+        queries.pending = false;
+    }
+
+    current_ = 0;
+    activePass_ = NO_PASS;
+    dropped_ = 0;
+    created_ = true;
+    return true;
+}
+
+void GpuTimer::destroy()
+{
+    if (!created_)
+    {
+        return;
+    }
+
+    for (unsigned int slot = 0; slot < RING_SIZE; ++slot)
+    {
+        FrameQueries &queries = ring_[slot];
+        glDeleteQueries(passCount_, queries.passes);
+        glDeleteQueries(1, &queries.frameBegin);
+        glDeleteQueries(1, &queries.frameEnd);
+    }
+    created_ = false;
+}
+
+void GpuTimer::beginFrame()
+{
+    current_ = (current_ + 1) % RING_SIZE;
+    FrameQueries &queries = ring_[current_];
+
+    // This slot was last used RING_SIZE frames ago. If its results still are
+    // not in, drop them instead of stalling until they are.
+    //
+    if (queries.pending && !collect(queries, false))
+    {
+        ++dropped_;
+    }
+
+    for (unsigned int pass = 0; pass < passCount_; ++pass)
+    {
+        queries.passIssued[pass] = false;
+    }
+    glQueryCounter(queries.frameBegin, GL_TIMESTAMP);
+}
+
+void GpuTimer::beginPass(unsigned int pass)
+{
+    FrameQueries &queries = ring_[current_];
+    glBeginQuery(GL_TIME_ELAPSED, queries.passes[pass]);
+    queries.passIssued[pass] = true;
+    activePass_ = pass;
+}
+
+void GpuTimer::endPass()
+{
+    if (activePass_ != NO_PASS)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        activePass_ = NO_PASS;
+    }
+}
+
+void GpuTimer::endFrame()
+{
+    endPass();
+
+    FrameQueries &queries = ring_[current_];
+    glQueryCounter(queries.frameEnd, GL_TIMESTAMP);
+    queries.pending = true;
+}
+
+void GpuTimer::flush()
+{
+    // Oldest first so samples stay in frame order.
+    //
+    for (unsigned int i = 1; i <= RING_SIZE; ++i)
+    {
+        FrameQueries &queries = ring_[(current_ + i) % RING_SIZE];
+        if (queries.pending)
+        {
+            collect(queries, true);
+        }
+    }
+}
+
+bool GpuTimer::collect(FrameQueries &queries, bool wait)
+{
+    // The end timestamp is the last query of the frame; once it is available
+    // the rest of the frame's queries are too.
+    //
+    if (!wait)
+    {
+        unsigned int available = 0;
+        glGetQueryObjectuiv(queries.frameEnd, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+            queries.pending = false;
+            return false;
+        }
+    }
+
+    GLuint64 begin = 0;
+    GLuint64 end = 0;
+    glGetQueryObjectui64v(queries.frameBegin, GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(queries.frameEnd, GL_QUERY_RESULT, &end);
+    frameStats_.addSample((double)(end - begin) / 1.0e6);
+
+    for (unsigned int pass = 0; pass < passCount_; ++pass)
+    {
+        if (queries.passIssued[pass])
+        {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(queries.passes[pass], GL_QUERY_RESULT, &elapsed);
+            passStats_[pass].addSample((double)elapsed / 1.0e6);
+        }
+    }
+
+    queries.pending = false;
+    return true;
+}
+
+void GpuTimer::report(std::ostream &out) const
+{
+    frameStats_.report(out, "gpu frame");
+    for (unsigned int pass = 0; pass < passCount_; ++pass)
+    {
+        std::string label = std::string("gpu ") + passNames_[pass];
+        passStats_[pass].report(out, label.c_str());
+    }
+    if (dropped_ > 0)
+    {
+        out << "  " << dropped_ << " GPU frame(s) not ready in time and dropped from the timings" << std::endl;
+    }
+}
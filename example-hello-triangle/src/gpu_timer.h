@@ -0,0 +1,125 @@
+/**
+ * @file gpu_timer.h
+ * @brief Per-pass GPU timing with timer queries read back without stalling.
+ *
+ * Queries for a frame are only read once the frame is several frames old, by
+ * which time the GPU has normally finished it. Results that are still not
+ * available are dropped rather than waited for, so timing never blocks the
+ * render loop.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+#include <glad/glad.h>
+
+#include "frame_stats.h"
+
+#include <ostream>
+
+/**
+ * @brief Times named passes of each frame on the GPU.
+ *
+ * Passes are timed with GL_TIME_ELAPSED queries and must not overlap. The span
+ * of the whole frame is taken from a pair of GL_TIMESTAMP queries.
+ */
+class GpuTimer
+{
+public:
+    static const unsigned int MAX_PASSES = 8; //!< Most passes that can be timed per frame.
+    static const unsigned int RING_SIZE = 4;  //!< Frames in flight before a query set is reused.
+
+    GpuTimer();
+    ~GpuTimer();
+
+    /**
+     * @brief Creates the query objects.
+     *
+     * @param passNames names of the passes, used when reporting
+     * @param passCount number of passes, at most MAX_PASSES
+     * @return true if timer queries are supported and were created
+     */
+    bool create(const char *const *passNames, unsigned int passCount);
+
+    /**
+     * @brief Deletes the query objects.
+     */
+    void destroy();
+
+    /**
+     * @brief Starts a frame, first collecting any results that are ready.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Starts timing a pass.
+     *
+     * @param pass index of the pass, in the order given to create()
+     */
+    void beginPass(unsigned int pass);
+
+    /**
+     * @brief Stops timing the current pass.
+     */
+    void endPass();
+
+    /**
+     * @brief Ends the frame.
+     */
+    void endFrame();
+
+    /**
+     * @brief Waits for and collects the results of every frame still in flight.
+     *
+     * Intended for shutdown, when blocking no longer matters.
+     */
+    void flush();
+
+    /**
+     * @brief Writes the GPU time of each pass and of the whole frame.
+     *
+     * @param out stream to write to
+     */
+    void report(std::ostream &out) const;
+
+private:
+    GpuTimer(const GpuTimer &);            // Not copyable.
+    GpuTimer &operator=(const GpuTimer &); // Not copyable.
+
+    /**
+     * @brief Query objects for one frame in the ring.
+     */
+    struct FrameQueries
+    {
+        unsigned int passes[MAX_PASSES]; //!< GL_TIME_ELAPSED query per pass.
+        unsigned int frameBegin;         //!< GL_TIMESTAMP at the start of the frame.
+        unsigned int frameEnd;           //!< GL_TIMESTAMP at the end of the frame.
+        bool passIssued[MAX_PASSES];     //!< Whether the pass ran this frame.
+        bool pending;                    //!< Whether results have yet to be collected.
+    };
+
+    /**
+     * @brief Reads the results of a frame into the stats.
+     *
+     * @param queries the frame to read
+     * @param wait whether to wait for results that are not available yet
+     * @return true if the results were available and collected
+     */
+    bool collect(FrameQueries &queries, bool wait);
+
+    FrameQueries ring_[RING_SIZE];
+    FrameStats passStats_[MAX_PASSES];
+    FrameStats frameStats_;
+    const char *passNames_[MAX_PASSES];
+    unsigned int passCount_;
+    unsigned int current_;
+    unsigned int activePass_;
+    unsigned long dropped_;
+    bool created_;
+};
+
+#endif // GPU_TIMER_H
@@ -0,0 +1,191 @@
+/**
+ * @file indexed_drawing.cpp
+ * @brief Drawing a mesh with shared vertices through an element buffer.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "indexed_drawing.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+#include "mesh_optimizer.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Ways of drawing the mesh that are compared.
+ */
+enum DrawPath
+{
+    DRAW_UNINDEXED, //!< glDrawArrays with every triangle's vertices written out.
+    DRAW_SHUFFLED,  //!< glDrawElements with the triangles in generated order.
+    DRAW_OPTIMIZED, //!< glDrawElements after reordering triangles and vertices.
+    DRAW_PATHS
+};
+
+const char *const DRAW_PATH_NAMES[DRAW_PATHS] = {"unindexed", "indexed", "optimized"}; //!< Names for reports.
+
+/**
+ * @brief A way of drawing the mesh and how it did.
+ */
+struct PathResult
+{
+    unsigned int VAO;     //!< Vertex array to draw.
+    unsigned int VBO;     //!< Its vertex buffer.
+    unsigned int EBO;     //!< Its element buffer, or 0 if drawn unindexed.
+    double acmr;          //!< Simulated vertices shaded per triangle.
+    GLuint64 invocations; //!< Vertex shader invocations in one frame, if queried.
+    FrameStats frame;     //!< Time until the GPU finished each frame.
+};
+
+bool runIndexedBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t triangles,
+                         unsigned long frames, std::ostream &out)
+{
+    // Frame 0 is never timed and the invocations query is begun on frame 1, so
+    // with no frames there is nothing to query or compare.
+    //
+    if (frames == 0)
+    {
+        std::cout << "ERROR::INDEXED_DRAWING::NO_FRAMES" << std::endl;
+        return false;
+    }
+
+    // A square grid of quads, two triangles each.
+    //
+    std::size_t side = (std::size_t)std::sqrt((double)triangles / 2.0);
+    if (side == 0)
+    {
+        side = 1;
+    }
+    std::vector<float> vertices;
+    std::vector<GLuint> indices;
+    generateGrid(side, side, vertices, indices);
+    const std::size_t vertexCount = vertices.size() / FLOATS_PER_VERTEX;
+    const GLsizei indexCount = (GLsizei)indices.size();
+
+    PathResult results[DRAW_PATHS];
+
+    std::vector<float> expanded;
+    expandIndexed(vertices, indices, expanded);
+    createVertexArray(state, &expanded[0], expanded.size() * sizeof(float), results[DRAW_UNINDEXED].VAO,
+                      results[DRAW_UNINDEXED].VBO);
+    results[DRAW_UNINDEXED].EBO = 0;
+    results[DRAW_UNINDEXED].acmr = 3.0;
+    std::vector<float>().swap(expanded);
+
+    createIndexedVertexArray(state, vertices, indices, results[DRAW_SHUFFLED].VAO, results[DRAW_SHUFFLED].VBO,
+                             results[DRAW_SHUFFLED].EBO);
+    results[DRAW_SHUFFLED].acmr = computeAcmr(indices, vertexCount);
+
+    // The pass a loader would run once at load time, or a tool offline.
+    //
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    optimizeVertexCache(indices, vertexCount);
+    optimizeVertexFetch(indices, vertices, FLOATS_PER_VERTEX);
+    const double optimizeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    createIndexedVertexArray(state, vertices, indices, results[DRAW_OPTIMIZED].VAO, results[DRAW_OPTIMIZED].VBO,
+                             results[DRAW_OPTIMIZED].EBO);
+    results[DRAW_OPTIMIZED].acmr = computeAcmr(indices, vertexCount);
+
+    // Count what the GPU actually shaded, where the driver can tell.
+    //
+    unsigned int query = 0;
+    if (GLAD_GL_ARB_pipeline_statistics_query)
+    {
+        glGenQueries(1, &query);
+    }
+
+    for (int path = 0; path < DRAW_PATHS; ++path)
+    {
+        PathResult &result = results[path];
+        result.invocations = 0;
+        for (unsigned long frame = 0; frame <= frames; ++frame)
+        {
+            const std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
+            state.beginFrame();
+            state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            state.useProgram(shaderProgram);
+            state.bindVertexArray(result.VAO);
+            if (query != 0 && frame == 1)
+            {
+                glBeginQuery(GL_VERTEX_SHADER_INVOCATIONS_ARB, query);
+            }
+            if (path == DRAW_UNINDEXED)
+            {
+                glDrawArrays(GL_TRIANGLES, 0, indexCount);
+            }
+            else
+            {
+                glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void *)0);
+            }
+            if (query != 0 && frame == 1)
+            {
+                glEndQuery(GL_VERTEX_SHADER_INVOCATIONS_ARB);
+            }
+            glFinish();
+
+            // The first frame of each path pays for lazy setup, so skip it.
+            //
+            if (frame > 0)
+            {
+                result.frame.addSample(
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+            }
+        }
+        if (query != 0)
+        {
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result.invocations);
+        }
+    }
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Indexed drawing: " << side << "x" << side << " grid, " << indexCount / 3 << " triangles, " << vertexCount
+        << " vertices, " << frames << " frames per path on " << glGetString(GL_RENDERER) << std::endl;
+    out << std::fixed << std::setprecision(3)
+        << "reordered for a " << VERTEX_CACHE_SIZE << " entry cache in " << optimizeMs << " ms" << std::endl;
+    for (int path = 0; path < DRAW_PATHS; ++path)
+    {
+        out << std::left << std::setw(12) << DRAW_PATH_NAMES[path] << std::right << "ACMR " << results[path].acmr;
+        if (query != 0)
+        {
+            out << "  vertex shader invocations " << results[path].invocations << " ("
+                << (double)results[path].invocations / (double)(indexCount / 3) << " per triangle)";
+        }
+        out << std::endl;
+        results[path].frame.report(out, "frame");
+    }
+    out << std::setprecision(1) << "optimized vs indexed at p50: frame "
+        << results[DRAW_SHUFFLED].frame.percentile(50.0) / results[DRAW_OPTIMIZED].frame.percentile(50.0)
+        << "x, vs unindexed " << results[DRAW_UNINDEXED].frame.percentile(50.0) / results[DRAW_OPTIMIZED].frame.percentile(50.0)
+        << "x" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+
+    if (query != 0)
+    {
+        glDeleteQueries(1, &query);
+    }
+    for (int path = 0; path < DRAW_PATHS; ++path)
+    {
+        state.deleteVertexArray(results[path].VAO);
+        state.deleteBuffer(results[path].VBO);
+        if (results[path].EBO != 0)
+        {
+            state.deleteBuffer(results[path].EBO);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file indexed_drawing.h
+ * @brief Drawing a mesh with shared vertices through an element buffer.
+ *
+ * Without indices every triangle brings its own three vertices, so a vertex
+ * shared by six triangles is shaded six times. With indices the GPU can reuse
+ * a shaded vertex from its post-transform cache, but only if the triangles
+ * that share it are drawn close together; see mesh_optimizer.h.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef INDEXED_DRAWING_H
+#define INDEXED_DRAWING_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+
+#include <cstddef>
+#include <ostream>
+
+/**
+ * @brief Compares drawing a grid mesh unindexed, indexed as generated, and indexed after optimizing.
+ *
+ * The mesh is a grid of quads in shuffled order, from generateGrid(). Reports
+ * the simulated ACMR of each order and the frame times, and with
+ * GL_ARB_pipeline_statistics_query the vertex shader invocations the GPU
+ * actually made. Every frame is waited on with glFinish. Needs a current
+ * context with a render target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the mesh with
+ * @param triangles approximate number of triangles in the mesh
+ * @param frames frames to time for each path; at least 1
+ * @param out stream to write the report to
+ * @return false if frames is 0, without running anything
+ */
+bool runIndexedBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t triangles,
+                         unsigned long frames, std::ostream &out);
+
+#endif // INDEXED_DRAWING_H
@@ -0,0 +1,203 @@
+/**
+ * @file instancing.cpp
+ * @brief Drawing many copies of a mesh with one instanced draw call.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "instancing.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+/**
+ * @brief Attribute locations of the instance attributes.
+ *
+ * These have to match the layout qualifiers in shaders/instanced.vert.
+ */
+enum InstanceAttribute
+{
+    ATTRIBUTE_OFFSET = 1,
+    ATTRIBUTE_COLOR = 2,
+    ATTRIBUTE_SCALE = 3
+};
+
+/**
+ * @brief How an Instance is laid out in the instance buffer.
+ */
+typedef VertexLayout<Attribute<ATTRIBUTE_OFFSET, GLfloat, 2>,
+                     Attribute<ATTRIBUTE_COLOR, GLfloat, 3>,
+                     Attribute<ATTRIBUTE_SCALE, GLfloat, 1> >
+    InstanceLayout;
+
+static_assert(InstanceLayout::STRIDE == sizeof(Instance), "InstanceLayout does not match Instance");
+static_assert(InstanceLayout::Offset<1>::VALUE == offsetof(Instance, color), "InstanceLayout does not match Instance");
+static_assert(InstanceLayout::Offset<2>::VALUE == offsetof(Instance, scale), "InstanceLayout does not match Instance");
+
+void generateInstances(std::size_t count, std::vector<Instance> &instances)
+{
+    instances.resize(count);
+    if (count == 0)
+    {
+        return;
+    }
+
+    // One instance per cell of the smallest square grid that fits them all,
+    // scaled to leave a gap around it, with the color varying across the grid.
+    //
+    const std::size_t columns = (std::size_t)std::ceil(std::sqrt((double)count));
+    const std::size_t rows = (count + columns - 1) / columns;
+    const float cellWidth = 2.0f / (float)columns;
+    const float cellHeight = 2.0f / (float)rows;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t column = i % columns;
+        const std::size_t row = i / columns;
+
+        Instance &instance = instances[i];
+        instance.offset[0] = -1.0f + ((float)column + 0.5f) * cellWidth;
+        instance.offset[1] = -1.0f + ((float)row + 0.5f) * cellHeight;
+        instance.color[0] = 1.0f;
+        instance.color[1] = 0.25f + 0.5f * (float)column / (float)columns;
+        instance.color[2] = 0.2f + 0.5f * (float)row / (float)rows;
+        instance.scale = 0.8f * (cellWidth < cellHeight ? cellWidth : cellHeight);
+    }
+}
+
+void createInstancedVertexArray(GlStateCache &state, unsigned int meshVBO, const std::vector<Instance> &instances,
+                                unsigned int &VAO, unsigned int &instanceVBO)
+{
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &instanceVBO);
+    state.bindVertexArray(VAO);
+
+    // The mesh, advancing once per vertex as usual.
+    //
+    state.bindBuffer(GL_ARRAY_BUFFER, meshVBO);
+    PositionLayout::apply();
+
+    // The instances, advancing once per instance thanks to the divisor.
+    //
+    state.bindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(instances.size() * sizeof(Instance)),
+                 instances.empty() ? NULL : &instances[0], GL_STATIC_DRAW);
+
+    InstanceLayout::apply(1);
+
+    state.bindBuffer(GL_ARRAY_BUFFER, 0);
+    state.bindVertexArray(0);
+}
+
+/**
+ * @brief Timings of one way of drawing the instances.
+ */
+struct DrawTimings
+{
+    FrameStats submit; //!< CPU time to issue the frame's calls.
+    FrameStats frame;  //!< Time until the GPU finished the frame.
+};
+
+void runInstancingBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t instanceCount,
+                            unsigned long frames, std::ostream &out)
+{
+    // The hello-triangle triangle, which is centered on the origin, so scale
+    // and offset place it in its cell.
+    //
+    // clang-format off
+    const float vertices[] = {
+        -0.5f, -0.5f, 0.0f, // Left.
+         0.5f, -0.5f, 0.0f, // Right.
+         0.0f,  0.5f, 0.0f  // Top.
+    };
+    // clang-format on
+
+    // The individual path uses a plain vertex array; with the instance
+    // attribute arrays disabled, their values come from glVertexAttrib*.
+    //
+    unsigned int meshVAO;
+    unsigned int meshVBO;
+    createVertexArray(state, vertices, sizeof(vertices), meshVAO, meshVBO);
+
+    std::vector<Instance> instances;
+    generateInstances(instanceCount, instances);
+
+    unsigned int instancedVAO;
+    unsigned int instanceVBO;
+    createInstancedVertexArray(state, meshVBO, instances, instancedVAO, instanceVBO);
+
+    DrawTimings individual;
+    DrawTimings instanced;
+    for (int path = 0; path < 2; ++path)
+    {
+        DrawTimings &timings = (path == 0) ? individual : instanced;
+        for (unsigned long frame = 0; frame <= frames; ++frame)
+        {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            state.beginFrame();
+            state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            state.useProgram(shaderProgram);
+
+            if (path == 0)
+            {
+                state.bindVertexArray(meshVAO);
+                for (std::size_t i = 0; i < instances.size(); ++i)
+                {
+                    const Instance &instance = instances[i];
+                    glVertexAttrib2fv(ATTRIBUTE_OFFSET, instance.offset);
+                    glVertexAttrib3fv(ATTRIBUTE_COLOR, instance.color);
+                    glVertexAttrib1f(ATTRIBUTE_SCALE, instance.scale);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+            }
+            else
+            {
+                state.bindVertexArray(instancedVAO);
+                glDrawArraysInstanced(GL_TRIANGLES, 0, 3, (GLsizei)instances.size());
+            }
+
+            const std::chrono::steady_clock::time_point submitted = std::chrono::steady_clock::now();
+            glFinish();
+            const std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+            // The first frame of each path pays for lazy setup, so skip it.
+            //
+            if (frame > 0)
+            {
+                timings.submit.addSample(std::chrono::duration<double, std::milli>(submitted - start).count());
+                timings.frame.addSample(std::chrono::duration<double, std::milli>(finished - start).count());
+            }
+        }
+    }
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Instancing: " << instanceCount << " triangles, " << frames << " frames per path on "
+        << glGetString(GL_RENDERER) << std::endl;
+    out << "individual draws (" << instanceCount << " glDrawArrays per frame)" << std::endl;
+    individual.submit.report(out, "cpu submit");
+    individual.frame.report(out, "frame");
+    out << "instanced draw (1 glDrawArraysInstanced per frame)" << std::endl;
+    instanced.submit.report(out, "cpu submit");
+    instanced.frame.report(out, "frame");
+    out << std::fixed << std::setprecision(1)
+        << "speedup at p50: submit " << individual.submit.percentile(50.0) / instanced.submit.percentile(50.0)
+        << "x, frame " << individual.frame.percentile(50.0) / instanced.frame.percentile(50.0) << "x" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+
+    state.deleteVertexArray(instancedVAO);
+    state.deleteBuffer(instanceVBO);
+    state.deleteVertexArray(meshVAO);
+    state.deleteBuffer(meshVBO);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file instancing.h
+ * @brief Drawing many copies of a mesh with one instanced draw call.
+ *
+ * Each copy gets its own offset, color and scale from a second vertex buffer
+ * whose attributes advance once per instance rather than once per vertex.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Per-instance attributes, laid out as they are in the instance buffer.
+ */
+struct Instance
+{
+    float offset[2]; //!< Position added to the mesh, in clip space.
+    float color[3];  //!< Color of the copy.
+    float scale;     //!< Uniform scale applied to the mesh before the offset.
+};
+
+/**
+ * @brief Generates instances laid out on a grid that covers the viewport.
+ *
+ * @param count number of instances
+ * @param instances receives the instances
+ */
+void generateInstances(std::size_t count, std::vector<Instance> &instances);
+
+/**
+ * @brief Creates a vertex array that draws a mesh once per instance.
+ *
+ * The mesh positions go to attribute 0 and the instance attributes to 1
+ * (offset), 2 (color) and 3 (scale), with a divisor of one.
+ *
+ * @param state state cache to bind through
+ * @param meshVBO vertex buffer holding x, y, z positions of the mesh
+ * @param instances the instances
+ * @param VAO receives the vertex array object
+ * @param instanceVBO receives the buffer holding the instances
+ */
+void createInstancedVertexArray(GlStateCache &state, unsigned int meshVBO, const std::vector<Instance> &instances,
+                                unsigned int &VAO, unsigned int &instanceVBO);
+
+/**
+ * @brief Compares drawing instances one draw call each against one instanced draw.
+ *
+ * Both paths draw the same image. The individual path sets the instance
+ * attributes as constant vertex attributes before each glDrawArrays, while the
+ * instanced path reads them from the instance buffer. Needs a current context
+ * with a render target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program built from shaders/instanced.vert and instanced.frag
+ * @param instanceCount number of copies of the triangle to draw
+ * @param frames frames to time for each path
+ * @param out stream to write the report to
+ */
+void runInstancingBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t instanceCount,
+                            unsigned long frames, std::ostream &out);
+
+#endif // INSTANCING_H
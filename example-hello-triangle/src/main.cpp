@@ -10,39 +10,332 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
-#include <iostream>
+#include "buffer_pool.h"
+#include "frame_loop.h"
+#include "frame_stats.h"
+#include "geometry.h"
+#include "gl_debug.h"
+#include "gl_loader.h"
+#include "gl_state_cache.h"
+#include "gl_trace.h"
+#include "gpu_timer.h"
+#include "image.h"
+#include "indexed_drawing.h"
+#include "instancing.h"
+#include "mesh_file.h"
+#include "profiler.h"
+#include "program_cache.h"
+#include "render_thread.h"
+#include "shader.h"
+#include "shader_watcher.h"
+#include "stream_buffer.h"
+#include "stress_scene.h"
+#include "upload_worker.h"
+#include "window.h"
+
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef SHADER_DIR
+#define SHADER_DIR "shaders" //!< Where shader files are read from unless --shader-dir is given.
+#endif
+
+/**
+ * @brief Vertex shader drawn with while the real program is still compiling.
+ *
+ * With INSTANCED defined it places the instances the way the instanced shader
+ * does, so the fallback shows the scene's shape in flat grey.
+ */
+const char *fallbackVertexShaderSource = "#version 330 core \n"
+                                         "layout (location = 0) in vec3 aPos;\n"
+                                         "#ifdef INSTANCED\n"
+                                         "layout (location = 1) in vec2 aOffset;\n"
+                                         "layout (location = 3) in float aScale;\n"
+                                         "#endif\n"
+                                         "void main()\n"
+                                         "{\n"
+                                         "#ifdef INSTANCED\n"
+                                         "  gl_Position = vec4(aPos.xy * aScale + aOffset, aPos.z, 1.0);\n"
+                                         "#else\n"
+                                         "  gl_Position = vec4(aPos, 1.0);\n"
+                                         "#endif\n"
+                                         "}\0";
+
+/**
+ * @brief Fragment shader drawn with while the real program is still compiling.
+ */
+const char *fallbackFragmentShaderSource = "#version 330 core \n"
+                                           "out vec4 FragColor;\n"
+                                           "void main()\n"
+                                           "{\n"
+                                           "  FragColor = vec4(0.5f, 0.5f, 0.5f, 1.0f);\n"
+                                           "}\0";
+
+/**
+ * @brief Options selected on the command line.
+ */
+struct Options
+{
+    bool help;             //!< Print the usage and exit.
+    bool headless;         //!< Render offscreen instead of to a window.
+    unsigned long frames;  //!< Number of frames to render in headless mode.
+    bool gpuTiming;        //!< Time the passes of each frame on the GPU.
+    std::size_t triangles; //!< Number of triangles to draw.
+    bool sweep;            //!< Sweep the triangle count up to triangles in headless mode.
+    std::size_t instances; //!< Copies of the triangles to draw instanced, or 0 to draw them once.
+    bool instancingBench;  //!< Compare individual and instanced draws in headless mode.
+    bool streamingBench;   //!< Compare ways of re-uploading vertices every frame in headless mode.
+    bool indexedBench;     //!< Compare unindexed, indexed and cache-optimized draws in headless mode.
+    bool poolBench;        //!< Compare per-mesh buffers with a buffer pool in headless mode.
+    bool uploadBench;      //!< Compare loading before the first frame with loading in the background in headless mode.
+    bool loaderBench;      //!< Compare loading GL functions eagerly and lazily in headless mode.
+    bool eagerGl;          //!< Look up every GL function at startup instead of on first use.
+    const char *glTrace;   //!< File to write a trace of every GL call to, or NULL.
+    const char *profile;   //!< File to write the profiler zones to, or NULL.
+    bool glDebug;          //!< Create a debug context and have its messages delivered synchronously.
+    bool programCache;     //!< Load and store linked shader programs on disk.
+    const char *shaderDir; //!< Directory the shader files are read from.
+    bool watchShaders;     //!< Rebuild the program when its shader files change.
+    bool halfPositions;    //!< Store positions as x, y halves instead of x, y, z floats.
+    const char *meshPath;  //!< Mesh file to draw instead of the triangles, or NULL.
+    const char *capture;   //!< File to write the last headless frame to as a PPM image, or NULL.
+    double frameBudget;    //!< Most the p95 CPU frame time may be in headless mode, in milliseconds, or 0.
+};
+
+/**
+ * @brief Passes of a frame timed by the GPU timer.
+ */
+enum RenderPass
+{
+    PASS_CLEAR, //!< Clearing the framebuffer.
+    PASS_DRAW,  //!< Drawing the triangle.
+    PASS_COUNT
+};
+
+const char *const RENDER_PASS_NAMES[PASS_COUNT] = {"clear", "draw"}; //!< Names of the passes for reports.
+
+/**
+ * @brief A headless benchmark that draws with one shader program, run instead of the frame loop.
+ */
+struct ProgramBenchmark
+{
+    bool enabled;                          //!< Whether the command line asked for it.
+    const char *shader;                    //!< Shader files in the shader directory, without the extensions.
+    std::function<bool(unsigned int)> run; //!< Runs it with the program, returning false if it could not.
+};
+
+/**
+ * @brief Everything needed to render a frame.
+ */
+struct Scene
+{
+    GlStateCache state;           //!< Shadow GL state that all rendering goes through.
+    unsigned int shaderProgram;   //!< Program the triangle is drawn with.
+    ProgramCache *programs;       //!< Where the real program is coming from.
+    ProgramCache::Ticket ticket;  //!< The real program, while it is compiling.
+    bool programPending;          //!< Drawing with the fallback until the real program is ready.
+    bool programOnWorker;         //!< The pending program is building on the upload worker, not through programs.
+    std::uint32_t programUpload;  //!< Id of the upload building it, if programOnWorker.
+    unsigned int fallbackProgram; //!< Program drawn with while compiling, or 0 if none was needed.
+    unsigned long fallbackFrames; //!< Frames drawn with the fallback program.
+    std::string shaderPath;       //!< Shader files, without the .vert and .frag extensions.
+    ShaderWatcher *watcher;       //!< Reports edits to the shader files, or NULL to not reload.
+    bool reloadQueued;            //!< The files changed while a program was still building.
+    unsigned long reloads;        //!< Edited programs swapped in.
+    unsigned int VAO;             //!< Vertex array holding the triangle.
+    unsigned int VBO;             //!< Vertex buffer holding the triangle.
+    GLsizei vertexCount;          //!< Number of vertices to draw, if drawing unindexed.
+    unsigned int EBO;             //!< Element buffer holding the indices, if drawing a mesh file.
+    UploadWorker *uploads;        //!< Loads the mesh file in the background, or NULL to load it before the first frame.
+    GlDebugLog *debug;            //!< Collects the driver's debug messages, or NULL if it has no debug output.
+    bool meshPending;             //!< Drawing the triangle until the mesh file is uploaded.
+    unsigned long meshWaitFrames; //!< Frames drawn while the mesh file was loading.
+    std::string meshPath;         //!< The mesh file, for reports.
+    GLsizei indexCount;           //!< Number of indices to draw, or 0 to draw unindexed.
+    GLenum indexType;             //!< Type of the indices.
+    unsigned int instanceVBO;     //!< Buffer holding the instances, if drawing instanced.
+    GLsizei instanceCount;        //!< Number of instances to draw, or 0 to draw without instancing.
+    GpuTimer *timer;              //!< Times the passes on the GPU, or NULL to not time them.
+};
+
+/**
+ * @brief Parses the command line.
+ *
+ * @param argc number of arguments
+ * @param argv the arguments
+ * @param options receives the parsed options
+ * @return true if the command line was valid
+ */
+bool parseOptions(int argc, char *argv[], Options &options);
+
+/**
+ * @brief Prints the command line usage.
+ *
+ * @param program name the program was invoked with
+ */
+void printUsage(const char *program);
+
+/**
+ * @brief Builds the shader program and geometry of the scene.
+ *
+ * Set scene.watcher first to have the shader files watched, and scene.uploads
+ * to have the mesh file loaded in the background. Uses the shader
+ * directory, triangle count, instance count, half positions and mesh file
+ * options; more than one triangle are generated procedurally.
+ *
+ * @param scene the scene to set up
+ * @param programs cache to get the shader program from
+ * @param options the command line options
+ * @return true if the shader files and mesh file could be read
+ */
+bool createScene(Scene &scene, ProgramCache &programs, const Options &options);
+
+/**
+ * @brief Reads a vertex and a fragment shader that share a name.
+ *
+ * @param path path of the files without the .vert and .frag extensions
+ * @param vertexSource receives the vertex shader
+ * @param fragmentSource receives the fragment shader
+ * @return true if both files were read
+ */
+bool readShaderSources(const std::string &path, std::string &vertexSource, std::string &fragmentSource);
+
+/**
+ * @brief Whether edited shaders need the upload worker's context to compile without stalling the render thread.
+ *
+ * Requires a current context with function pointers loaded.
+ *
+ * @param options the command line options
+ * @return true if shaders are watched and the driver has no GL_KHR_parallel_shader_compile
+ */
+bool needsCompileContext(const Options &options);
 
-#define UNUSED(x) (void)(x) //!< Voids unused parameters to resolve unnused parameters warnings.
+/**
+ * @brief Reads the scene's shader files and starts building a program from them.
+ *
+ * Without GL_KHR_parallel_shader_compile the driver compiles on the render
+ * thread when the program is first checked, so rebuilds go to the upload
+ * worker's context if there is one. Otherwise that is said once.
+ *
+ * @param scene the scene to build a program for
+ * @return true if the files were read and the build started
+ */
+bool requestSceneProgram(Scene &scene);
+
+/**
+ * @brief Swaps in the scene's new program once it is ready, without waiting.
+ *
+ * Also starts a rebuild when the shader files changed. Called at the start of
+ * each frame, so a program is never swapped partway through one. A program
+ * that fails to build is dropped and the current one kept.
+ *
+ * @param scene the scene to update
+ */
+void updateSceneProgram(Scene &scene);
+
+/**
+ * @brief Makes a finished program the scene's, if it linked.
+ *
+ * A program that did not link is deleted and the current one kept.
+ *
+ * @param scene the scene to update
+ * @param program the finished program
+ * @param linked whether it linked
+ */
+void swapSceneProgram(Scene &scene, unsigned int program, bool linked);
+
+/**
+ * @brief Takes what the upload worker has finished, without waiting: the mesh, and programs built there.
+ *
+ * Called at the start of each frame.
+ *
+ * @param scene the scene to update
+ */
+void updateSceneUploads(Scene &scene);
+
+/**
+ * @brief Makes a mesh the upload worker loaded the scene's.
+ *
+ * A mesh file that failed to load is reported and the triangle kept.
+ *
+ * @param scene the scene to update
+ * @param upload the mesh's upload
+ */
+void swapSceneMesh(Scene &scene, const Upload &upload);
+
+/**
+ * @brief Deletes the shader program and geometry of the scene.
+ *
+ * Stops the scene's upload worker, dropping a mesh or program still building there.
+ *
+ * @param scene the scene to clean up
+ */
+void destroyScene(Scene &scene);
+
+/**
+ * @brief Clears the current framebuffer and draws the triangle.
+ *
+ * @param scene the scene to draw
+ */
+void renderFrame(Scene &scene);
+
+/**
+ * @brief Writes the frame time and state call summary.
+ *
+ * @param cpuFrames CPU time of each frame
+ * @param scene the scene that was rendered
+ */
+void reportFrames(const FrameStats &cpuFrames, const Scene &scene);
+
+/**
+ * @brief Parses a positive whole number from the command line.
+ *
+ * @param text the argument
+ * @param value receives the number
+ * @return true if the argument is a positive whole number that fits in value
+ */
+bool parseCount(const char *text, unsigned long long &value);
 
 /**
- * @brief The most basic vertex shader source as a string.
+ * @brief Renders to a window until it is closed.
  *
- * This shader does no processing; it just forwards the data to the output.
+ * @param options the command line options
+ * @return exit code for the application
  */
-const char *vertexShaderSource = "#version 330 core \n"
-                                 "layout (location = 0) in vec3 aPos;\n"
-                                 "void main()\n"
-                                 "{\n"
-                                 "  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-                                 "}\0";
+int runWindowed(const Options &options);
 
 /**
- * @brief The most basic fragment shader source as a string.
+ * @brief Renders a fixed number of frames offscreen and reports frame times.
  *
- * This shader does no processing; it always outputs an orange-ish color.
+ * @param options the command line options
+ * @return exit code for the application
+ */
+int runHeadless(const Options &options);
+
+/**
+ * @brief Builds a benchmark's program, runs the benchmark and deletes the program again.
  *
+ * @param benchmark the benchmark to run
+ * @param state state cache the benchmark renders through
+ * @param programs cache to build the program with
+ * @param shaderDir directory of the shader files
+ * @return exit code for the application
  */
-const char *fragmentShaderSource = "#version 330 core \n"
-                                   "out vec4 FragColor;\n"
-                                   "void main()\n"
-                                   "{\n"
-                                   "  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-                                   "}\0";
+int runProgramBenchmark(const ProgramBenchmark &benchmark, GlStateCache &state, ProgramCache &programs,
+                        const char *shaderDir);
 
 /**
  * @brief Handler for resizing of the viewport with resizing of the window.
  *
+ * Runs on the event thread, so the new size is sent to the render thread
+ * rather than applied here.
+ *
  * @param window instance of the window being resized
  * @param width width of the window
  * @param height height of the window
@@ -59,177 +352,1091 @@ void processInput(GLFWwindow *window);
 const unsigned int WINDOW_WIDTH = 800;  //!< Window width.
 const unsigned int WINDOW_HEIGHT = 600; //!< Window height.
 
-int main()
+const unsigned long DEFAULT_HEADLESS_FRAMES = 1000;  //!< Frames rendered in headless mode by default.
+const unsigned long MAX_FRAMES = 1000000;            //!< Most frames --frames takes; their times are all kept.
+const unsigned long HEADLESS_WARMUP_FRAMES = 10;     //!< Frames rendered before timing starts.
+const std::size_t DEFAULT_BENCH_INSTANCES = 10000;   //!< Instances compared by default by --instancing-bench.
+const std::size_t DEFAULT_STREAM_TRIANGLES = 100000; //!< Triangles streamed by default by --streaming-bench.
+const std::size_t DEFAULT_INDEXED_TRIANGLES = 500000; //!< Triangles in the mesh drawn by default by --indexed-bench.
+const std::size_t DEFAULT_POOL_MESHES = 10000;        //!< Meshes drawn by default by --pool-bench.
+const std::size_t DEFAULT_UPLOAD_ASSETS = 64;         //!< Meshes and textures loaded by default by --upload-bench.
+
+int main(int argc, char *argv[])
 {
-    // Init and configure glwf.
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return -1;
+    }
+    if (options.help)
+    {
+        printUsage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    // The hooks go in before GL is loaded, so the trace covers setup too.
     //
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    if (options.glTrace != NULL)
+    {
+        glTraceStart();
+    }
+    if (options.profile != NULL)
+    {
+        profilerStart();
+    }
+
+    const int result = options.headless ? runHeadless(options) : runWindowed(options);
+
+    if (options.glTrace != NULL)
+    {
+        glTraceReport(std::cout);
+        if (glTraceWrite(options.glTrace))
+        {
+            std::cout << "  trace written to " << options.glTrace << std::endl;
+        }
+    }
+    if (options.profile != NULL)
+    {
+        profilerReport(std::cout);
+        if (profilerWrite(options.profile))
+        {
+            std::cout << "  profile written to " << options.profile << std::endl;
+        }
+    }
+
+    return result;
+}
+
+bool parseOptions(int argc, char *argv[], Options &options)
+{
+    options.help = false;
+    options.headless = false;
+    options.frames = DEFAULT_HEADLESS_FRAMES;
+    options.gpuTiming = false;
+    options.triangles = 1;
+    options.sweep = false;
+    options.instances = 0;
+    options.instancingBench = false;
+    options.streamingBench = false;
+    options.indexedBench = false;
+    options.poolBench = false;
+    options.uploadBench = false;
+    options.loaderBench = false;
+    options.eagerGl = false;
+    options.glTrace = NULL;
+    options.profile = NULL;
+    options.glDebug = false;
+    options.programCache = true;
+    options.shaderDir = SHADER_DIR;
+    options.watchShaders = false;
+    options.halfPositions = false;
+    options.meshPath = NULL;
+    options.capture = NULL;
+    options.frameBudget = 0.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0)
+        {
+            options.help = true;
+            return true;
+        }
+        else if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if (std::strcmp(argv[i], "--gpu-timing") == 0)
+        {
+            options.gpuTiming = true;
+        }
+        else if (std::strcmp(argv[i], "--sweep") == 0)
+        {
+            options.sweep = true;
+        }
+        else if (std::strcmp(argv[i], "--instancing-bench") == 0)
+        {
+            options.instancingBench = true;
+        }
+        else if (std::strcmp(argv[i], "--streaming-bench") == 0)
+        {
+            options.streamingBench = true;
+        }
+        else if (std::strcmp(argv[i], "--indexed-bench") == 0)
+        {
+            options.indexedBench = true;
+        }
+        else if (std::strcmp(argv[i], "--pool-bench") == 0)
+        {
+            options.poolBench = true;
+        }
+        else if (std::strcmp(argv[i], "--upload-bench") == 0)
+        {
+            options.uploadBench = true;
+        }
+        else if (std::strcmp(argv[i], "--loader-bench") == 0)
+        {
+            options.loaderBench = true;
+        }
+        else if (std::strcmp(argv[i], "--eager-gl") == 0)
+        {
+            options.eagerGl = true;
+        }
+        else if (std::strcmp(argv[i], "--gl-debug") == 0)
+        {
+            options.glDebug = true;
+        }
+        else if (std::strcmp(argv[i], "--no-program-cache") == 0)
+        {
+            options.programCache = false;
+        }
+        else if (std::strcmp(argv[i], "--watch") == 0)
+        {
+            options.watchShaders = true;
+        }
+        else if (std::strcmp(argv[i], "--half-positions") == 0)
+        {
+            options.halfPositions = true;
+        }
+        else if (std::strcmp(argv[i], "--mesh") == 0 && i + 1 < argc)
+        {
+            options.meshPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+        {
+            options.capture = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--frame-budget") == 0 && i + 1 < argc)
+        {
+            char *end;
+            options.frameBudget = std::strtod(argv[++i], &end);
+            if (*end != '\0' || options.frameBudget <= 0.0)
+            {
+                std::cout << "Invalid frame budget: " << argv[i] << std::endl;
+                return false;
+            }
+        }
+        else if (std::strcmp(argv[i], "--gl-trace") == 0 && i + 1 < argc)
+        {
+#ifdef GL_TRACE
+            options.glTrace = argv[++i];
+#else
+            std::cout << "--gl-trace needs a build with GL tracing: make GL_TRACE=1" << std::endl;
+            return false;
 #endif
+        }
+        else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+#ifdef PROFILING
+            options.profile = argv[++i];
+#else
+            std::cout << "--profile needs a build with profiling, which this one was configured without" << std::endl;
+            return false;
+#endif
+        }
+        else if (std::strcmp(argv[i], "--shader-dir") == 0 && i + 1 < argc)
+        {
+            options.shaderDir = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--instances") == 0 && i + 1 < argc)
+        {
+            unsigned long long instances;
+            if (!parseCount(argv[++i], instances) || instances > 0x7fffffff)
+            {
+                std::cout << "Invalid instance count: " << argv[i] << std::endl;
+                return false;
+            }
+            options.instances = (std::size_t)instances;
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            unsigned long long frames;
+            if (!parseCount(argv[++i], frames) || frames > MAX_FRAMES)
+            {
+                std::cout << "Invalid frame count: " << argv[i] << " (at most " << MAX_FRAMES << ")" << std::endl;
+                return false;
+            }
+            options.frames = (unsigned long)frames;
+        }
+        else if (std::strcmp(argv[i], "--triangles") == 0 && i + 1 < argc)
+        {
+            unsigned long long triangles;
+            if (!parseCount(argv[++i], triangles) || triangles > MAX_TRIANGLES)
+            {
+                std::cout << "Invalid triangle count: " << argv[i] << " (at most " << MAX_TRIANGLES << ")" << std::endl;
+                return false;
+            }
+            options.triangles = (std::size_t)triangles;
+        }
+        else
+        {
+            std::cout << "Unknown option: " << argv[i] << std::endl;
+            return false;
+        }
+    }
 
-    // Create a window / context using GLFW.
-    //
-    GLFWwindow *window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Work-Through: Learn OpenGL  |  Hello Window!", NULL, NULL);
-    if (window == NULL)
+    if ((options.sweep || options.instancingBench || options.streamingBench || options.indexedBench ||
+         options.poolBench || options.uploadBench || options.loaderBench) &&
+        !options.headless)
     {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+        std::cout << "--sweep and the --*-bench options require --headless" << std::endl;
+        return false;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback); // Set handler resizing.
 
-    // Init GLAD to get function pointers for OpenGL.
-    //
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    if ((options.capture != NULL || options.frameBudget > 0.0) && !options.headless)
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
+        std::cout << "--capture and --frame-budget require --headless" << std::endl;
+        return false;
+    }
+
+    if (options.halfPositions &&
+        (options.instances > 0 || options.instancingBench || options.streamingBench || options.indexedBench ||
+         options.poolBench || options.uploadBench || options.loaderBench))
+    {
+        std::cout << "--half-positions only applies to the scene without --instances and to --sweep" << std::endl;
+        return false;
     }
 
-    // Build shader program here for simplicity.
+    if (options.meshPath != NULL && (options.instances > 0 || options.halfPositions))
+    {
+        std::cout << "--mesh cannot be combined with --instances or --half-positions" << std::endl;
+        return false;
+    }
+
+    // Editing shaders while looking at the window is the point of watching.
     //
-    // Shaders are compiled and linked together into a kind of shader program,
-    // then used by OpenGL.
+    if (!options.headless)
+    {
+        options.watchShaders = true;
+    }
+
+    return true;
+}
+
+bool parseCount(const char *text, unsigned long long &value)
+{
+    char *end;
+    errno = 0;
+    value = std::strtoull(text, &end, 10);
+    return *text != '-' && *end == '\0' && errno != ERANGE && value > 0;
+}
+
+void printUsage(const char *program)
+{
+    std::cout << "usage: " << program << " [--headless] [--frames N] [--gpu-timing] [--triangles N] [--sweep]\n"
+              << "       [--instances N] [--instancing-bench] [--streaming-bench] [--indexed-bench] [--pool-bench]\n"
+              << "       [--upload-bench] [--loader-bench] [--eager-gl] [--gl-trace FILE] [--profile FILE]\n"
+              << "       [--gl-debug] [--no-program-cache] [--shader-dir DIR] [--watch] [--half-positions]\n"
+              << "       [--mesh FILE] [--capture FILE] [--frame-budget MS] [--help]\n"
+              << "  --headless      render offscreen and report frame times instead of opening a window\n"
+              << "  --frames N      number of frames to render in headless mode (default "
+              << DEFAULT_HEADLESS_FRAMES << ", at most " << MAX_FRAMES << ")\n"
+              << "  --gpu-timing    time the clear and draw passes on the GPU and report them\n"
+              << "  --triangles N   draw N procedurally generated triangles instead of one\n"
+              << "  --sweep         with --headless, draw 1, 10, 100, ... up to --triangles triangles and\n"
+              << "                  report triangles/second and upload bandwidth at each step\n"
+              << "  --instances N   draw N copies of the triangles with one instanced draw call\n"
+              << "  --instancing-bench\n"
+              << "                  with --headless, compare N individual draws against one instanced\n"
+              << "                  draw of --instances copies (default " << DEFAULT_BENCH_INSTANCES << ")\n"
+              << "  --streaming-bench\n"
+              << "                  with --headless, move and re-upload --triangles triangles every frame\n"
+              << "                  (default " << DEFAULT_STREAM_TRIANGLES << ") with glBufferData, glBufferSubData\n"
+              << "                  and a fenced ring buffer, and compare them\n"
+              << "  --indexed-bench\n"
+              << "                  with --headless, draw a grid mesh of --triangles triangles (default "
+              << DEFAULT_INDEXED_TRIANGLES << ")\n"
+              << "                  unindexed, indexed, and indexed after vertex cache optimization, and\n"
+              << "                  compare them\n"
+              << "  --pool-bench    with --headless, draw --instances small meshes (default " << DEFAULT_POOL_MESHES
+              << ")\n"
+              << "                  from buffers of their own and from a shared buffer pool, compare them,\n"
+              << "                  and defragment the pool\n"
+              << "  --upload-bench  with --headless, load --instances meshes with a texture each (default "
+              << DEFAULT_UPLOAD_ASSETS << ")\n"
+              << "                  before the first frame and on a background upload thread while\n"
+              << "                  rendering, and compare them\n"
+              << "  --loader-bench  with --headless, load the GL functions eagerly and lazily --frames times,\n"
+              << "                  drawing a first frame after each, and compare them\n"
+              << "  --eager-gl      look up every GL function at startup instead of on its first call\n"
+              << "  --gl-trace FILE write every GL call, its CPU time and frame to FILE as Chrome trace JSON,\n"
+              << "                  and report the functions taking the most time; needs a build with\n"
+              << "                  GL_TRACE=1\n"
+              << "  --profile FILE  write the profiler zones of each frame, such as clear, draw and swap, to FILE\n"
+              << "                  as Chrome trace JSON, and report their times; needs a build with profiling,\n"
+              << "                  the default\n"
+              << "  --gl-debug      create a debug context, so the driver reports more performance warnings\n"
+              << "                  and errors, and deliver them during the call that caused them\n"
+              << "  --no-program-cache\n"
+              << "                  always compile shaders from source instead of loading linked programs\n"
+              << "                  from " << ProgramCache::defaultDirectory() << "\n"
+              << "  --shader-dir DIR\n"
+              << "                  read the shader files from DIR (default " << SHADER_DIR << ")\n"
+              << "  --watch         with --headless, rebuild the program when its shader files change;\n"
+              << "                  always on in a window\n"
+              << "  --half-positions\n"
+              << "                  store positions as two halves (4 bytes) instead of three floats\n"
+              << "                  (12 bytes), in the scene and in --sweep\n"
+              << "  --mesh FILE     draw a mesh file made by mesh-convert instead of the triangles; it is\n"
+              << "                  loaded in the background while the triangle is drawn\n"
+              << "  --capture FILE  with --headless, write the last frame to FILE as a PPM image\n"
+              << "  --frame-budget MS\n"
+              << "                  with --headless, fail if the p95 CPU frame time is over MS milliseconds\n"
+              << "  --help, -h      print this and exit"
+              << std::endl;
+}
+
+bool createScene(Scene &scene, ProgramCache &programs, const Options &options)
+{
+    const std::size_t triangles = options.triangles;
+    const std::size_t instances = options.instances;
+
+    // Build shader program here for simplicity. After the first launch it
+    // usually comes straight from the cache. Otherwise it compiles while the
+    // first frames are drawn with a program that is quick to build.
     //
-    // Compile the vertex shader.
+    scene.programs = &programs;
+    scene.shaderPath = std::string(options.shaderDir) + (instances > 0 ? "/instanced" : "/hello_triangle");
+    scene.shaderProgram = 0;
+    scene.programPending = false;
+    scene.programOnWorker = false;
+    scene.programUpload = 0;
+    scene.fallbackProgram = 0;
+    scene.fallbackFrames = 0;
+    scene.reloadQueued = false;
+    scene.reloads = 0;
+    if (!requestSceneProgram(scene))
+    {
+        return false;
+    }
+    updateSceneProgram(scene);
+    if (scene.shaderProgram == 0)
+    {
+        scene.fallbackProgram = programs.build(fallbackVertexShaderSource, fallbackFragmentShaderSource,
+                                               instances > 0 ? "#define INSTANCED\n" : "");
+        scene.shaderProgram = scene.fallbackProgram;
+    }
+
+    if (scene.watcher != NULL)
+    {
+        scene.watcher->watch(scene.shaderPath + ".vert");
+        scene.watcher->watch(scene.shaderPath + ".frag");
+    }
+
+    scene.EBO = 0;
+    scene.indexCount = 0;
+    scene.indexType = GL_UNSIGNED_INT;
+    scene.instanceVBO = 0;
+    scene.instanceCount = 0;
+    scene.meshPending = false;
+    scene.meshWaitFrames = 0;
+    scene.meshPath = options.meshPath != NULL ? options.meshPath : "";
+
+    // With an upload worker the mesh file loads on its thread, and the
+    // triangle is drawn until it is ready, like the fallback program.
     //
-    unsigned int vertexShader;
-    vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
+    if (options.meshPath != NULL && scene.uploads != NULL)
+    {
+        scene.uploads->submit(meshFileJob(options.meshPath));
+        scene.meshPending = true;
+    }
 
-    // Ensure vertex shader compiled successfully.
+    // Without one, the mesh file goes straight from the mapped file into the
+    // buffers before the first frame.
     //
-    int successful;
-    char infolog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &successful);
-    if (!successful)
+    if (options.meshPath != NULL && scene.uploads == NULL)
     {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-                  << infolog << std::endl;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        MeshFile mesh;
+        if (!mesh.open(options.meshPath))
+        {
+            return false;
+        }
+        createMeshVertexArray(scene.state, mesh, scene.VAO, scene.VBO, scene.EBO);
+        scene.vertexCount = 0;
+        scene.indexCount = (GLsizei)mesh.header().indexCount;
+        scene.indexType = mesh.header().indexType;
+        glFinish();
+        std::cout << "Loaded " << options.meshPath << ": " << mesh.header().vertexCount << " vertices, "
+                  << mesh.header().indexCount / 3 << " triangles, " << mesh.size() / 1.0e6 << " MB in "
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+                  << " ms" << std::endl;
+        return true;
     }
 
-    // Compile the fragment shader.
+    // Create the vertices and buffers necessary to render.
     //
-    unsigned int fragmentShader;
-    fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
+    std::vector<float> vertices;
+    if (triangles == 1)
+    {
+        // clang-format off
+        const float triangle[] = {
+            -0.5f, -0.5f, 0.0f, // Left.
+             0.5f, -0.5f, 0.0f, // Right.
+             0.0f,  0.5f, 0.0f  // Top.
+        };
+        // clang-format on
 
-    // Ensure fragment shader compiled successfully.
+        vertices.assign(triangle, triangle + sizeof(triangle) / sizeof(triangle[0]));
+    }
+    else
+    {
+        generateTriangles(triangles, vertices);
+    }
+
+    if (options.halfPositions)
+    {
+        std::vector<Half> halves;
+        packHalfPositions(vertices, halves);
+        createVertexArray<HalfPositionLayout>(scene.state, &halves[0], halves.size() * sizeof(Half), scene.VAO, scene.VBO);
+    }
+    else
+    {
+        createVertexArray<PositionLayout>(scene.state, &vertices[0], vertices.size() * sizeof(float), scene.VAO, scene.VBO);
+    }
+    scene.vertexCount = (GLsizei)(triangles * VERTICES_PER_TRIANGLE);
+
+    // To draw copies, swap in a vertex array that adds the instance attributes
+    // to the same vertex buffer.
     //
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &successful);
-    if (!successful)
+    scene.instanceCount = (GLsizei)instances;
+    if (instances > 0)
     {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-                  << infolog << std::endl;
+        std::vector<Instance> copies;
+        generateInstances(instances, copies);
+
+        unsigned int meshVAO = scene.VAO;
+        createInstancedVertexArray(scene.state, scene.VBO, copies, scene.VAO, scene.instanceVBO);
+        scene.state.deleteVertexArray(meshVAO);
     }
 
-    // Now that we have shaders, we link them into a shader program.
+    // Uncomment to display as wireframe.
     //
-    unsigned int shaderProgram;
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
+    // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-    // Ensure the shader program built successfully.
+    return true;
+}
+
+bool readShaderSources(const std::string &path, std::string &vertexSource, std::string &fragmentSource)
+{
+    return readShaderFile(path + ".vert", vertexSource) && readShaderFile(path + ".frag", fragmentSource);
+}
+
+bool needsCompileContext(const Options &options)
+{
+    return options.watchShaders && !GLAD_GL_KHR_parallel_shader_compile;
+}
+
+bool requestSceneProgram(Scene &scene)
+{
+    std::string vertexSource;
+    std::string fragmentSource;
+    if (!readShaderSources(scene.shaderPath, vertexSource, fragmentSource))
+    {
+        return false;
+    }
+    scene.programPending = true;
+
+    // The first build stays with the cache, which usually has it, and the
+    // fallback program covers it when it does not.
     //
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &successful);
-    if (!successful)
+    scene.programOnWorker = scene.shaderProgram != 0 && !GLAD_GL_KHR_parallel_shader_compile && scene.uploads != NULL;
+    if (scene.programOnWorker)
+    {
+        scene.programUpload = scene.uploads->submit(shaderProgramJob(vertexSource, fragmentSource));
+        return true;
+    }
+    if (scene.shaderProgram != 0 && !GLAD_GL_KHR_parallel_shader_compile)
     {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
-                  << infolog << std::endl;
+        static bool warned = false;
+        if (!warned)
+        {
+            std::cout << "No GL_KHR_parallel_shader_compile and no upload context; shader reloads compile on the "
+                         "render thread and stall it"
+                      << std::endl;
+            warned = true;
+        }
     }
+    scene.ticket = scene.programs->buildAsync(vertexSource.c_str(), fragmentSource.c_str());
+    return true;
+}
 
-    // Clean up - source objects are no longer needed.
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+void updateSceneProgram(Scene &scene)
+{
+    // A save can arrive while the previous edit is still compiling; it is
+    // picked up once that one is done.
+    //
+    if (scene.watcher != NULL && scene.watcher->poll())
+    {
+        scene.reloadQueued = true;
+    }
+    if (scene.reloadQueued && !scene.programPending)
+    {
+        scene.reloadQueued = false;
+        requestSceneProgram(scene);
+    }
+    if (!scene.programPending || scene.programOnWorker)
+    {
+        return;
+    }
 
-    // End build of shader program.
+    if (!scene.programs->poll())
+    {
+        if (scene.shaderProgram == scene.fallbackProgram)
+        {
+            ++scene.fallbackFrames;
+        }
+        return;
+    }
+    scene.programPending = false;
+    swapSceneProgram(scene, scene.programs->program(scene.ticket), scene.programs->linked(scene.ticket));
+}
 
-    // Create the vertices and buffers necessary to render.
+void swapSceneProgram(Scene &scene, unsigned int program, bool linked)
+{
+    if (!linked)
+    {
+        std::cout << "Keeping the previous program; " << scene.shaderPath << " did not build" << std::endl;
+        scene.state.deleteProgram(program);
+        return;
+    }
 
-    // clang-format off
-    float vertices[] = {
-        -0.5f, -0.5f, 0.0f, // Left.
-         0.5f, -0.5f, 0.0f, // Right.
-         0.0f,  0.5f, 0.0f  // Top.
-    };
-    // clang-format on
+    const unsigned int previous = scene.shaderProgram;
+    scene.shaderProgram = program;
+    if (previous != 0 && previous != scene.fallbackProgram)
+    {
+        scene.state.deleteProgram(previous);
+        ++scene.reloads;
+        std::cout << "Reloaded " << scene.shaderPath << std::endl;
+    }
+}
 
-    unsigned int VBO; // Vertex buffer object.
-    unsigned int VAO; // Vertex buffer array.
+void updateSceneUploads(Scene &scene)
+{
+    if (!scene.meshPending && !scene.programOnWorker)
+    {
+        return;
+    }
 
-    glGenVertexArrays(1, &VAO); // Generate a vertex buffer array.
-    glGenBuffers(1, &VBO);      // Generate a vertex buffer object.
-    glBindVertexArray(VAO);     // Bind the vertex array first.
+    // Uploads come back in the order they were submitted, so the next one
+    // may be the mesh or a program.
+    //
+    Upload upload;
+    while (scene.uploads->poll(upload))
+    {
+        if (scene.programOnWorker && upload.id == scene.programUpload)
+        {
+            scene.programOnWorker = false;
+            scene.programPending = false;
+            swapSceneProgram(scene, upload.program, upload.loaded);
+        }
+        else
+        {
+            swapSceneMesh(scene, upload);
+        }
+    }
+    if (scene.meshPending)
+    {
+        ++scene.meshWaitFrames;
+    }
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);                                        // Bind the vertex buffer object.
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // Set the buffer data using the array of vertices.
+void swapSceneMesh(Scene &scene, const Upload &upload)
+{
+    scene.meshPending = false;
+    if (!upload.loaded)
+    {
+        std::cout << "Keeping the triangle; " << scene.meshPath << " did not load" << std::endl;
+        return;
+    }
 
-    // Specify how the vertex data should be interpreted.
+    // The triangle's buffers are only ever read by this context, so they go
+    // right away; the mesh's buffers become the scene's.
     //
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
+    scene.state.deleteVertexArray(scene.VAO);
+    scene.state.deleteBuffer(scene.VBO);
+    scene.VAO = createUploadVertexArray(scene.state, upload);
+    scene.VBO = upload.vertexBuffer;
+    scene.EBO = upload.elementBuffer;
+    scene.vertexCount = 0;
+    scene.indexCount = upload.indexCount;
+    scene.indexType = upload.indexType;
+    std::cout << "Loaded " << scene.meshPath << " in the background: " << upload.indexCount / 3 << " triangles, "
+              << upload.bytes / 1.0e6 << " MB in " << upload.loadMs << " ms, " << scene.meshWaitFrames
+              << " frames drawn meanwhile" << std::endl;
+}
+
+void destroyScene(Scene &scene)
+{
+    if (scene.uploads != NULL)
+    {
+        scene.uploads->stop();
+    }
+    scene.state.deleteVertexArray(scene.VAO);
+    scene.state.deleteBuffer(scene.VBO);
+    if (scene.EBO != 0)
+    {
+        scene.state.deleteBuffer(scene.EBO);
+    }
+    if (scene.instanceVBO != 0)
+    {
+        scene.state.deleteBuffer(scene.instanceVBO);
+    }
+    if (scene.programPending && !scene.programOnWorker)
+    {
+        scene.programs->finishAll();
+        scene.state.deleteProgram(scene.programs->program(scene.ticket));
+    }
+    if (scene.shaderProgram != scene.fallbackProgram)
+    {
+        scene.state.deleteProgram(scene.shaderProgram);
+    }
+    if (scene.fallbackProgram != 0)
+    {
+        scene.state.deleteProgram(scene.fallbackProgram);
+    }
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0); // Safely unbind since VBO is now registered as vertex attributes bound vertex.
-    glBindVertexArray(0);             // Safely unbind the VAO but this usually isn't necessary.
+void renderFrame(Scene &scene)
+{
+    GpuTimer *timer = scene.timer;
+    GlStateCache &state = scene.state;
 
-    // Uncomment to display as wireframe.
-    //
-    // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    if (scene.debug != NULL)
+    {
+        scene.debug->nextFrame();
+    }
 
-    // Rendering loop.
+    // Switch to a new program as soon as the driver has it, without waiting.
     //
-    // An iteration of the loop is typically referred to as a frame.
-    //
-    while (!glfwWindowShouldClose(window))
+    updateSceneProgram(scene);
+    updateSceneUploads(scene);
+
+    state.beginFrame();
+    if (timer != NULL)
     {
-        // Call the input handler first.
-        //
-        processInput(window);
+        timer->beginFrame();
+        timer->beginPass(PASS_CLEAR);
+    }
+
+    {
+        PROFILE_ZONE("clear");
 
-        // Render.
-        //
         // I changed this to a nicer color than the ugly green set in the book.
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        //
+        // Only the first frame actually sets it; the cache drops the rest.
+        state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    if (timer != NULL)
+    {
+        timer->endPass();
+        timer->beginPass(PASS_DRAW);
+    }
+
+    {
+        PROFILE_ZONE("draw");
 
         // Draw a triangle!
         //
-        glUseProgram(shaderProgram); // Set shader program in OpenGL.
-        glBindVertexArray(VAO);      // Binds the vertex array every frame.
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        state.useProgram(scene.shaderProgram); // Set shader program in OpenGL.
+        state.bindVertexArray(scene.VAO);      // Only binds when it isn't bound already.
+        if (scene.indexCount > 0)
+        {
+            glDrawElements(GL_TRIANGLES, scene.indexCount, scene.indexType, (void *)0);
+        }
+        else if (scene.instanceCount > 0)
+        {
+            glDrawArraysInstanced(GL_TRIANGLES, 0, scene.vertexCount, scene.instanceCount);
+        }
+        else
+        {
+            glDrawArrays(GL_TRIANGLES, 0, scene.vertexCount);
+        }
         // glBindVertexArray(0); // NOTE: Unbinding isn't necessary every frame.
+    }
+
+    if (timer != NULL)
+    {
+        timer->endFrame();
+    }
+}
+
+void reportFrames(const FrameStats &cpuFrames, const Scene &scene)
+{
+    cpuFrames.report(std::cout, "cpu frame");
+    if (scene.timer != NULL)
+    {
+        scene.timer->report(std::cout);
+    }
+    if (scene.debug != NULL)
+    {
+        scene.debug->report(std::cout);
+    }
+
+    // The last frame shows the steady state; the total includes setup.
+    //
+    const GlStateCache::Counters &lastFrame = scene.state.frame();
+    const GlStateCache::Counters &total = scene.state.total();
+    std::cout << "  state calls       last frame " << lastFrame.issued << " issued, " << lastFrame.elided << " elided"
+              << "  |  total " << total.issued << " issued, " << total.elided << " elided" << std::endl;
+    if (scene.reloads > 0)
+    {
+        std::cout << "  shader reloads    " << scene.reloads << std::endl;
+    }
+    if (scene.fallbackProgram != 0)
+    {
+        std::cout << "  fallback program  " << scene.fallbackFrames << " frames before the real program was ready"
+                  << std::endl;
+    }
+}
 
-        // Check events, then swap the front/back buffers via glfw.
+int runWindowed(const Options &options)
+{
+    // Create a window / context using GLFW, and init GLAD to get function
+    // pointers for OpenGL. Unless --eager-gl is given, each is only looked up
+    // on its first call; a few dozen of the hundreds there are ever get called.
+    //
+    Window mainWindow;
+    if (!mainWindow.create(WINDOW_WIDTH, WINDOW_HEIGHT, "Work-Through: Learn OpenGL  |  Hello Window!", options.glDebug,
+                           options.eagerGl))
+    {
+        return -1;
+    }
+    GLFWwindow *window = mainWindow.handle();
+    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback); // Resizes go to the render thread.
+
+    // A mesh file is loaded by an upload worker, with a context of its own
+    // that shares objects with the window's. GLFW only makes contexts along
+    // with windows, so it comes with a hidden one. Drivers that cannot compile
+    // shaders in the background get it too, to rebuild edited ones there.
+    //
+    Window uploadWindow;
+    if ((options.meshPath != NULL || needsCompileContext(options)) && !uploadWindow.createShared(mainWindow))
+    {
+        std::cout << "Failed to create GLFW upload context; loading and compiling on the render thread" << std::endl;
+    }
+
+    // Hand the context to the render thread. From here on this thread only
+    // handles events and input, and talks to the render thread through commands.
+    //
+    Scene scene;
+    GpuTimer gpuTimer;
+    scene.timer = NULL;
+    scene.uploads = NULL;
+    scene.debug = NULL;
+    ProgramCache programs;
+    programs.setEnabled(options.programCache);
+    ShaderWatcher watcher;
+    scene.watcher = options.watchShaders ? &watcher : NULL;
+    UploadWorker uploads;
+    GlDebugLog debugLog;
+
+    RenderCallbacks callbacks;
+    callbacks.setup = [&]()
+    {
+        if (debugLog.install(std::cout, options.glDebug))
+        {
+            scene.debug = &debugLog;
+        }
+        if (uploadWindow.handle() != NULL)
+        {
+            uploads.start(
+                [&uploadWindow]()
+                {
+                    return uploadWindow.makeCurrent();
+                },
+                [&uploadWindow]()
+                {
+                    uploadWindow.release();
+                });
+            scene.uploads = &uploads;
+        }
+        if (!createScene(scene, programs, options))
+        {
+            return false;
+        }
+        if (options.gpuTiming && gpuTimer.create(RENDER_PASS_NAMES, PASS_COUNT))
+        {
+            scene.timer = &gpuTimer;
+        }
+        return true;
+    };
+    callbacks.frame = [&]()
+    {
+        renderFrame(scene);
+    };
+    callbacks.resize = [&](int width, int height)
+    {
+        scene.state.viewport(0, 0, width, height);
+    };
+    callbacks.teardown = [&]()
+    {
+        if (scene.timer != NULL)
+        {
+            scene.timer->flush();
+        }
+        gpuTimer.destroy();
+
+        // Clean up after render loop has returned.
         //
-        glfwPollEvents();
-        glfwSwapBuffers(window);
+        destroyScene(scene);
+
+        // The log outlives the render thread for the report, but the context
+        // is only current here.
+        //
+        debugLog.uninstall();
+    };
+
+    RenderThread renderThread;
+    glfwSetWindowUserPointer(window, &renderThread);
+    renderThread.start(window, callbacks);
+
+    // Event loop.
+    //
+    // Sleeps until there are events, so it costs nothing while idle and reacts
+    // to input right away. The render thread wakes it when it stops.
+    //
+    PROFILE_THREAD("event thread");
+    while (!glfwWindowShouldClose(window) && renderThread.running())
+    {
+        {
+            PROFILE_ZONE("poll");
+            glfwWaitEvents();
+        }
+        PROFILE_ZONE("input");
+        processInput(window);
     }
+    renderThread.stop();
+    glfwSetWindowUserPointer(window, NULL);
+    uploadWindow.destroy();
 
-    // Clean up after render loop has returned.
+    // Report frame times once the window is closed.
     //
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shaderProgram);
+    std::cout << renderThread.frameStats().added() << " frames" << std::endl;
+    reportFrames(renderThread.frameStats(), scene);
+    programs.report(std::cout);
 
     // Clean up after glfw.
     //
-    glfwTerminate();
+    mainWindow.destroy();
 
     return EXIT_SUCCESS;
 }
 
+int runHeadless(const Options &options)
+{
+    // Render offscreen instead of to a window; no display is needed.
+    //
+    Window window;
+    if (!window.createHeadless(WINDOW_WIDTH, WINDOW_HEIGHT, options.glDebug, options.eagerGl))
+    {
+        return -1;
+    }
+
+    Scene scene;
+    GpuTimer gpuTimer;
+    scene.timer = NULL;
+    scene.uploads = NULL;
+    ProgramCache programs;
+    programs.setEnabled(options.programCache);
+    ShaderWatcher watcher;
+    scene.watcher = options.watchShaders ? &watcher : NULL;
+
+    // Driver warnings are written out as they arrive, for the benchmarks too.
+    //
+    GlDebugLog debugLog;
+    scene.debug = debugLog.install(std::cout, options.glDebug) ? &debugLog : NULL;
+
+    if (options.loaderBench)
+    {
+        runLoaderBenchmark(window.glLoader(), options.frames,
+                           [&]()
+                           {
+                               Scene frameScene;
+                               frameScene.timer = NULL;
+                               frameScene.uploads = NULL;
+                               frameScene.debug = NULL;
+                               frameScene.watcher = NULL;
+                               if (createScene(frameScene, programs, options))
+                               {
+                                   programs.finishAll();
+                                   renderFrame(frameScene);
+                                   glFinish();
+                                   destroyScene(frameScene);
+                               }
+                           },
+                           std::cout);
+        return EXIT_SUCCESS;
+    }
+
+    // Uploads go through a second context sharing objects with the first,
+    // made current on the worker's thread. Declared after the window, so it
+    // is destroyed first.
+    //
+    Window uploadWindow;
+    const std::function<bool()> makeUploadContextCurrent = [&uploadWindow]()
+    {
+        return uploadWindow.makeCurrent();
+    };
+    const std::function<void()> releaseUploadContext = [&uploadWindow]()
+    {
+        uploadWindow.release();
+    };
+
+    // The benchmarks make their own geometry and only need a program.
+    //
+    const ProgramBenchmark benchmarks[] = {
+        {options.sweep, "hello_triangle",
+         [&](unsigned int program) -> bool
+         {
+             runStressSweep(scene.state, program, options.triangles, options.frames, options.halfPositions, std::cout);
+             return true;
+         }},
+        {options.instancingBench, "instanced",
+         [&](unsigned int program) -> bool
+         {
+             runInstancingBenchmark(scene.state, program,
+                                    options.instances > 0 ? options.instances : DEFAULT_BENCH_INSTANCES,
+                                    options.frames, std::cout);
+             return true;
+         }},
+        {options.streamingBench, "hello_triangle",
+         [&](unsigned int program) -> bool
+         {
+             runStreamingBenchmark(scene.state, program,
+                                   options.triangles > 1 ? options.triangles : DEFAULT_STREAM_TRIANGLES,
+                                   options.frames, std::cout);
+             return true;
+         }},
+        {options.indexedBench, "hello_triangle",
+         [&](unsigned int program) -> bool
+         {
+             return runIndexedBenchmark(scene.state, program,
+                                        options.triangles > 1 ? options.triangles : DEFAULT_INDEXED_TRIANGLES,
+                                        options.frames, std::cout);
+         }},
+        {options.poolBench, "hello_triangle",
+         [&](unsigned int program) -> bool
+         {
+             runBufferPoolBenchmark(scene.state, program,
+                                    options.instances > 0 ? options.instances : DEFAULT_POOL_MESHES,
+                                    options.frames, std::cout);
+             return true;
+         }},
+        {options.uploadBench, "hello_triangle",
+         [&](unsigned int program) -> bool
+         {
+             if (!uploadWindow.createShared(window))
+             {
+                 return false;
+             }
+             runUploadBenchmark(scene.state, program, options.instances > 0 ? options.instances : DEFAULT_UPLOAD_ASSETS,
+                                options.frames, makeUploadContextCurrent, releaseUploadContext, std::cout);
+             return true;
+         }},
+    };
+    for (std::size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); ++i)
+    {
+        if (benchmarks[i].enabled)
+        {
+            return runProgramBenchmark(benchmarks[i], scene.state, programs, options.shaderDir);
+        }
+    }
+
+    UploadWorker uploads;
+    if (options.meshPath != NULL || needsCompileContext(options))
+    {
+        if (uploadWindow.createShared(window))
+        {
+            uploads.start(makeUploadContextCurrent, releaseUploadContext);
+            scene.uploads = &uploads;
+        }
+        else
+        {
+            std::cout << "Failed to create upload context; loading and compiling on the render thread" << std::endl;
+        }
+    }
+
+    if (!createScene(scene, programs, options))
+    {
+        return -1;
+    }
+
+    // Let the driver finish any lazy setup before timing starts, and make sure
+    // the timed frames draw with the real program rather than the fallback,
+    // and the mesh rather than the triangle standing in for it.
+    //
+    const std::function<void()> draw = [&scene]()
+    {
+        renderFrame(scene);
+    };
+    for (unsigned long frame = 0; frame < HEADLESS_WARMUP_FRAMES || scene.meshPending; ++frame)
+    {
+        runFrameLoop(window, scene.state, NULL, draw, NULL, 1);
+    }
+    programs.finishAll();
+    runFrameLoop(window, scene.state, NULL, draw, NULL, 1);
+
+    if (options.gpuTiming && gpuTimer.create(RENDER_PASS_NAMES, PASS_COUNT))
+    {
+        scene.timer = &gpuTimer;
+    }
+
+    // Each frame waits for the GPU with glFinish, which stands in for the
+    // buffer swap, so a sample covers both submission and execution.
+    //
+    FrameStats cpuFrames(options.frames);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    runFrameLoop(window, scene.state, NULL, draw, &cpuFrames, options.frames);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Headless: " << options.frames << " frames at " << window.width() << "x" << window.height()
+              << " on " << glGetString(GL_RENDERER) << "\n"
+              << "  " << seconds << " s, " << (double)options.frames / seconds << " fps, "
+              << (double)(scene.indexCount > 0 ? (std::size_t)scene.indexCount / 3 : options.triangles) *
+                     (double)(options.instances > 0 ? options.instances : 1) * (double)options.frames / seconds / 1.0e6
+              << " Mtriangles/s" << std::endl;
+    if (scene.timer != NULL)
+    {
+        scene.timer->flush();
+    }
+    reportFrames(cpuFrames, scene);
+    programs.report(std::cout);
+
+    // The last frame is still in the target.
+    //
+    bool passed = checkFrameBudget(cpuFrames, options.frameBudget);
+    if (options.capture != NULL)
+    {
+        passed = captureFramebuffer(options.capture, window.width(), window.height()) && passed;
+    }
+
+    // The window is declared before the debug log, so the context is still
+    // there when the log removes its callback on the way out.
+    //
+    gpuTimer.destroy();
+    destroyScene(scene);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int runProgramBenchmark(const ProgramBenchmark &benchmark, GlStateCache &state, ProgramCache &programs,
+                        const char *shaderDir)
+{
+    std::string vertexSource;
+    std::string fragmentSource;
+    if (!readShaderSources(std::string(shaderDir) + "/" + benchmark.shader, vertexSource, fragmentSource))
+    {
+        return -1;
+    }
+    unsigned int shaderProgram = programs.build(vertexSource.c_str(), fragmentSource.c_str());
+    const bool ran = benchmark.run(shaderProgram);
+    state.deleteProgram(shaderProgram);
+    return ran ? EXIT_SUCCESS : -1;
+}
+
 void processInput(GLFWwindow *window)
 {
     // If escape key is pressed, close the window.
@@ -244,6 +1451,13 @@ void framebufferSizeCallback(GLFWwindow *window, int width, int height)
 {
     // Whenever the window size changes, change the view port size to match.
     //
-    glViewport(0, 0, width, height);
-    UNUSED(window);
+    RenderThread *renderThread = (RenderThread *)glfwGetWindowUserPointer(window);
+    if (renderThread != NULL)
+    {
+        RenderCommand resize;
+        resize.type = RenderCommand::RESIZE;
+        resize.width = width;
+        resize.height = height;
+        renderThread->post(resize);
+    }
 }
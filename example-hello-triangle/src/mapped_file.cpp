@@ -0,0 +1,104 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Read-only access to a whole file without copying it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "mapped_file.h"
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+
+MappedFile::MappedFile()
+    : data_(NULL), size_(0), mapped_(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string &path)
+{
+    close();
+
+#ifdef HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    if (status.st_size == 0)
+    {
+        ::close(fd); // Nothing to map; mmap rejects a length of zero.
+        return true;
+    }
+    void *mapping = mmap(NULL, (std::size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file open.
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    // Callers read the whole file front to back, so ask for aggressive
+    // read-ahead rather than faulting it in a page at a time.
+    //
+    madvise(mapping, (std::size_t)status.st_size, MADV_SEQUENTIAL);
+    madvise(mapping, (std::size_t)status.st_size, MADV_WILLNEED);
+
+    data_ = (const unsigned char *)mapping;
+    size_ = (std::size_t)status.st_size;
+    mapped_ = true;
+#else
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long length = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    fallback_.resize(length > 0 ? (std::size_t)length : 0);
+    const bool read = length >= 0 && (fallback_.empty() ||
+                                      std::fread(&fallback_[0], 1, fallback_.size(), file) == fallback_.size());
+    std::fclose(file);
+    if (!read)
+    {
+        std::vector<unsigned char>().swap(fallback_);
+        return false;
+    }
+    data_ = fallback_.empty() ? NULL : &fallback_[0];
+    size_ = fallback_.size();
+#endif
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifdef HAVE_MMAP
+    if (mapped_)
+    {
+        munmap((void *)data_, size_);
+    }
+#endif
+    std::vector<unsigned char>().swap(fallback_);
+    data_ = NULL;
+    size_ = 0;
+    mapped_ = false;
+}
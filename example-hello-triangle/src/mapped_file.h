@@ -0,0 +1,55 @@
+/**
+ * @file mapped_file.h
+ * @brief Read-only access to a whole file without copying it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A file mapped into memory, read-only.
+ *
+ * Uses mmap where available, with read-ahead for a front to back pass, and
+ * otherwise reads the file into memory.
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    /**
+     * @brief Maps a file.
+     *
+     * @param path path of the file
+     * @return true if the file could be opened; an empty file maps to size 0
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmaps the file. Pointers into it become invalid.
+     */
+    void close();
+
+    const unsigned char *data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    MappedFile(const MappedFile &);            // Not copyable.
+    MappedFile &operator=(const MappedFile &); // Not copyable.
+
+    const unsigned char *data_;           // Start of the file, or NULL if not open or empty.
+    std::size_t size_;                    // Size of the file in bytes.
+    bool mapped_;                         // data_ is a mapping rather than fallback_.
+    std::vector<unsigned char> fallback_; // The file read into memory where mmap is unavailable.
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,239 @@
+/**
+ * @file mesh_file.cpp
+ * @brief A binary mesh container that is memory-mapped and uploaded as is.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "mesh_file.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+/**
+ * @brief Rounds an offset up to the next multiple of MESH_FILE_ALIGNMENT.
+ *
+ * @param offset the offset
+ * @return the aligned offset
+ */
+static std::uint64_t alignOffset(std::uint64_t offset)
+{
+    return (offset + MESH_FILE_ALIGNMENT - 1) / MESH_FILE_ALIGNMENT * MESH_FILE_ALIGNMENT;
+}
+
+/**
+ * @brief Size of one index of a type.
+ *
+ * @param type GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+ * @return the size in bytes, or 0 for other types
+ */
+static std::size_t indexSize(std::uint32_t type)
+{
+    return type == GL_UNSIGNED_SHORT ? 2 : (type == GL_UNSIGNED_INT ? 4 : 0);
+}
+
+/**
+ * @brief Size of one component of an attribute type.
+ *
+ * @param type GL component type
+ * @return the size in bytes, or 0 for types mesh files do not use
+ */
+static std::size_t componentSize(std::uint32_t type)
+{
+    switch (type)
+    {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_HALF_FLOAT:
+        return 2;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_FLOAT:
+        return 4;
+    case GL_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+        return 1; // The whole attribute is four bytes; see attributeSize().
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Size of an attribute in a vertex.
+ *
+ * @param attribute the attribute
+ * @return the size in bytes, or 0 if the type is not known
+ */
+static std::size_t attributeSize(const MeshFileAttribute &attribute)
+{
+    return componentSize(attribute.type) * attribute.count;
+}
+
+bool MeshFile::open(const std::string &path)
+{
+    if (!file_.open(path))
+    {
+        std::cout << "ERROR::MESH_FILE::CANNOT_OPEN " << path << std::endl;
+        return false;
+    }
+    if (file_.size() < sizeof(MeshFileHeader))
+    {
+        std::cout << "ERROR::MESH_FILE::TRUNCATED " << path << std::endl;
+        file_.close();
+        return false;
+    }
+    if (!validate(path))
+    {
+        file_.close();
+        return false;
+    }
+    return true;
+}
+
+void MeshFile::close()
+{
+    file_.close();
+}
+
+std::size_t MeshFile::indexBytes() const
+{
+    return (std::size_t)header().indexCount * indexSize(header().indexType);
+}
+
+bool MeshFile::validate(const std::string &path) const
+{
+    const MeshFileHeader &header = this->header();
+    if (std::memcmp(header.magic, MESH_FILE_MAGIC, sizeof(MESH_FILE_MAGIC)) != 0 ||
+        header.version != MESH_FILE_VERSION)
+    {
+        std::cout << "ERROR::MESH_FILE::NOT_A_MESH_FILE " << path << std::endl;
+        return false;
+    }
+
+    // Every size is checked with divisions rather than products, so a
+    // corrupt count cannot overflow its way past the checks.
+    //
+    const std::size_t attributesEnd = sizeof(MeshFileHeader) + header.attributeCount * sizeof(MeshFileAttribute);
+    const std::size_t indexSizeBytes = indexSize(header.indexType);
+    bool valid = header.attributeCount >= 1 && header.attributeCount <= MESH_FILE_MAX_ATTRIBUTES &&
+                 attributesEnd <= file_.size() && header.vertexStride > 0 && indexSizeBytes != 0 &&
+                 header.indexCount % 3 == 0 && header.vertexOffset >= attributesEnd &&
+                 header.vertexOffset <= file_.size() && header.indexOffset <= file_.size() &&
+                 header.vertexCount <= (file_.size() - header.vertexOffset) / header.vertexStride &&
+                 header.indexCount <= (file_.size() - header.indexOffset) / indexSizeBytes &&
+                 header.vertexOffset % MESH_FILE_ALIGNMENT == 0 && header.indexOffset % MESH_FILE_ALIGNMENT == 0;
+
+    for (std::uint32_t i = 0; valid && i < header.attributeCount; ++i)
+    {
+        const MeshFileAttribute &attribute = attributes()[i];
+        const std::size_t size = attributeSize(attribute);
+        valid = attribute.location < MESH_FILE_MAX_ATTRIBUTES && attribute.count >= 1 && attribute.count <= 4 &&
+                size != 0 && attribute.offset + size <= header.vertexStride;
+    }
+
+    if (!valid)
+    {
+        std::cout << "ERROR::MESH_FILE::CORRUPT_HEADER " << path << std::endl;
+    }
+    return valid;
+}
+
+bool writeMeshFile(const std::string &path, const MeshFileAttribute *attributes, std::size_t attributeCount,
+                   std::uint32_t vertexStride, const void *vertices, std::size_t vertexCount,
+                   const std::vector<GLuint> &indices)
+{
+    // Sixteen bit indices halve the index data and what the GPU fetches.
+    //
+    const bool shortIndices = vertexCount <= 0x10000;
+
+    MeshFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MESH_FILE_MAGIC, sizeof(MESH_FILE_MAGIC));
+    header.version = MESH_FILE_VERSION;
+    header.attributeCount = (std::uint32_t)attributeCount;
+    header.vertexStride = vertexStride;
+    header.vertexCount = vertexCount;
+    header.indexCount = indices.size();
+    header.indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    header.vertexOffset = alignOffset(sizeof(MeshFileHeader) + attributeCount * sizeof(MeshFileAttribute));
+    header.indexOffset = alignOffset(header.vertexOffset + (std::uint64_t)vertexCount * vertexStride);
+
+    std::ostringstream temporary;
+    temporary << path << '.' << getpid() << ".tmp";
+    std::FILE *file = std::fopen(temporary.str().c_str(), "wb");
+    if (file == NULL)
+    {
+        std::cout << "ERROR::MESH_FILE::CANNOT_WRITE " << path << std::endl;
+        return false;
+    }
+
+    const std::vector<unsigned char> padding(MESH_FILE_ALIGNMENT, 0);
+    const std::size_t vertexBytes = vertexCount * vertexStride;
+    const std::size_t headerPadding = (std::size_t)header.vertexOffset - sizeof(MeshFileHeader) -
+                                      attributeCount * sizeof(MeshFileAttribute);
+    const std::size_t vertexPadding = (std::size_t)(header.indexOffset - header.vertexOffset) - vertexBytes;
+    bool complete = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                    std::fwrite(attributes, sizeof(MeshFileAttribute), attributeCount, file) == attributeCount &&
+                    std::fwrite(&padding[0], 1, headerPadding, file) == headerPadding &&
+                    (vertexBytes == 0 || std::fwrite(vertices, 1, vertexBytes, file) == vertexBytes) &&
+                    std::fwrite(&padding[0], 1, vertexPadding, file) == vertexPadding;
+    if (complete && shortIndices)
+    {
+        std::vector<std::uint16_t> shorts(indices.begin(), indices.end());
+        complete = shorts.empty() || std::fwrite(&shorts[0], sizeof(std::uint16_t), shorts.size(), file) == shorts.size();
+    }
+    else if (complete)
+    {
+        complete = indices.empty() || std::fwrite(&indices[0], sizeof(GLuint), indices.size(), file) == indices.size();
+    }
+
+    if (std::fclose(file) == 0 && complete && std::rename(temporary.str().c_str(), path.c_str()) == 0)
+    {
+        return true;
+    }
+    std::remove(temporary.str().c_str());
+    std::cout << "ERROR::MESH_FILE::CANNOT_WRITE " << path << std::endl;
+    return false;
+}
+
+void createMeshVertexArray(GlStateCache &state, const MeshFile &mesh, unsigned int &VAO, unsigned int &VBO,
+                           unsigned int &EBO)
+{
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    state.bindVertexArray(VAO);
+
+    // Straight from the mapping: the driver's copy into the buffer is the
+    // only one, and it reads the file's pages as it goes.
+    //
+    state.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)mesh.vertexBytes(), mesh.vertices(), GL_STATIC_DRAW);
+    state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)mesh.indexBytes(), mesh.indices(), GL_STATIC_DRAW);
+
+    // The layout is only known at run time here, so unlike VertexLayout the
+    // attribute calls come from the file's descriptors.
+    //
+    const MeshFileHeader &header = mesh.header();
+    for (std::uint32_t i = 0; i < header.attributeCount; ++i)
+    {
+        const MeshFileAttribute &attribute = mesh.attributes()[i];
+        glVertexAttribPointer(attribute.location, (GLint)attribute.count, attribute.type,
+                              attribute.normalized ? GL_TRUE : GL_FALSE, (GLsizei)header.vertexStride,
+                              (void *)(std::size_t)attribute.offset);
+        glEnableVertexAttribArray(attribute.location);
+    }
+
+    state.bindBuffer(GL_ARRAY_BUFFER, 0);
+    state.bindVertexArray(0);
+}
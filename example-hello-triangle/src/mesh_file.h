@@ -0,0 +1,151 @@
+/**
+ * @file mesh_file.h
+ * @brief A binary mesh container that is memory-mapped and uploaded as is.
+ *
+ * Text formats like OBJ have to be parsed and converted on every load, which
+ * dominates load time for large meshes. A mesh file instead holds the vertex
+ * and index data exactly as the GPU consumes it, so loading is mapping the
+ * file and passing pointers into the mapping straight to glBufferData; the
+ * only copy is the one the driver makes into the buffer.
+ *
+ * Layout, all little-endian:
+ *
+ *     MeshFileHeader
+ *     MeshFileAttribute[attributeCount]  describing one vertex
+ *     padding to MESH_FILE_ALIGNMENT
+ *     vertex data, vertexCount * vertexStride bytes
+ *     padding to MESH_FILE_ALIGNMENT
+ *     index data, indexCount indices of indexType
+ *
+ * Files are made by the mesh-convert tool. The header is checked against the
+ * file size on open, but the indices are not checked against the vertex count,
+ * since that would mean reading them all; only load files from trusted tools.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef MESH_FILE_H
+#define MESH_FILE_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+#include "mapped_file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+const char MESH_FILE_MAGIC[4] = {'W', 'T', 'M', 'S'}; //!< Start of every mesh file.
+const std::uint32_t MESH_FILE_VERSION = 1;            //!< Bumped when the layout changes.
+const std::uint32_t MESH_FILE_MAX_ATTRIBUTES = 16;    //!< The minimum GL_MAX_VERTEX_ATTRIBS.
+
+/**
+ * @brief Alignment of the vertex and index data in the file.
+ *
+ * A page, so each blob starts on its own page of the mapping and the driver
+ * copies from page-aligned memory.
+ */
+const std::uint64_t MESH_FILE_ALIGNMENT = 4096;
+
+/**
+ * @brief Start of a mesh file.
+ */
+struct MeshFileHeader
+{
+    char magic[4];                //!< MESH_FILE_MAGIC.
+    std::uint32_t version;        //!< MESH_FILE_VERSION.
+    std::uint32_t attributeCount; //!< MeshFileAttributes following the header.
+    std::uint32_t vertexStride;   //!< Bytes per vertex.
+    std::uint64_t vertexCount;    //!< Vertices in the vertex data.
+    std::uint64_t indexCount;     //!< Indices in the index data, three per triangle.
+    std::uint32_t indexType;      //!< GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+    std::uint32_t reserved;       //!< Zero.
+    std::uint64_t vertexOffset;   //!< Offset of the vertex data from the start of the file.
+    std::uint64_t indexOffset;    //!< Offset of the index data from the start of the file.
+};
+
+/**
+ * @brief One vertex attribute, as passed to glVertexAttribPointer.
+ */
+struct MeshFileAttribute
+{
+    std::uint32_t location;   //!< Attribute location in the vertex shader.
+    std::uint32_t type;       //!< GL component type, e.g. GL_FLOAT or GL_HALF_FLOAT.
+    std::uint32_t count;      //!< Components, 1 to 4.
+    std::uint32_t normalized; //!< 1 to normalize integer components, else 0.
+    std::uint32_t offset;     //!< Offset of the attribute in a vertex.
+    std::uint32_t reserved;   //!< Zero.
+};
+
+/**
+ * @brief A mesh file mapped into memory, read-only.
+ */
+class MeshFile
+{
+public:
+    /**
+     * @brief Maps a mesh file and checks its header.
+     *
+     * @param path path of the file
+     * @return true if the file is a valid mesh file
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmaps the file. Pointers into it become invalid.
+     */
+    void close();
+
+    const MeshFileHeader &header() const { return *(const MeshFileHeader *)file_.data(); }
+    const MeshFileAttribute *attributes() const
+    {
+        return (const MeshFileAttribute *)(file_.data() + sizeof(MeshFileHeader));
+    }
+    const void *vertices() const { return file_.data() + header().vertexOffset; }
+    const void *indices() const { return file_.data() + header().indexOffset; }
+    std::size_t vertexBytes() const { return (std::size_t)(header().vertexCount * header().vertexStride); }
+    std::size_t indexBytes() const;
+    std::size_t size() const { return file_.size(); }
+
+private:
+    bool validate(const std::string &path) const;
+
+    MappedFile file_;
+};
+
+/**
+ * @brief Writes a mesh file.
+ *
+ * Written to a temporary file and renamed into place, so a reader never sees
+ * half a file. Indices are stored as GL_UNSIGNED_SHORT when every index fits.
+ *
+ * @param path path of the file
+ * @param attributes the attributes of a vertex
+ * @param attributeCount number of attributes, at most MESH_FILE_MAX_ATTRIBUTES
+ * @param vertexStride bytes per vertex
+ * @param vertices the vertex data
+ * @param vertexCount number of vertices
+ * @param indices three indices per triangle
+ * @return true if the file was written
+ */
+bool writeMeshFile(const std::string &path, const MeshFileAttribute *attributes, std::size_t attributeCount,
+                   std::uint32_t vertexStride, const void *vertices, std::size_t vertexCount,
+                   const std::vector<GLuint> &indices);
+
+/**
+ * @brief Uploads a mesh file to new buffers straight from the mapping and describes it in a new vertex array.
+ *
+ * @param state state cache to bind through
+ * @param mesh the open mesh file
+ * @param VAO receives the vertex array object, with the element buffer bound
+ * @param VBO receives the vertex buffer object
+ * @param EBO receives the element buffer object
+ */
+void createMeshVertexArray(GlStateCache &state, const MeshFile &mesh, unsigned int &VAO, unsigned int &VBO,
+                           unsigned int &EBO);
+
+#endif // MESH_FILE_H
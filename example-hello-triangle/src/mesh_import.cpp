@@ -0,0 +1,1377 @@
+/**
+ * @file mesh_import.cpp
+ * @brief Reading meshes from OBJ and PLY files, for conversion to mesh files.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "mesh_import.h"
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+// Eight digits at a time are only decoded with integer tricks on little-endian
+// targets, where the first character lands in the lowest byte.
+//
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_M_IX86) || \
+    defined(_M_X64) || defined(_M_ARM64)
+#define MESH_IMPORT_SWAR_DIGITS 1
+#endif
+
+static const std::size_t CHUNK_BYTES = 1 << 20;       // Text parsed by one task.
+static const std::size_t CHUNKS_PER_THREAD = 8;       // Spare chunks so threads finishing early find more work.
+static const std::size_t RECORDS_PER_CHUNK = 1 << 16; // Binary PLY vertices decoded by one task.
+static const GLuint INVALID_INDEX = 0xFFFFFFFFu;      // Never a valid index; fails validation on merge.
+static const std::size_t MAX_VERTICES = 0xFFFFFFFFu;  // Vertices a GLuint index can address.
+static const long long RELATIVE_CORNER = 1LL << 40;   // Bias marking an OBJ corner relative to its chunk.
+static const std::size_t NO_STOP = (std::size_t)-1;   // Parse a whole chunk; see parseObjChunk().
+
+/**
+ * @brief Part of a file parsed by one task, and what it produced.
+ */
+struct ImportChunk
+{
+    const char *begin;              // First byte of the chunk.
+    const char *end;                // One past its last byte.
+    std::vector<float> positions;   // x, y, z of the vertices the chunk defines.
+    std::vector<long long> corners; // OBJ triangle corners before resolving; see parseObjChunk().
+    std::vector<GLuint> indices;    // Three vertex indices per triangle, counting from the first vertex in the file.
+    const char *error;              // Start of the first line that failed to parse, or NULL.
+};
+
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static bool isDigit(char c)
+{
+    return (unsigned char)(c - '0') < 10;
+}
+
+/**
+ * @brief Whether a token ends here: at the end of the line, or at a separator.
+ */
+static bool isTokenEnd(const char *cursor, const char *end)
+{
+    return cursor == end || isBlank(*cursor) || *cursor == '\r' || *cursor == '\n';
+}
+
+/**
+ * @brief Skips spaces and tabs.
+ *
+ * @param cursor where to start
+ * @param end end of the line
+ * @return the first other character, or end
+ */
+static const char *skipBlanks(const char *cursor, const char *end)
+{
+    while (cursor < end && isBlank(*cursor))
+    {
+        ++cursor;
+    }
+    return cursor;
+}
+
+/**
+ * @brief Skips one whitespace separated token.
+ *
+ * @return the character after the token, or NULL if the line has no more tokens
+ */
+static const char *skipToken(const char *cursor, const char *end)
+{
+    cursor = skipBlanks(cursor, end);
+    if (cursor == end || *cursor == '\r')
+    {
+        return NULL;
+    }
+    while (!isTokenEnd(cursor, end))
+    {
+        ++cursor;
+    }
+    return cursor;
+}
+
+/**
+ * @brief Finds the end of a line.
+ *
+ * @return the newline, or end if the last line has none
+ */
+static const char *findLineEnd(const char *cursor, const char *end)
+{
+    const char *newline = (const char *)std::memchr(cursor, '\n', (std::size_t)(end - cursor));
+    return newline != NULL ? newline : end;
+}
+
+/**
+ * @brief Numbers a line for error messages, counting from 1.
+ */
+static std::size_t lineNumber(const char *data, const char *line)
+{
+    return (std::size_t)std::count(data, line, '\n') + 1;
+}
+
+#ifdef MESH_IMPORT_SWAR_DIGITS
+/**
+ * @brief Loads eight characters and checks they are all digits.
+ *
+ * Adding 6 to a digit leaves its high nibble at 3, while anything else either
+ * has a different high nibble or carries into it.
+ */
+static bool loadEightDigits(const char *text, std::uint64_t &chunk)
+{
+    std::memcpy(&chunk, text, sizeof(chunk));
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+           0x3333333333333333ull;
+}
+
+/**
+ * @brief Converts eight digits, loaded by loadEightDigits(), to their value.
+ *
+ * Combines neighbouring digits into pairs, the pairs into fours and the fours
+ * into the result, with three multiplies instead of eight.
+ */
+static std::uint32_t parseEightDigits(std::uint64_t chunk)
+{
+    const std::uint64_t mask = 0x000000FF000000FFull;
+    const std::uint64_t mul1 = 0x000F424000000064ull; // 100 + (1000000ULL << 32)
+    const std::uint64_t mul2 = 0x0000271000000001ull; // 1 + (10000ULL << 32)
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+    return (std::uint32_t)chunk;
+}
+#endif
+
+/**
+ * @brief Accumulates a run of decimal digits.
+ *
+ * @param cursor first character
+ * @param end end of the line
+ * @param mantissa value so far, multiplied by 10 for each digit taken
+ * @param digits digits so far; past 19 the mantissa stops changing, since it
+ *               would overflow
+ * @return the first character that is not a digit
+ */
+static const char *parseDigits(const char *cursor, const char *end, std::uint64_t &mantissa, int &digits)
+{
+#ifdef MESH_IMPORT_SWAR_DIGITS
+    std::uint64_t chunk;
+    while (end - cursor >= 8 && digits <= 11 && loadEightDigits(cursor, chunk))
+    {
+        mantissa = mantissa * 100000000 + parseEightDigits(chunk);
+        digits += 8;
+        cursor += 8;
+    }
+#endif
+    while (cursor < end && isDigit(*cursor))
+    {
+        if (digits < 19)
+        {
+            mantissa = mantissa * 10 + (std::uint64_t)(*cursor - '0');
+        }
+        ++digits;
+        ++cursor;
+    }
+    return cursor;
+}
+
+/**
+ * @brief Parses a decimal number to the nearest float.
+ *
+ * Numbers with at most 2^53 as their digits and a power of ten no larger than
+ * 10^22 are exact as doubles, so one multiply or divide rounds them correctly.
+ * Converting that double to a float rounds a second time, which only goes
+ * wrong when the double lands exactly halfway between two floats. Those, and
+ * numbers outside the fast path, go to strtof.
+ *
+ * @param cursor where to start; leading blanks are skipped
+ * @param end end of the line
+ * @param value receives the number
+ * @return the character after the number, or NULL if there is no number or it
+ *         runs into other characters
+ */
+static const char *parseFloat(const char *cursor, const char *end, float &value)
+{
+    static const double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    cursor = skipBlanks(cursor, end);
+    const char *start = cursor;
+    bool negative = false;
+    if (cursor < end && (*cursor == '-' || *cursor == '+'))
+    {
+        negative = *cursor == '-';
+        ++cursor;
+    }
+
+    std::uint64_t mantissa = 0;
+    int digits = 0;
+    cursor = parseDigits(cursor, end, mantissa, digits);
+    int exponent = 0;
+    if (cursor < end && *cursor == '.')
+    {
+        const char *fraction = ++cursor;
+        cursor = parseDigits(cursor, end, mantissa, digits);
+        exponent = -(int)(cursor - fraction);
+    }
+    if (digits == 0)
+    {
+        return NULL;
+    }
+    if (cursor < end && (*cursor == 'e' || *cursor == 'E'))
+    {
+        ++cursor;
+        bool negativeExponent = false;
+        if (cursor < end && (*cursor == '-' || *cursor == '+'))
+        {
+            negativeExponent = *cursor == '-';
+            ++cursor;
+        }
+        if (cursor == end || !isDigit(*cursor))
+        {
+            return NULL;
+        }
+        int written = 0;
+        while (cursor < end && isDigit(*cursor))
+        {
+            written = std::min(written * 10 + (*cursor - '0'), 100000);
+            ++cursor;
+        }
+        exponent += negativeExponent ? -written : written;
+    }
+    if (!isTokenEnd(cursor, end) && *cursor != '/')
+    {
+        return NULL;
+    }
+
+    if (digits <= 19 && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double exact = (double)mantissa;
+        exact = exponent < 0 ? exact / POWERS_OF_TEN[-exponent] : exact * POWERS_OF_TEN[exponent];
+        std::uint64_t bits;
+        std::memcpy(&bits, &exact, sizeof(bits));
+        if (mantissa == 0 || (bits & 0x1FFFFFFFull) != 0x10000000ull)
+        {
+            value = negative ? -(float)exact : (float)exact;
+            return cursor;
+        }
+    }
+
+    // The file is not terminated, so strtof gets a terminated copy.
+    //
+    const std::string text(start, cursor);
+    value = std::strtof(text.c_str(), NULL);
+    return cursor;
+}
+
+/**
+ * @brief Parses a decimal integer.
+ *
+ * @param cursor where to start; leading blanks are skipped
+ * @param end end of the line
+ * @param value receives the number
+ * @return the character after the digits, or NULL if there are none or more
+ *         than 18
+ */
+static const char *parseInteger(const char *cursor, const char *end, long long &value)
+{
+    cursor = skipBlanks(cursor, end);
+    bool negative = false;
+    if (cursor < end && (*cursor == '-' || *cursor == '+'))
+    {
+        negative = *cursor == '-';
+        ++cursor;
+    }
+    const char *digits = cursor;
+    long long magnitude = 0;
+    while (cursor < end && isDigit(*cursor))
+    {
+        magnitude = magnitude * 10 + (*cursor - '0');
+        ++cursor;
+    }
+    if (cursor == digits || cursor - digits > 18)
+    {
+        return NULL;
+    }
+    value = negative ? -magnitude : magnitude;
+    return cursor;
+}
+
+/**
+ * @brief Converts a zero-based index from a file to a GLuint, or INVALID_INDEX.
+ */
+static GLuint toIndex(long long index)
+{
+    return index >= 0 && index < (long long)MAX_VERTICES ? (GLuint)index : INVALID_INDEX;
+}
+
+/**
+ * @brief Cuts text into chunks that end just after a newline.
+ *
+ * @param begin start of the text
+ * @param end end of the text
+ * @param threads threads that will parse the chunks
+ * @param chunks receives the chunks, in order
+ */
+static void splitLines(const char *begin, const char *end, std::size_t threads, std::vector<ImportChunk> &chunks)
+{
+    const std::size_t bytes = (std::size_t)(end - begin);
+    const std::size_t count = std::max<std::size_t>(1, std::min(bytes / CHUNK_BYTES + 1, threads * CHUNKS_PER_THREAD));
+    const std::size_t step = bytes / count + 1;
+
+    chunks.clear();
+    const char *cursor = begin;
+    while (cursor < end)
+    {
+        const char *split = (std::size_t)(end - cursor) > step ? findLineEnd(cursor + step, end) : end;
+        if (split < end)
+        {
+            ++split;
+        }
+        ImportChunk chunk;
+        chunk.begin = cursor;
+        chunk.end = split;
+        chunk.error = NULL;
+        chunks.push_back(chunk);
+        cursor = split;
+    }
+}
+
+/**
+ * @brief Hashes a position for finding duplicates.
+ */
+static std::uint32_t hashPosition(const float *position)
+{
+    std::uint32_t bits[3];
+    std::memcpy(bits, position, sizeof(bits));
+    std::uint64_t hash = ((std::uint64_t)bits[0] << 32 | bits[1]) * 0x9E3779B97F4A7C15ull;
+    hash ^= (hash >> 29) ^ ((std::uint64_t)bits[2] * 0xC2B2AE3D27D4EB4Full);
+    hash *= 0x165667B19E3779F9ull;
+    return (std::uint32_t)(hash >> 32);
+}
+
+/**
+ * @brief Joins the chunks into one mesh, merging identical positions.
+ *
+ * Duplicates are found with one open addressing hash table per hash range, so
+ * each thread owns a table and none need locking. Distinct positions keep the
+ * order of their first appearance in the file.
+ *
+ * @param path path of the file, for error messages
+ * @param pool threads to work on
+ * @param chunks parsed chunks; their positions and indices are released
+ * @param vertices receives x, y, z for each distinct position
+ * @param indices receives the chunks' indices, renumbered for the merged vertices
+ * @param duplicates receives how many positions were merged away
+ * @return false if there are too many vertices or an index is out of range
+ */
+static bool mergeChunks(const std::string &path, ThreadPool &pool, std::vector<ImportChunk> &chunks,
+                        std::vector<float> &vertices, std::vector<GLuint> &indices, std::size_t &duplicates)
+{
+    std::vector<std::size_t> vertexBase(chunks.size() + 1, 0);
+    std::vector<std::size_t> indexBase(chunks.size() + 1, 0);
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        vertexBase[i + 1] = vertexBase[i] + chunks[i].positions.size() / 3;
+        indexBase[i + 1] = indexBase[i] + chunks[i].indices.size();
+    }
+    const std::size_t total = vertexBase[chunks.size()];
+    if (total > MAX_VERTICES)
+    {
+        std::cout << "ERROR::MESH_IMPORT::TOO_MANY_VERTICES " << path << std::endl;
+        return false;
+    }
+
+    // Gather the positions and hash them. Negative zero is made positive so it
+    // matches zero.
+    //
+    std::vector<float> all(total * 3);
+    std::vector<std::uint32_t> hashes(total);
+    pool.run(chunks.size(), [&](std::size_t c) {
+        std::vector<float> &positions = chunks[c].positions;
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            all[vertexBase[c] * 3 + i] = positions[i] == 0.0f ? 0.0f : positions[i];
+        }
+        for (std::size_t i = vertexBase[c]; i < vertexBase[c + 1]; ++i)
+        {
+            hashes[i] = hashPosition(&all[i * 3]);
+        }
+        std::vector<float>().swap(positions);
+    });
+
+    // Point every vertex at the first vertex with the same position.
+    //
+    const std::size_t partitions = pool.size();
+    std::vector<GLuint> first(total);
+    pool.run(partitions, [&](std::size_t partition) {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < total; ++i)
+        {
+            count += ((std::uint64_t)hashes[i] * partitions >> 32) == partition;
+        }
+        std::size_t capacity = 16;
+        while (capacity < count * 2)
+        {
+            capacity *= 2;
+        }
+        std::vector<GLuint> table(capacity, INVALID_INDEX);
+        const std::size_t mask = capacity - 1;
+        for (std::size_t i = 0; i < total; ++i)
+        {
+            if (((std::uint64_t)hashes[i] * partitions >> 32) != partition)
+            {
+                continue;
+            }
+            std::size_t slot = hashes[i] & mask;
+            while (true)
+            {
+                const GLuint entry = table[slot];
+                if (entry == INVALID_INDEX)
+                {
+                    table[slot] = (GLuint)i;
+                    first[i] = (GLuint)i;
+                    break;
+                }
+                if (hashes[entry] == hashes[i] && std::memcmp(&all[entry * 3], &all[i * 3], 3 * sizeof(float)) == 0)
+                {
+                    first[i] = entry;
+                    break;
+                }
+                slot = (slot + 1) & mask;
+            }
+        }
+    });
+
+    // Number the first appearances in file order and copy them out. The hashes
+    // are no longer needed, so their storage holds the new numbers.
+    //
+    const std::size_t ranges = pool.size() * CHUNKS_PER_THREAD;
+    std::vector<std::size_t> uniqueBase(ranges + 1, 0);
+    pool.run(ranges, [&](std::size_t r) {
+        for (std::size_t i = total * r / ranges; i < total * (r + 1) / ranges; ++i)
+        {
+            uniqueBase[r + 1] += first[i] == i;
+        }
+    });
+    for (std::size_t r = 0; r < ranges; ++r)
+    {
+        uniqueBase[r + 1] += uniqueBase[r];
+    }
+    duplicates = total - uniqueBase[ranges];
+
+    std::vector<std::uint32_t> &numbers = hashes;
+    vertices.resize(uniqueBase[ranges] * 3);
+    pool.run(ranges, [&](std::size_t r) {
+        std::size_t number = uniqueBase[r];
+        for (std::size_t i = total * r / ranges; i < total * (r + 1) / ranges; ++i)
+        {
+            if (first[i] == i)
+            {
+                numbers[i] = (std::uint32_t)number;
+                std::memcpy(&vertices[number * 3], &all[i * 3], 3 * sizeof(float));
+                ++number;
+            }
+        }
+    });
+    std::vector<float>().swap(all);
+
+    indices.resize(indexBase[chunks.size()]);
+    std::atomic<bool> outOfRange(false);
+    pool.run(chunks.size(), [&](std::size_t c) {
+        const std::vector<GLuint> &source = chunks[c].indices;
+        GLuint *destination = indices.empty() ? NULL : &indices[indexBase[c]];
+        for (std::size_t i = 0; i < source.size(); ++i)
+        {
+            if (source[i] >= total)
+            {
+                outOfRange = true;
+                return;
+            }
+            destination[i] = numbers[first[source[i]]];
+        }
+        std::vector<GLuint>().swap(chunks[c].indices);
+    });
+    if (outOfRange)
+    {
+        std::cout << "ERROR::MESH_IMPORT::BAD_INDEX " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Fills in the statistics of a finished import.
+ */
+static void recordStats(ImportStats *stats, std::size_t bytes, std::size_t chunks, const ThreadPool &pool,
+                        std::size_t duplicates, std::chrono::steady_clock::time_point start)
+{
+    if (stats != NULL)
+    {
+        stats->bytes = bytes;
+        stats->chunks = chunks;
+        stats->threads = pool.size();
+        stats->duplicates = duplicates;
+        stats->milliseconds =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+/**
+ * @brief Parses the "v" and "f" lines of part of an OBJ file.
+ *
+ * A chunk does not know how many positions come before it, so a corner with a
+ * positive index is stored zero-based, and one with a negative index is stored
+ * relative to the chunk's first position, less RELATIVE_CORNER, to be resolved
+ * once every chunk is parsed.
+ *
+ * @param chunk the chunk to parse
+ * @param stopAfter stop with an error on the face that takes the corner count
+ *                  past this, to find the line of a corner that failed to
+ *                  resolve; NO_STOP to parse everything
+ */
+static void parseObjChunk(ImportChunk &chunk, std::size_t stopAfter)
+{
+    const char *line = chunk.begin;
+    while (line < chunk.end)
+    {
+        const char *lineEnd = findLineEnd(line, chunk.end);
+        const char *cursor = skipBlanks(line, lineEnd);
+        if (lineEnd - cursor >= 2 && cursor[0] == 'v' && isBlank(cursor[1]))
+        {
+            float position[3];
+            ++cursor;
+            for (int i = 0; i < 3 && cursor != NULL; ++i)
+            {
+                cursor = parseFloat(cursor, lineEnd, position[i]);
+            }
+            if (cursor == NULL)
+            {
+                chunk.error = line;
+                return;
+            }
+            chunk.positions.insert(chunk.positions.end(), position, position + 3);
+        }
+        else if (lineEnd - cursor >= 2 && cursor[0] == 'f' && isBlank(cursor[1]))
+        {
+            // Each corner is v, v/vt, v//vn or v/vt/vn; only v matters.
+            //
+            const long long local = (long long)(chunk.positions.size() / 3);
+            long long corners[2] = {0, 0};
+            std::size_t count = 0;
+            ++cursor;
+            while (true)
+            {
+                cursor = skipBlanks(cursor, lineEnd);
+                if (cursor == lineEnd || *cursor == '\r')
+                {
+                    break;
+                }
+                long long index;
+                cursor = parseInteger(cursor, lineEnd, index);
+                if (cursor == NULL || index == 0 || (!isTokenEnd(cursor, lineEnd) && *cursor != '/'))
+                {
+                    chunk.error = line;
+                    return;
+                }
+                while (!isTokenEnd(cursor, lineEnd))
+                {
+                    ++cursor;
+                }
+
+                const long long corner = index > 0 ? index - 1 : local + index - RELATIVE_CORNER;
+                if (count >= 2)
+                {
+                    chunk.corners.push_back(corners[0]);
+                    chunk.corners.push_back(corners[1]);
+                    chunk.corners.push_back(corner);
+                }
+                corners[count == 0 ? 0 : 1] = corner;
+                ++count;
+            }
+            if (chunk.corners.size() > stopAfter)
+            {
+                chunk.error = line;
+                return;
+            }
+        }
+        line = lineEnd + 1;
+    }
+}
+
+bool importObj(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+               ImportStats *stats)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vertices.clear();
+    indices.clear();
+
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cout << "ERROR::MESH_IMPORT::CANNOT_READ " << path << std::endl;
+        return false;
+    }
+    const char *data = (const char *)file.data();
+    std::vector<ImportChunk> chunks;
+    splitLines(data, data + file.size(), pool.size(), chunks);
+
+    pool.run(chunks.size(), [&](std::size_t c) { parseObjChunk(chunks[c], NO_STOP); });
+    for (std::size_t c = 0; c < chunks.size(); ++c)
+    {
+        if (chunks[c].error != NULL)
+        {
+            const char *cursor = skipBlanks(chunks[c].error, chunks[c].end);
+            std::cout << (*cursor == 'v' ? "ERROR::MESH_IMPORT::BAD_VERTEX " : "ERROR::MESH_IMPORT::BAD_INDEX ") << path
+                      << ":" << lineNumber(data, chunks[c].error) << std::endl;
+            return false;
+        }
+    }
+
+    // Resolve the corners now the position count before each chunk is known.
+    //
+    std::vector<long long> base(chunks.size() + 1, 0);
+    for (std::size_t c = 0; c < chunks.size(); ++c)
+    {
+        base[c + 1] = base[c] + (long long)(chunks[c].positions.size() / 3);
+    }
+    const long long total = base[chunks.size()];
+    std::vector<std::size_t> badCorner(chunks.size(), NO_STOP);
+    pool.run(chunks.size(), [&](std::size_t c) {
+        const std::vector<long long> &corners = chunks[c].corners;
+        std::vector<GLuint> &resolved = chunks[c].indices;
+        resolved.resize(corners.size());
+        for (std::size_t i = 0; i < corners.size(); ++i)
+        {
+            const long long index = corners[i] >= 0 ? corners[i] : base[c] + corners[i] + RELATIVE_CORNER;
+            if (index < 0 || index >= total)
+            {
+                badCorner[c] = i;
+                return;
+            }
+            resolved[i] = (GLuint)index;
+        }
+        std::vector<long long>().swap(chunks[c].corners);
+    });
+    for (std::size_t c = 0; c < chunks.size(); ++c)
+    {
+        if (badCorner[c] != NO_STOP)
+        {
+            ImportChunk again;
+            again.begin = chunks[c].begin;
+            again.end = chunks[c].end;
+            again.error = NULL;
+            parseObjChunk(again, badCorner[c]);
+            std::cout << "ERROR::MESH_IMPORT::BAD_INDEX " << path << ":" << lineNumber(data, again.error)
+                      << std::endl;
+            return false;
+        }
+    }
+
+    std::size_t duplicates;
+    if (!mergeChunks(path, pool, chunks, vertices, indices, duplicates))
+    {
+        return false;
+    }
+    recordStats(stats, file.size(), chunks.size(), pool, duplicates, start);
+    return true;
+}
+
+/**
+ * @brief Scalar types of PLY properties.
+ */
+enum PlyType
+{
+    PLY_NONE,
+    PLY_INT8,
+    PLY_UINT8,
+    PLY_INT16,
+    PLY_UINT16,
+    PLY_INT32,
+    PLY_UINT32,
+    PLY_FLOAT32,
+    PLY_FLOAT64
+};
+
+/**
+ * @brief Layouts of the body of a PLY file.
+ */
+enum PlyFormat
+{
+    PLY_ASCII,
+    PLY_LITTLE_ENDIAN,
+    PLY_BIG_ENDIAN
+};
+
+/**
+ * @brief One property of a PLY element.
+ */
+struct PlyProperty
+{
+    std::string name;
+    PlyType type;      // Type of the value, or of each list entry.
+    PlyType countType; // Type of the entry count for a list, otherwise PLY_NONE.
+};
+
+/**
+ * @brief One element of a PLY file, such as "vertex" or "face".
+ */
+struct PlyElement
+{
+    std::string name;
+    std::size_t count;
+    std::vector<PlyProperty> properties;
+};
+
+static PlyType plyType(const std::string &name)
+{
+    static const struct
+    {
+        const char *name;
+        PlyType type;
+    } TYPES[] = {{"char", PLY_INT8},     {"int8", PLY_INT8},      {"uchar", PLY_UINT8},   {"uint8", PLY_UINT8},
+                 {"short", PLY_INT16},   {"int16", PLY_INT16},    {"ushort", PLY_UINT16}, {"uint16", PLY_UINT16},
+                 {"int", PLY_INT32},     {"int32", PLY_INT32},    {"uint", PLY_UINT32},   {"uint32", PLY_UINT32},
+                 {"float", PLY_FLOAT32}, {"float32", PLY_FLOAT32}, {"double", PLY_FLOAT64}, {"float64", PLY_FLOAT64}};
+    for (std::size_t i = 0; i < sizeof(TYPES) / sizeof(TYPES[0]); ++i)
+    {
+        if (name == TYPES[i].name)
+        {
+            return TYPES[i].type;
+        }
+    }
+    return PLY_NONE;
+}
+
+static std::size_t plyTypeSize(PlyType type)
+{
+    switch (type)
+    {
+    case PLY_INT8:
+    case PLY_UINT8:
+        return 1;
+    case PLY_INT16:
+    case PLY_UINT16:
+        return 2;
+    case PLY_INT32:
+    case PLY_UINT32:
+    case PLY_FLOAT32:
+        return 4;
+    case PLY_FLOAT64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Reads one binary PLY value.
+ *
+ * @param data the value
+ * @param type its type
+ * @param swap whether its bytes are in the opposite order to this machine's
+ */
+static double readPlyValue(const unsigned char *data, PlyType type, bool swap)
+{
+    unsigned char bytes[8];
+    const std::size_t size = plyTypeSize(type);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = data[swap ? size - 1 - i : i];
+    }
+    switch (type)
+    {
+    case PLY_INT8:
+        return (double)(std::int8_t)bytes[0];
+    case PLY_UINT8:
+        return (double)bytes[0];
+    case PLY_INT16:
+    {
+        std::int16_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case PLY_UINT16:
+    {
+        std::uint16_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case PLY_INT32:
+    {
+        std::int32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case PLY_UINT32:
+    {
+        std::uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case PLY_FLOAT32:
+    {
+        float value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case PLY_FLOAT64:
+    {
+        double value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+/**
+ * @brief Reads the header of a PLY file.
+ *
+ * @param data start of the file
+ * @param end end of the file
+ * @param format receives the layout of the body
+ * @param elements receives the elements, in the order their data appears
+ * @return the start of the body, or NULL if the header is not valid
+ */
+static const char *parsePlyHeader(const char *data, const char *end, PlyFormat &format,
+                                  std::vector<PlyElement> &elements)
+{
+    bool haveFormat = false;
+    const char *line = data;
+    for (std::size_t number = 0; line < end; ++number)
+    {
+        // Headers written on Windows end their lines in CRLF; the words stop
+        // before the CR.
+        //
+        const char *lineEnd = findLineEnd(line, end);
+        const char *wordsEnd = lineEnd > line && lineEnd[-1] == '\r' ? lineEnd - 1 : lineEnd;
+        std::istringstream words(std::string(line, wordsEnd));
+        line = lineEnd + 1;
+        std::string keyword;
+        words >> keyword;
+        if (number == 0)
+        {
+            if (keyword != "ply")
+            {
+                return NULL;
+            }
+        }
+        else if (keyword == "format")
+        {
+            std::string name;
+            words >> name;
+            haveFormat = true;
+            if (name == "ascii")
+            {
+                format = PLY_ASCII;
+            }
+            else if (name == "binary_little_endian")
+            {
+                format = PLY_LITTLE_ENDIAN;
+            }
+            else if (name == "binary_big_endian")
+            {
+                format = PLY_BIG_ENDIAN;
+            }
+            else
+            {
+                return NULL;
+            }
+        }
+        else if (keyword == "element")
+        {
+            PlyElement element;
+            if (!(words >> element.name >> element.count))
+            {
+                return NULL;
+            }
+            elements.push_back(element);
+        }
+        else if (keyword == "property")
+        {
+            std::string type;
+            PlyProperty property;
+            property.countType = PLY_NONE;
+            words >> type;
+            if (type == "list")
+            {
+                std::string countType;
+                words >> countType >> type;
+                property.countType = plyType(countType);
+                if (property.countType == PLY_NONE || property.countType == PLY_FLOAT32 ||
+                    property.countType == PLY_FLOAT64)
+                {
+                    return NULL;
+                }
+            }
+            property.type = plyType(type);
+            if (!(words >> property.name) || property.type == PLY_NONE || elements.empty())
+            {
+                return NULL;
+            }
+            elements.back().properties.push_back(property);
+        }
+        else if (keyword == "end_header")
+        {
+            return haveFormat && line <= end ? line : NULL;
+        }
+        else if (keyword != "comment" && keyword != "obj_info")
+        {
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Finds the x, y and z properties of the vertex element.
+ *
+ * @param element the vertex element
+ * @param axes receives 0, 1 or 2 for each property that is x, y or z, and -1 for the rest
+ * @return false if any of x, y or z is missing or is a list
+ */
+static bool findAxes(const PlyElement &element, std::vector<int> &axes)
+{
+    static const char *NAMES[] = {"x", "y", "z"};
+    axes.assign(element.properties.size(), -1);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        bool found = false;
+        for (std::size_t i = 0; i < element.properties.size(); ++i)
+        {
+            if (element.properties[i].name == NAMES[axis] && element.properties[i].countType == PLY_NONE)
+            {
+                axes[i] = axis;
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finds the vertex index list of the face element.
+ *
+ * @return its position among the element's properties, or -1 if there is none
+ */
+static int findFaceIndices(const PlyElement &element)
+{
+    for (std::size_t i = 0; i < element.properties.size(); ++i)
+    {
+        const PlyProperty &property = element.properties[i];
+        if (property.countType != PLY_NONE && (property.name == "vertex_indices" || property.name == "vertex_index"))
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Adds a face's triangles to a chunk, as a fan around its first corner.
+ */
+static void addFan(ImportChunk &chunk, const std::vector<long long> &face)
+{
+    for (std::size_t i = 2; i < face.size(); ++i)
+    {
+        chunk.indices.push_back(toIndex(face[0]));
+        chunk.indices.push_back(toIndex(face[i - 1]));
+        chunk.indices.push_back(toIndex(face[i]));
+    }
+}
+
+/**
+ * @brief Parses the lines of ascii PLY vertices in a chunk.
+ */
+static void parsePlyVertexLines(ImportChunk &chunk, const std::vector<int> &axes)
+{
+    const char *line = chunk.begin;
+    while (line < chunk.end)
+    {
+        const char *lineEnd = findLineEnd(line, chunk.end);
+        const char *cursor = line;
+        float position[3];
+        for (std::size_t i = 0; i < axes.size() && cursor != NULL; ++i)
+        {
+            cursor = axes[i] >= 0 ? parseFloat(cursor, lineEnd, position[axes[i]]) : skipToken(cursor, lineEnd);
+        }
+        if (cursor == NULL)
+        {
+            chunk.error = line;
+            return;
+        }
+        chunk.positions.insert(chunk.positions.end(), position, position + 3);
+        line = lineEnd + 1;
+    }
+}
+
+/**
+ * @brief Parses the lines of ascii PLY faces in a chunk.
+ */
+static void parsePlyFaceLines(ImportChunk &chunk, const PlyElement &element, int faceIndices)
+{
+    std::vector<long long> face;
+    const char *line = chunk.begin;
+    while (line < chunk.end)
+    {
+        const char *lineEnd = findLineEnd(line, chunk.end);
+        const char *cursor = line;
+        for (std::size_t i = 0; i < element.properties.size() && cursor != NULL; ++i)
+        {
+            if (element.properties[i].countType == PLY_NONE)
+            {
+                cursor = skipToken(cursor, lineEnd);
+                continue;
+            }
+            long long count;
+            cursor = parseInteger(cursor, lineEnd, count);
+            if (cursor == NULL || count < 0 || !isTokenEnd(cursor, lineEnd))
+            {
+                cursor = NULL;
+                break;
+            }
+            face.clear();
+            for (long long j = 0; j < count && cursor != NULL; ++j)
+            {
+                if ((int)i == faceIndices)
+                {
+                    long long index = 0;
+                    cursor = parseInteger(cursor, lineEnd, index);
+                    cursor = cursor != NULL && isTokenEnd(cursor, lineEnd) ? cursor : NULL;
+                    face.push_back(index);
+                }
+                else
+                {
+                    cursor = skipToken(cursor, lineEnd);
+                }
+            }
+            if ((int)i == faceIndices && cursor != NULL)
+            {
+                addFan(chunk, face);
+            }
+        }
+        if (cursor == NULL)
+        {
+            chunk.error = line;
+            return;
+        }
+        line = lineEnd + 1;
+    }
+}
+
+/**
+ * @brief Steps over one binary PLY property without decoding it.
+ *
+ * @param cursor start of the property
+ * @param end end of the file
+ * @param property the property
+ * @param swap whether list counts are byte swapped
+ * @return the start of the next property, or NULL if the file ends first
+ */
+static const unsigned char *skipBinaryProperty(const unsigned char *cursor, const unsigned char *end,
+                                               const PlyProperty &property, bool swap)
+{
+    std::size_t size = plyTypeSize(property.type);
+    if (property.countType != PLY_NONE)
+    {
+        const std::size_t countSize = plyTypeSize(property.countType);
+        if ((std::size_t)(end - cursor) < countSize)
+        {
+            return NULL;
+        }
+        const double entries = readPlyValue(cursor, property.countType, swap);
+        cursor += countSize;
+        size *= entries > 0.0 ? (std::size_t)entries : 0;
+    }
+    return (std::size_t)(end - cursor) < size ? NULL : cursor + size;
+}
+
+/**
+ * @brief Reads the body of an ascii PLY file into chunks.
+ *
+ * @return false, having printed why, if the body does not match the header
+ */
+static bool readAsciiPly(const std::string &path, ThreadPool &pool, const char *data, const char *body,
+                         const char *end, const std::vector<PlyElement> &elements, std::vector<ImportChunk> &chunks)
+{
+    // Each item is one line, so the elements are found by counting lines.
+    //
+    const char *cursor = body;
+    for (std::size_t e = 0; e < elements.size(); ++e)
+    {
+        const char *start = cursor;
+        for (std::size_t i = 0; i < elements[e].count; ++i)
+        {
+            if (cursor >= end)
+            {
+                std::cout << "ERROR::MESH_IMPORT::TRUNCATED " << path << std::endl;
+                return false;
+            }
+            cursor = findLineEnd(cursor, end) + 1;
+        }
+        const char *finish = std::min(cursor, end);
+
+        const bool isVertex = elements[e].name == "vertex";
+        const bool isFace = elements[e].name == "face";
+        if (!isVertex && !isFace)
+        {
+            continue;
+        }
+        std::vector<ImportChunk> section;
+        splitLines(start, finish, pool.size(), section);
+        if (isVertex)
+        {
+            std::vector<int> axes;
+            findAxes(elements[e], axes);
+            pool.run(section.size(), [&](std::size_t c) { parsePlyVertexLines(section[c], axes); });
+        }
+        else
+        {
+            const int faceIndices = findFaceIndices(elements[e]);
+            pool.run(section.size(), [&](std::size_t c) { parsePlyFaceLines(section[c], elements[e], faceIndices); });
+        }
+        for (std::size_t c = 0; c < section.size(); ++c)
+        {
+            if (section[c].error != NULL)
+            {
+                std::cout << (isVertex ? "ERROR::MESH_IMPORT::BAD_VERTEX " : "ERROR::MESH_IMPORT::BAD_INDEX ") << path
+                          << ":" << lineNumber(data, section[c].error) << std::endl;
+                return false;
+            }
+        }
+        chunks.insert(chunks.end(), section.begin(), section.end());
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the body of a binary PLY file into chunks.
+ *
+ * Vertices have a fixed size, so they are decoded on the pool a block of
+ * records at a time. Faces have a variable size and are decoded in order.
+ *
+ * @return false, having printed why, if the body does not match the header
+ */
+static bool readBinaryPly(const std::string &path, ThreadPool &pool, const unsigned char *body,
+                          const unsigned char *end, bool swap, const std::vector<PlyElement> &elements,
+                          std::vector<ImportChunk> &chunks)
+{
+    const unsigned char *cursor = body;
+    for (std::size_t e = 0; e < elements.size(); ++e)
+    {
+        const PlyElement &element = elements[e];
+        if (element.name == "vertex")
+        {
+            std::vector<int> axes;
+            findAxes(element, axes);
+            std::vector<std::size_t> offsets(element.properties.size());
+            std::size_t stride = 0;
+            for (std::size_t i = 0; i < element.properties.size(); ++i)
+            {
+                if (element.properties[i].countType != PLY_NONE)
+                {
+                    std::cout << "ERROR::MESH_IMPORT::UNSUPPORTED vertex lists in " << path << std::endl;
+                    return false;
+                }
+                offsets[i] = stride;
+                stride += plyTypeSize(element.properties[i].type);
+            }
+            if ((std::size_t)(end - cursor) / stride < element.count)
+            {
+                std::cout << "ERROR::MESH_IMPORT::TRUNCATED " << path << std::endl;
+                return false;
+            }
+
+            std::vector<ImportChunk> section((element.count + RECORDS_PER_CHUNK - 1) / RECORDS_PER_CHUNK);
+            const unsigned char *records = cursor;
+            pool.run(section.size(), [&](std::size_t c) {
+                const std::size_t first = c * RECORDS_PER_CHUNK;
+                const std::size_t last = std::min(first + RECORDS_PER_CHUNK, element.count);
+                std::vector<float> &positions = section[c].positions;
+                positions.resize((last - first) * 3);
+                for (std::size_t r = first; r < last; ++r)
+                {
+                    for (std::size_t i = 0; i < axes.size(); ++i)
+                    {
+                        if (axes[i] >= 0)
+                        {
+                            positions[(r - first) * 3 + axes[i]] = (float)readPlyValue(
+                                records + r * stride + offsets[i], element.properties[i].type, swap);
+                        }
+                    }
+                }
+            });
+            chunks.insert(chunks.end(), section.begin(), section.end());
+            cursor += stride * element.count;
+        }
+        else if (element.name == "face")
+        {
+            const int faceIndices = findFaceIndices(element);
+            ImportChunk faces;
+            faces.error = NULL;
+            std::vector<long long> face;
+            for (std::size_t item = 0; item < element.count && cursor != NULL; ++item)
+            {
+                for (std::size_t i = 0; i < element.properties.size() && cursor != NULL; ++i)
+                {
+                    const PlyProperty &property = element.properties[i];
+                    if ((int)i != faceIndices)
+                    {
+                        cursor = skipBinaryProperty(cursor, end, property, swap);
+                        continue;
+                    }
+                    const std::size_t countSize = plyTypeSize(property.countType);
+                    const std::size_t indexSize = plyTypeSize(property.type);
+                    if ((std::size_t)(end - cursor) < countSize)
+                    {
+                        cursor = NULL;
+                        break;
+                    }
+                    const double count = readPlyValue(cursor, property.countType, swap);
+                    const std::size_t corners = count > 0.0 ? (std::size_t)count : 0;
+                    cursor += countSize;
+                    if ((std::size_t)(end - cursor) / indexSize < corners)
+                    {
+                        cursor = NULL;
+                        break;
+                    }
+                    face.resize(corners);
+                    for (std::size_t j = 0; j < corners; ++j)
+                    {
+                        face[j] = (long long)readPlyValue(cursor + j * indexSize, property.type, swap);
+                    }
+                    cursor += corners * indexSize;
+                    addFan(faces, face);
+                }
+            }
+            if (cursor == NULL)
+            {
+                std::cout << "ERROR::MESH_IMPORT::TRUNCATED " << path << std::endl;
+                return false;
+            }
+            chunks.push_back(faces);
+        }
+        else
+        {
+            for (std::size_t item = 0; item < element.count && cursor != NULL; ++item)
+            {
+                for (std::size_t i = 0; i < element.properties.size() && cursor != NULL; ++i)
+                {
+                    cursor = skipBinaryProperty(cursor, end, element.properties[i], swap);
+                }
+            }
+            if (cursor == NULL)
+            {
+                std::cout << "ERROR::MESH_IMPORT::TRUNCATED " << path << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool importPly(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+               ImportStats *stats)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vertices.clear();
+    indices.clear();
+
+    MappedFile file;
+    if (!file.open(path))
+    {
+        std::cout << "ERROR::MESH_IMPORT::CANNOT_READ " << path << std::endl;
+        return false;
+    }
+    const char *data = (const char *)file.data();
+    const char *end = data + file.size();
+
+    PlyFormat format = PLY_ASCII;
+    std::vector<PlyElement> elements;
+    const char *body = parsePlyHeader(data, end, format, elements);
+    if (body == NULL)
+    {
+        std::cout << "ERROR::MESH_IMPORT::BAD_HEADER " << path << std::endl;
+        return false;
+    }
+    std::vector<int> axes;
+    bool haveVertices = false;
+    for (std::size_t e = 0; e < elements.size(); ++e)
+    {
+        if (elements[e].name == "vertex")
+        {
+            haveVertices = findAxes(elements[e], axes);
+        }
+        else if (elements[e].name == "face" && findFaceIndices(elements[e]) < 0)
+        {
+            std::cout << "ERROR::MESH_IMPORT::BAD_HEADER face element without vertex_indices in " << path
+                      << std::endl;
+            return false;
+        }
+    }
+    if (!haveVertices)
+    {
+        std::cout << "ERROR::MESH_IMPORT::BAD_HEADER vertex element without x, y and z in " << path << std::endl;
+        return false;
+    }
+
+    std::vector<ImportChunk> chunks;
+    bool read;
+    if (format == PLY_ASCII)
+    {
+        read = readAsciiPly(path, pool, data, body, end, elements, chunks);
+    }
+    else
+    {
+        const std::uint16_t one = 1;
+        const bool littleEndian = *(const unsigned char *)&one == 1;
+        read = readBinaryPly(path, pool, (const unsigned char *)body, (const unsigned char *)end,
+                             littleEndian != (format == PLY_LITTLE_ENDIAN), elements, chunks);
+    }
+
+    std::size_t duplicates;
+    if (!read || !mergeChunks(path, pool, chunks, vertices, indices, duplicates))
+    {
+        return false;
+    }
+    recordStats(stats, file.size(), chunks.size(), pool, duplicates, start);
+    return true;
+}
+
+bool importMesh(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+                ImportStats *stats)
+{
+    std::string extension = path.substr(std::min(path.size(), path.rfind('.')));
+    for (std::size_t i = 0; i < extension.size(); ++i)
+    {
+        extension[i] = (char)std::tolower((unsigned char)extension[i]);
+    }
+    if (extension == ".obj")
+    {
+        return importObj(path, pool, vertices, indices, stats);
+    }
+    if (extension == ".ply")
+    {
+        return importPly(path, pool, vertices, indices, stats);
+    }
+    std::cout << "ERROR::MESH_IMPORT::UNKNOWN_FORMAT " << path << std::endl;
+    return false;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file mesh_import.h
+ * @brief Reading meshes from OBJ and PLY files, for conversion to mesh files.
+ *
+ * Files are mapped rather than read, cut into chunks at line or record
+ * boundaries and parsed on a thread pool. Identical positions are merged, and
+ * the result is written straight into the x, y, z layout the example draws
+ * with (PositionLayout).
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef MESH_IMPORT_H
+#define MESH_IMPORT_H
+
+#include <glad/glad.h>
+
+#include "thread_pool.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief What an import did and how long it took.
+ */
+struct ImportStats
+{
+    std::size_t bytes;      //!< Size of the file.
+    std::size_t chunks;     //!< Pieces the file was cut into.
+    std::size_t threads;    //!< Threads the pieces were parsed on.
+    std::size_t duplicates; //!< Vertices merged into an identical earlier vertex.
+    double milliseconds;    //!< Time from opening the file to the finished mesh.
+};
+
+/**
+ * @brief Reads the positions and faces of a Wavefront OBJ file.
+ *
+ * Only "v" and "f" lines are used. Faces with more than three corners are
+ * split into fans. Texture and normal indices on corners are ignored, and
+ * negative indices count back from the latest position.
+ *
+ * @param path path of the file
+ * @param pool threads to parse on
+ * @param vertices receives x, y, z for each distinct position
+ * @param indices receives three indices per triangle
+ * @param stats if not NULL, receives what the import did
+ * @return true if the file was read and every index refers to a position
+ */
+bool importObj(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+               ImportStats *stats = NULL);
+
+/**
+ * @brief Reads the positions and faces of a PLY file.
+ *
+ * Accepts the ascii, binary_little_endian and binary_big_endian formats. The
+ * x, y and z properties of the "vertex" element may be of any scalar type, and
+ * the "vertex_indices" (or "vertex_index") list of the "face" element may use
+ * any integer types. Other elements and properties are skipped. Faces with
+ * more than three corners are split into fans.
+ *
+ * @param path path of the file
+ * @param pool threads to parse on
+ * @param vertices receives x, y, z for each distinct position
+ * @param indices receives three indices per triangle
+ * @param stats if not NULL, receives what the import did
+ * @return true if the file was read and every index refers to a vertex
+ */
+bool importPly(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+               ImportStats *stats = NULL);
+
+/**
+ * @brief Reads a mesh with importObj() or importPly(), chosen by the file extension.
+ *
+ * @return false if the extension is neither .obj nor .ply, or the import failed
+ */
+bool importMesh(const std::string &path, ThreadPool &pool, std::vector<float> &vertices, std::vector<GLuint> &indices,
+                ImportStats *stats = NULL);
+
+#endif // MESH_IMPORT_H
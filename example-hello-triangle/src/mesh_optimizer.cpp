@@ -0,0 +1,195 @@
+/**
+ * @file mesh_optimizer.cpp
+ * @brief Reordering indexed triangles and their vertices for the GPU's caches.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "mesh_optimizer.h"
+
+double computeAcmr(const std::vector<GLuint> &indices, std::size_t vertexCount, std::size_t cacheSize)
+{
+    const std::size_t triangles = indices.size() / 3;
+    if (triangles == 0)
+    {
+        return 0.0;
+    }
+
+    // A FIFO cache only changes on a miss, so a vertex is still cached if
+    // fewer than cacheSize misses happened since it was last loaded.
+    //
+    std::vector<std::size_t> loadedAt(vertexCount, 0);
+    std::size_t misses = 0;
+    std::size_t clock = cacheSize + 1;
+    for (std::size_t i = 0; i < triangles * 3; ++i)
+    {
+        const GLuint vertex = indices[i];
+        if (clock - loadedAt[vertex] > cacheSize)
+        {
+            loadedAt[vertex] = clock++;
+            ++misses;
+        }
+    }
+    return (double)misses / (double)triangles;
+}
+
+/**
+ * @brief Bookkeeping for Tipsify: which triangles use each vertex, and which are done.
+ */
+struct Adjacency
+{
+    std::vector<std::size_t> offsets;   //!< Start of each vertex's triangles in triangles.
+    std::vector<std::size_t> triangles; //!< Triangles using each vertex, grouped by vertex.
+    std::vector<unsigned int> live;     //!< Triangles using each vertex not emitted yet.
+};
+
+/**
+ * @brief Finds the triangles using each vertex.
+ *
+ * @param indices three indices per triangle
+ * @param vertexCount number of vertices the indices refer to
+ * @param adjacency receives the triangles of each vertex
+ */
+static void buildAdjacency(const std::vector<GLuint> &indices, std::size_t vertexCount, Adjacency &adjacency)
+{
+    adjacency.live.assign(vertexCount, 0);
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        ++adjacency.live[indices[i]];
+    }
+
+    adjacency.offsets.resize(vertexCount + 1);
+    adjacency.offsets[0] = 0;
+    for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        adjacency.offsets[vertex + 1] = adjacency.offsets[vertex] + adjacency.live[vertex];
+    }
+
+    std::vector<std::size_t> fill(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+    adjacency.triangles.resize(indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        adjacency.triangles[fill[indices[i]]++] = i / 3;
+    }
+}
+
+void optimizeVertexCache(std::vector<GLuint> &indices, std::size_t vertexCount, std::size_t cacheSize)
+{
+    const std::size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    Adjacency adjacency;
+    buildAdjacency(indices, vertexCount, adjacency);
+
+    std::vector<GLuint> ordered;
+    ordered.reserve(triangleCount * 3);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<std::size_t> loadedAt(vertexCount, 0); // When each vertex entered the cache.
+    std::vector<GLuint> deadEnds;                      // Recently used vertices, to fall back on.
+    std::vector<GLuint> candidates;
+    std::size_t clock = cacheSize + 1;
+    std::size_t cursor = 0; // Vertices before this have no live triangles left.
+
+    // Fan out around one vertex at a time, emitting all its remaining
+    // triangles, then move to whichever vertex of those triangles will still
+    // be in the cache after its own triangles are emitted.
+    //
+    long fanning = 0;
+    while (fanning >= 0)
+    {
+        candidates.clear();
+        for (std::size_t i = adjacency.offsets[fanning]; i < adjacency.offsets[fanning + 1]; ++i)
+        {
+            const std::size_t triangle = adjacency.triangles[i];
+            if (emitted[triangle])
+            {
+                continue;
+            }
+            emitted[triangle] = true;
+
+            for (std::size_t corner = 0; corner < 3; ++corner)
+            {
+                const GLuint vertex = indices[triangle * 3 + corner];
+                ordered.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                --adjacency.live[vertex];
+                if (clock - loadedAt[vertex] > cacheSize)
+                {
+                    loadedAt[vertex] = clock++;
+                }
+            }
+        }
+
+        // Prefer the candidate that entered the cache earliest, as long as its
+        // remaining triangles, at most two new vertices each, won't push it out.
+        //
+        long next = -1;
+        std::size_t best = 0;
+        for (std::size_t i = 0; i < candidates.size(); ++i)
+        {
+            const GLuint vertex = candidates[i];
+            const std::size_t age = clock - loadedAt[vertex];
+            if (adjacency.live[vertex] > 0 && age + 2 * adjacency.live[vertex] <= cacheSize && age > best)
+            {
+                best = age;
+                next = (long)vertex;
+            }
+        }
+
+        // A dead end: go back to a recently used vertex that still has
+        // triangles, or failing that the next such vertex in index order.
+        //
+        while (next < 0 && !deadEnds.empty())
+        {
+            const GLuint vertex = deadEnds.back();
+            deadEnds.pop_back();
+            if (adjacency.live[vertex] > 0)
+            {
+                next = (long)vertex;
+            }
+        }
+        while (next < 0 && cursor < vertexCount)
+        {
+            if (adjacency.live[cursor] > 0)
+            {
+                next = (long)cursor;
+            }
+            ++cursor;
+        }
+        fanning = next;
+    }
+
+    indices.swap(ordered);
+}
+
+std::size_t optimizeVertexFetch(std::vector<GLuint> &indices, std::vector<float> &vertices,
+                                std::size_t floatsPerVertex)
+{
+    const std::size_t vertexCount = vertices.size() / floatsPerVertex;
+    const GLuint unassigned = (GLuint)-1;
+    std::vector<GLuint> remap(vertexCount, unassigned);
+    std::vector<float> reordered;
+    reordered.reserve(vertices.size());
+
+    GLuint next = 0;
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        const GLuint vertex = indices[i];
+        if (remap[vertex] == unassigned)
+        {
+            remap[vertex] = next++;
+            reordered.insert(reordered.end(), vertices.begin() + vertex * floatsPerVertex,
+                             vertices.begin() + (vertex + 1) * floatsPerVertex);
+        }
+        indices[i] = remap[vertex];
+    }
+
+    vertices.swap(reordered);
+    return next;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file mesh_optimizer.h
+ * @brief Reordering indexed triangles and their vertices for the GPU's caches.
+ *
+ * After a vertex is shaded the GPU keeps the result in a small post-transform
+ * cache keyed by its index. A triangle that reuses a cached vertex does not
+ * shade it again, so the order of the triangles decides how many times each
+ * shared vertex is shaded. The cost is measured as ACMR, the average cache
+ * miss ratio: vertices shaded per triangle. A triangle soup scores 3, a
+ * random order on a regular mesh a little under that, and a good order around
+ * 0.6 to 0.7, against a best of about 0.5 for large meshes.
+ *
+ * The cache order is found with Tipsify (Sander, Nehab and Barczak, "Fast
+ * Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007), which
+ * runs in linear time. Reordering the vertices to match then makes the
+ * vertex fetches walk through memory mostly forward.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Post-transform cache size the triangles are ordered for.
+ *
+ * Recent GPUs keep more entries than this, and an order made for a small
+ * cache still does well on a bigger one, while the reverse is not true.
+ */
+const std::size_t VERTEX_CACHE_SIZE = 16;
+
+/**
+ * @brief Simulates a FIFO post-transform cache to find the average cache miss ratio.
+ *
+ * @param indices three indices per triangle
+ * @param vertexCount number of vertices the indices refer to
+ * @param cacheSize entries in the simulated cache
+ * @return vertices shaded per triangle, or 0 if there are no triangles
+ */
+double computeAcmr(const std::vector<GLuint> &indices, std::size_t vertexCount,
+                   std::size_t cacheSize = VERTEX_CACHE_SIZE);
+
+/**
+ * @brief Reorders triangles so that shared vertices are likely still in the cache.
+ *
+ * The triangles themselves and their winding are unchanged, only their order.
+ *
+ * @param indices three indices per triangle, reordered in place
+ * @param vertexCount number of vertices the indices refer to
+ * @param cacheSize entries of the cache to order for
+ */
+void optimizeVertexCache(std::vector<GLuint> &indices, std::size_t vertexCount,
+                         std::size_t cacheSize = VERTEX_CACHE_SIZE);
+
+/**
+ * @brief Reorders vertices into the order the indices first use them.
+ *
+ * Run after optimizeVertexCache(). Vertices no triangle uses are dropped.
+ *
+ * @param indices three indices per triangle, rewritten to the new order
+ * @param vertices the vertices, reordered in place
+ * @param floatsPerVertex floats making up one vertex
+ * @return number of vertices left
+ */
+std::size_t optimizeVertexFetch(std::vector<GLuint> &indices, std::vector<float> &vertices,
+                                std::size_t floatsPerVertex);
+
+#endif // MESH_OPTIMIZER_H
@@ -0,0 +1,333 @@
+/**
+ * @file program_cache.cpp
+ * @brief On-disk cache of linked shader program binaries.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "program_cache.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+static const char BINARY_MAGIC[4] = {'W', 'T', 'P', 'B'}; //!< Start of every cache file.
+static const unsigned int BINARY_VERSION = 1;              //!< Bumped when the file layout changes.
+
+/**
+ * @brief What precedes the driver's binary in a cache file.
+ */
+struct BinaryHeader
+{
+    char magic[4];          //!< BINARY_MAGIC.
+    unsigned int version;   //!< BINARY_VERSION.
+    unsigned long long key; //!< Key the file was stored under, to catch a mixed-up file.
+    unsigned int format;    //!< Binary format reported by glGetProgramBinary.
+    unsigned int length;    //!< Size of the binary in bytes.
+};
+
+/**
+ * @brief Adds a string, including its terminator, to an FNV-1a hash.
+ *
+ * The terminator keeps "ab" + "c" from hashing the same as "a" + "bc".
+ *
+ * @param hash hash so far
+ * @param text the string, NULL is treated as empty
+ * @return the updated hash
+ */
+static unsigned long long hashString(unsigned long long hash, const char *text)
+{
+    const unsigned long long FNV_PRIME = 0x100000001b3ULL;
+    if (text != NULL)
+    {
+        for (; *text != '\0'; ++text)
+        {
+            hash = (hash ^ (unsigned char)*text) * FNV_PRIME;
+        }
+    }
+    return hash * FNV_PRIME; // The terminator; hash ^ 0 is hash.
+}
+
+/**
+ * @brief Creates a directory and any missing parents.
+ *
+ * @param path the directory
+ * @return true if the directory exists afterwards
+ */
+static bool makeDirectories(const std::string &path)
+{
+    for (std::size_t slash = path.find('/', 1); ; slash = path.find('/', slash + 1))
+    {
+        const std::string parent = path.substr(0, slash);
+        if (mkdir(parent.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            return false;
+        }
+        if (slash == std::string::npos)
+        {
+            return true;
+        }
+    }
+}
+
+ProgramCache::ProgramCache(const std::string &directory)
+    : directory_(directory), enabled_(true), supported_(-1), pendingCount_(0), parallelCompile_(false)
+{
+    std::memset(&counters_, 0, sizeof(counters_));
+}
+
+unsigned int ProgramCache::build(const char *vertexShaderSource, const char *fragmentShaderSource, const char *defines)
+{
+    const Ticket ticket = buildAsync(vertexShaderSource, fragmentShaderSource, defines);
+    Request &request = requests_[ticket];
+    if (request.program == 0)
+    {
+        complete(request);
+    }
+    return request.program;
+}
+
+ProgramCache::Ticket ProgramCache::buildAsync(const char *vertexShaderSource, const char *fragmentShaderSource,
+                                              const char *defines)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    Request request;
+    request.cached = enabled_ && !directory_.empty() && supported();
+    request.pending.program = 0;
+    request.pending.vertexShader = 0;
+    request.pending.fragmentShader = 0;
+    request.key = 0;
+    request.program = 0;
+    request.linked = false;
+    if (request.cached)
+    {
+        // A binary is only good for the exact driver that produced it, so the
+        // driver strings are part of the key along with everything compiled.
+        //
+        unsigned long long key = 0xcbf29ce484222325ULL; // FNV-1a offset basis.
+        key = hashString(key, (const char *)glGetString(GL_VENDOR));
+        key = hashString(key, (const char *)glGetString(GL_RENDERER));
+        key = hashString(key, (const char *)glGetString(GL_VERSION));
+        key = hashString(key, defines);
+        key = hashString(key, vertexShaderSource);
+        key = hashString(key, fragmentShaderSource);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "/%016llx.bin", key);
+        request.key = key;
+        request.path = directory_ + name;
+
+        request.program = load(request.path, key);
+    }
+
+    if (request.program != 0)
+    {
+        request.linked = true;
+        ++counters_.hits;
+    }
+    else
+    {
+        if (!parallelCompile_)
+        {
+            enableParallelShaderCompile();
+            parallelCompile_ = true;
+        }
+        ++counters_.misses;
+        request.pending = startShaderProgram(vertexShaderSource, fragmentShaderSource, defines, request.cached);
+        ++pendingCount_;
+    }
+    requests_.push_back(request);
+
+    counters_.buildMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return requests_.size() - 1;
+}
+
+bool ProgramCache::poll()
+{
+    for (std::size_t i = 0; i < requests_.size() && pendingCount_ > 0; ++i)
+    {
+        if (requests_[i].program == 0 && isShaderProgramReady(requests_[i].pending))
+        {
+            complete(requests_[i]);
+        }
+    }
+    return pendingCount_ == 0;
+}
+
+void ProgramCache::finishAll()
+{
+    for (std::size_t i = 0; i < requests_.size() && pendingCount_ > 0; ++i)
+    {
+        if (requests_[i].program == 0)
+        {
+            complete(requests_[i]);
+        }
+    }
+}
+
+void ProgramCache::complete(Request &request)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    request.program = finishShaderProgram(request.pending);
+    --pendingCount_;
+    int linked;
+    glGetProgramiv(request.program, GL_LINK_STATUS, &linked);
+    request.linked = linked != GL_FALSE;
+    if (request.cached && request.linked)
+    {
+        store(request.path, request.key, request.program);
+    }
+
+    counters_.buildMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void ProgramCache::report(std::ostream &out) const
+{
+    out << "  program cache     " << counters_.hits << " hits, " << counters_.misses << " misses, "
+        << counters_.stores << " stored, " << counters_.rejected << " rejected, " << counters_.buildMs << " ms";
+    if (!enabled_)
+    {
+        out << " (disabled)";
+    }
+    else if (supported_ == 0)
+    {
+        out << " (no program binary support)";
+    }
+    out << std::endl;
+}
+
+std::string ProgramCache::defaultDirectory()
+{
+    const char *cacheHome = std::getenv("XDG_CACHE_HOME");
+    if (cacheHome != NULL && *cacheHome == '/')
+    {
+        return std::string(cacheHome) + "/wt-learn-opengl";
+    }
+    const char *home = std::getenv("HOME");
+    if (home != NULL && *home == '/')
+    {
+        return std::string(home) + "/.cache/wt-learn-opengl";
+    }
+    return std::string();
+}
+
+bool ProgramCache::supported()
+{
+    if (supported_ < 0)
+    {
+        // Drivers may expose the extension but no formats, which means they
+        // never return a binary.
+        //
+        int formats = 0;
+        if (GLAD_GL_ARB_get_program_binary)
+        {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        supported_ = formats > 0 ? 1 : 0;
+    }
+    return supported_ != 0;
+}
+
+unsigned int ProgramCache::load(const std::string &path, unsigned long long key)
+{
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == NULL)
+    {
+        return 0;
+    }
+
+    BinaryHeader header;
+    std::vector<char> binary;
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1 &&
+                 std::memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0 &&
+                 header.version == BINARY_VERSION && header.key == key && header.length > 0;
+    if (valid)
+    {
+        binary.resize(header.length);
+        valid = std::fread(&binary[0], 1, binary.size(), file) == binary.size();
+    }
+    std::fclose(file);
+    if (!valid)
+    {
+        return 0;
+    }
+
+    // The driver checks the binary itself and fails the link status if it
+    // does not accept it.
+    //
+    unsigned int program = glCreateProgram();
+    glProgramBinary(program, header.format, &binary[0], (GLsizei)binary.size());
+    int successful;
+    glGetProgramiv(program, GL_LINK_STATUS, &successful);
+    if (!successful)
+    {
+        glDeleteProgram(program);
+        ++counters_.rejected;
+        return 0;
+    }
+    return program;
+}
+
+void ProgramCache::store(const std::string &path, unsigned long long key, unsigned int program)
+{
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+
+    BinaryHeader header;
+    std::memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.version = BINARY_VERSION;
+    header.key = key;
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, &binary[0]);
+    if (written <= 0)
+    {
+        return;
+    }
+    header.format = format;
+    header.length = (unsigned int)written;
+
+    if (!makeDirectories(directory_))
+    {
+        std::cout << "ERROR::PROGRAM_CACHE::CANNOT_CREATE " << directory_ << std::endl;
+        return;
+    }
+
+    // Write to a file of our own and rename it into place, so another launch
+    // reading the same key never sees half a binary.
+    //
+    std::ostringstream temporary;
+    temporary << path << '.' << getpid() << ".tmp";
+    std::FILE *file = std::fopen(temporary.str().c_str(), "wb");
+    if (file == NULL)
+    {
+        return;
+    }
+    const bool complete = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                          std::fwrite(&binary[0], 1, header.length, file) == header.length;
+    if (std::fclose(file) == 0 && complete && std::rename(temporary.str().c_str(), path.c_str()) == 0)
+    {
+        ++counters_.stores;
+    }
+    else
+    {
+        std::remove(temporary.str().c_str());
+    }
+}
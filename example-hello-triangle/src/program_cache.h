@@ -0,0 +1,181 @@
+/**
+ * @file program_cache.h
+ * @brief On-disk cache of linked shader program binaries.
+ *
+ * Compiling and linking from source is the largest part of startup once a scene
+ * has a few programs. With GL_ARB_get_program_binary the driver can hand back
+ * the linked program, which is stored under a key made from the sources, the
+ * defines and the driver vendor, renderer and version strings, and loaded
+ * instead of compiling on the next launch.
+ *
+ * Without the extension, or when the driver offers no binary formats, programs
+ * are built from source every time. A binary the driver rejects, for example
+ * after a driver update that kept the version string, is rebuilt from source
+ * and replaced.
+ *
+ * Programs can also be requested without waiting for the driver: buildAsync()
+ * issues the work and poll() collects what has finished, once per frame, so
+ * compiles overlap rendering instead of stalling it.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <glad/glad.h>
+
+#include "shader.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Builds shader programs, loading and storing linked binaries on disk.
+ */
+class ProgramCache
+{
+public:
+    /**
+     * @brief Number of programs served from the cache and built from source.
+     */
+    struct Counters
+    {
+        unsigned long hits;     //!< Programs loaded from a stored binary.
+        unsigned long misses;   //!< Programs built from source.
+        unsigned long stores;   //!< Binaries written to the cache.
+        unsigned long rejected; //!< Stored binaries the driver refused to load.
+        double buildMs;         //!< Time the calling thread spent getting programs, hits and misses alike.
+    };
+
+    typedef std::size_t Ticket; //!< Identifies a program requested with buildAsync().
+
+    /**
+     * @brief Creates a cache that stores binaries in a directory.
+     *
+     * @param directory where to keep binaries; created when the first one is stored
+     */
+    explicit ProgramCache(const std::string &directory = defaultDirectory());
+
+    /**
+     * @brief Turns the cache on or off. When off, every program is built from source.
+     *
+     * @param enabled whether to load and store binaries
+     */
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+
+    /**
+     * @brief Gets a linked program, from the cache if possible.
+     *
+     * Requires a current context with function pointers loaded.
+     *
+     * @param vertexShaderSource source of the vertex shader
+     * @param fragmentShaderSource source of the fragment shader
+     * @param defines preprocessor lines inserted after the #version line of both shaders
+     * @return the shader program
+     */
+    unsigned int build(const char *vertexShaderSource, const char *fragmentShaderSource, const char *defines = "");
+
+    /**
+     * @brief Starts getting a linked program without waiting for the driver.
+     *
+     * A cached program is ready at once. Otherwise the compiles and the link
+     * are issued and the program becomes available once poll() sees the driver
+     * has finished it.
+     *
+     * @param vertexShaderSource source of the vertex shader
+     * @param fragmentShaderSource source of the fragment shader
+     * @param defines preprocessor lines inserted after the #version line of both shaders
+     * @return ticket to get the program with
+     */
+    Ticket buildAsync(const char *vertexShaderSource, const char *fragmentShaderSource, const char *defines = "");
+
+    /**
+     * @brief Collects the programs the driver has finished, without blocking.
+     *
+     * @return true if no program is pending any more
+     */
+    bool poll();
+
+    /**
+     * @brief Waits for every pending program.
+     */
+    void finishAll();
+
+    /**
+     * @brief Gets a program requested with buildAsync().
+     *
+     * @param ticket the ticket buildAsync() returned
+     * @return the program, or 0 while it is pending
+     */
+    unsigned int program(Ticket ticket) const { return requests_[ticket].program; }
+
+    /**
+     * @brief Whether a finished program linked, i.e. whether it can be drawn with.
+     *
+     * @param ticket the ticket buildAsync() returned
+     * @return true if the program is finished and linked successfully
+     */
+    bool linked(Ticket ticket) const { return requests_[ticket].linked; }
+
+    const Counters &counters() const { return counters_; }
+
+    /**
+     * @brief Writes the hit and miss counts and the time spent.
+     *
+     * @param out stream to write to
+     */
+    void report(std::ostream &out) const;
+
+    /**
+     * @brief $XDG_CACHE_HOME/wt-learn-opengl, or ~/.cache/wt-learn-opengl.
+     *
+     * @return the directory, or an empty string if neither variable is set
+     */
+    static std::string defaultDirectory();
+
+private:
+    /**
+     * @brief A program requested from the cache.
+     */
+    struct Request
+    {
+        PendingProgram pending; //!< Compiles and link in flight, for misses.
+        unsigned long long key; //!< Cache key, if cached.
+        std::string path;       //!< Cache file, if cached.
+        bool cached;            //!< Whether to store the binary once linked.
+        unsigned int program;   //!< The finished program, or 0 while pending.
+        bool linked;            //!< Whether the finished program linked.
+    };
+
+    /**
+     * @brief Finishes a pending program and stores its binary.
+     *
+     * @param request the request to finish
+     */
+    void complete(Request &request);
+
+    /**
+     * @brief Checks once per context whether binaries can be retrieved at all.
+     *
+     * @return true if the extension is present with at least one binary format
+     */
+    bool supported();
+
+    unsigned int load(const std::string &path, unsigned long long key);
+    void store(const std::string &path, unsigned long long key, unsigned int program);
+
+    std::string directory_;
+    bool enabled_;
+    int supported_; // -1 until checked, then 0 or 1.
+    Counters counters_;
+    std::vector<Request> requests_;
+    std::size_t pendingCount_;
+    bool parallelCompile_; // Whether enableParallelShaderCompile() has been called.
+};
+
+#endif // PROGRAM_CACHE_H
@@ -0,0 +1,374 @@
+/**
+ * @file range_allocator.cpp
+ * @brief Two-level segregated fit (TLSF) allocation of ranges within a fixed capacity.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "range_allocator.h"
+
+#include <algorithm>
+
+/**
+ * @brief Position of the highest set bit of a non-zero value.
+ */
+static unsigned int highestBit(std::uint64_t value)
+{
+#if defined(__GNUC__)
+    return 63u - (unsigned int)__builtin_clzll(value);
+#else
+    unsigned int bit = 0;
+    while (value >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+/**
+ * @brief Position of the lowest set bit of a non-zero value.
+ */
+static unsigned int lowestBit(std::uint32_t value)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(value);
+#else
+    unsigned int bit = 0;
+    while ((value & 1u) == 0)
+    {
+        value >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+const std::uint32_t RangeAllocator::NO_RANGE;
+const std::uint32_t RangeAllocator::NONE;
+
+RangeAllocator::RangeAllocator()
+{
+    reset(0);
+}
+
+void RangeAllocator::reset(std::size_t capacity)
+{
+    blocks_.clear();
+    spareBlocks_.clear();
+    for (unsigned int first = 0; first < FIRST_LEVEL; ++first)
+    {
+        std::fill(heads_[first], heads_[first] + SECOND_LEVEL, NONE);
+        secondLevelMaps_[first] = 0;
+    }
+    firstLevelMap_ = 0;
+    lowest_ = NONE;
+    capacity_ = std::min<std::size_t>(capacity, 0xFFFFFFFFu);
+    used_ = 0;
+
+    if (capacity_ > 0)
+    {
+        lowest_ = newBlock();
+        Block &block = blocks_[lowest_];
+        block.offset = 0;
+        block.size = capacity_;
+        block.free = true;
+        insertFree(lowest_);
+    }
+}
+
+std::uint32_t RangeAllocator::allocate(std::size_t size)
+{
+    size = std::max<std::size_t>(size, 1);
+    if (size > capacity_)
+    {
+        return NO_RANGE;
+    }
+    const std::uint32_t block = findFree(size);
+    if (block == NONE)
+    {
+        return NO_RANGE;
+    }
+    removeFree(block);
+
+    // Give the rest back as a free block of its own.
+    //
+    if (blocks_[block].size > size)
+    {
+        const std::uint32_t rest = newBlock();
+        Block &split = blocks_[block];
+        Block &remainder = blocks_[rest];
+        remainder.offset = split.offset + size;
+        remainder.size = split.size - size;
+        remainder.previous = block;
+        remainder.next = split.next;
+        remainder.free = true;
+        if (split.next != NONE)
+        {
+            blocks_[split.next].previous = rest;
+        }
+        split.next = rest;
+        split.size = size;
+        insertFree(rest);
+    }
+    blocks_[block].free = false;
+    used_ += size;
+    return block;
+}
+
+void RangeAllocator::free(std::uint32_t range)
+{
+    std::uint32_t block = range;
+    used_ -= blocks_[block].size;
+    blocks_[block].free = true;
+
+    const std::uint32_t next = blocks_[block].next;
+    if (next != NONE && blocks_[next].free)
+    {
+        removeFree(next);
+        blocks_[block].size += blocks_[next].size;
+        blocks_[block].next = blocks_[next].next;
+        if (blocks_[next].next != NONE)
+        {
+            blocks_[blocks_[next].next].previous = block;
+        }
+        spareBlocks_.push_back(next);
+    }
+
+    const std::uint32_t previous = blocks_[block].previous;
+    if (previous != NONE && blocks_[previous].free)
+    {
+        removeFree(previous);
+        blocks_[previous].size += blocks_[block].size;
+        blocks_[previous].next = blocks_[block].next;
+        if (blocks_[block].next != NONE)
+        {
+            blocks_[blocks_[block].next].previous = previous;
+        }
+        spareBlocks_.push_back(block);
+        block = previous;
+    }
+
+    insertFree(block);
+}
+
+void RangeAllocator::compact(std::vector<Move> &moves)
+{
+    moves.clear();
+
+    std::vector<std::uint32_t> allocated;
+    for (std::uint32_t block = lowest_; block != NONE; block = blocks_[block].next)
+    {
+        if (blocks_[block].free)
+        {
+            spareBlocks_.push_back(block);
+        }
+        else
+        {
+            allocated.push_back(block);
+        }
+    }
+    for (unsigned int first = 0; first < FIRST_LEVEL; ++first)
+    {
+        std::fill(heads_[first], heads_[first] + SECOND_LEVEL, NONE);
+        secondLevelMaps_[first] = 0;
+    }
+    firstLevelMap_ = 0;
+    lowest_ = NONE;
+
+    std::size_t cursor = 0;
+    std::uint32_t previous = NONE;
+    for (std::size_t i = 0; i < allocated.size(); ++i)
+    {
+        Block &block = blocks_[allocated[i]];
+        if (block.offset != cursor)
+        {
+            const Move move = {allocated[i], block.offset, cursor, block.size};
+            moves.push_back(move);
+            block.offset = cursor;
+        }
+        block.previous = previous;
+        block.next = NONE;
+        if (previous == NONE)
+        {
+            lowest_ = allocated[i];
+        }
+        else
+        {
+            blocks_[previous].next = allocated[i];
+        }
+        previous = allocated[i];
+        cursor += block.size;
+    }
+
+    if (cursor < capacity_)
+    {
+        const std::uint32_t rest = newBlock();
+        Block &block = blocks_[rest];
+        block.offset = cursor;
+        block.size = capacity_ - cursor;
+        block.previous = previous;
+        block.next = NONE;
+        block.free = true;
+        if (previous == NONE)
+        {
+            lowest_ = rest;
+        }
+        else
+        {
+            blocks_[previous].next = rest;
+        }
+        insertFree(rest);
+    }
+}
+
+std::size_t RangeAllocator::largestFree() const
+{
+    if (firstLevelMap_ == 0)
+    {
+        return 0;
+    }
+    const unsigned int first = highestBit(firstLevelMap_);
+    const unsigned int second = highestBit(secondLevelMaps_[first]);
+    std::size_t largest = 0;
+    for (std::uint32_t block = heads_[first][second]; block != NONE; block = blocks_[block].nextFree)
+    {
+        largest = std::max(largest, blocks_[block].size);
+    }
+    return largest;
+}
+
+void RangeAllocator::mapping(std::size_t size, unsigned int &first, unsigned int &second)
+{
+    if (size < SECOND_LEVEL)
+    {
+        first = 0;
+        second = (unsigned int)size;
+    }
+    else
+    {
+        const unsigned int log = highestBit(size);
+        first = log - SECOND_LEVEL_BITS + 1;
+        second = (unsigned int)(size >> (log - SECOND_LEVEL_BITS)) ^ SECOND_LEVEL;
+    }
+}
+
+std::uint32_t RangeAllocator::newBlock()
+{
+    std::uint32_t block;
+    if (!spareBlocks_.empty())
+    {
+        block = spareBlocks_.back();
+        spareBlocks_.pop_back();
+    }
+    else
+    {
+        block = (std::uint32_t)blocks_.size();
+        blocks_.push_back(Block());
+    }
+    Block &created = blocks_[block];
+    created.offset = 0;
+    created.size = 0;
+    created.previous = NONE;
+    created.next = NONE;
+    created.previousFree = NONE;
+    created.nextFree = NONE;
+    created.free = false;
+    return block;
+}
+
+void RangeAllocator::insertFree(std::uint32_t block)
+{
+    unsigned int first;
+    unsigned int second;
+    mapping(blocks_[block].size, first, second);
+
+    Block &inserted = blocks_[block];
+    inserted.previousFree = NONE;
+    inserted.nextFree = heads_[first][second];
+    if (inserted.nextFree != NONE)
+    {
+        blocks_[inserted.nextFree].previousFree = block;
+    }
+    heads_[first][second] = block;
+    firstLevelMap_ |= 1u << first;
+    secondLevelMaps_[first] |= 1u << second;
+}
+
+void RangeAllocator::removeFree(std::uint32_t block)
+{
+    unsigned int first;
+    unsigned int second;
+    mapping(blocks_[block].size, first, second);
+
+    const Block &removed = blocks_[block];
+    if (removed.previousFree != NONE)
+    {
+        blocks_[removed.previousFree].nextFree = removed.nextFree;
+    }
+    else
+    {
+        heads_[first][second] = removed.nextFree;
+    }
+    if (removed.nextFree != NONE)
+    {
+        blocks_[removed.nextFree].previousFree = removed.previousFree;
+    }
+
+    if (heads_[first][second] == NONE)
+    {
+        secondLevelMaps_[first] &= ~(1u << second);
+        if (secondLevelMaps_[first] == 0)
+        {
+            firstLevelMap_ &= ~(1u << first);
+        }
+    }
+}
+
+std::uint32_t RangeAllocator::findFree(std::size_t size) const
+{
+    // Round the size up to the next class boundary, so that every block in the
+    // class found is large enough and the first one can be taken.
+    //
+    std::size_t rounded = size;
+    if (size >= SECOND_LEVEL)
+    {
+        rounded += ((std::size_t)1 << (highestBit(size) - SECOND_LEVEL_BITS)) - 1;
+    }
+    unsigned int first;
+    unsigned int second;
+    mapping(rounded, first, second);
+    if (first < FIRST_LEVEL)
+    {
+        std::uint32_t secondMap = secondLevelMaps_[first] & (~0u << second);
+        if (secondMap == 0)
+        {
+            const std::uint32_t firstMap = first + 1 < 32 ? firstLevelMap_ & (~0u << (first + 1)) : 0;
+            secondMap = 0;
+            if (firstMap != 0)
+            {
+                first = lowestBit(firstMap);
+                secondMap = secondLevelMaps_[first];
+            }
+        }
+        if (secondMap != 0)
+        {
+            return heads_[first][lowestBit(secondMap)];
+        }
+    }
+
+    // Nothing in a larger class, but a block in the size's own class may still
+    // fit; this matters when the last free space is only just large enough.
+    //
+    mapping(size, first, second);
+    for (std::uint32_t block = heads_[first][second]; block != NONE; block = blocks_[block].nextFree)
+    {
+        if (blocks_[block].size >= size)
+        {
+            return block;
+        }
+    }
+    return NONE;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file range_allocator.h
+ * @brief Two-level segregated fit (TLSF) allocation of ranges within a fixed capacity.
+ *
+ * Hands out ranges of a buffer rather than memory, so it keeps its bookkeeping
+ * to the side and never touches the buffer itself. Free ranges are kept in
+ * lists by size class, with a bitmap saying which lists are non-empty, so both
+ * allocating and freeing take constant time however fragmented the buffer is.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef RANGE_ALLOCATOR_H
+#define RANGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Allocates ranges of [0, capacity), in whatever unit the caller counts in.
+ *
+ * Each allocation is identified by a handle that stays the same when compact()
+ * moves it.
+ */
+class RangeAllocator
+{
+public:
+    static const std::uint32_t NO_RANGE = 0xFFFFFFFFu; //!< Handle returned when an allocation fails.
+
+    /**
+     * @brief A range moved by compact().
+     */
+    struct Move
+    {
+        std::uint32_t range; //!< Handle of the range.
+        std::size_t from;    //!< Its old offset.
+        std::size_t to;      //!< Its new offset, lower than the old one.
+        std::size_t size;    //!< Its size.
+    };
+
+    RangeAllocator();
+
+    /**
+     * @brief Forgets every allocation and starts over with one free range.
+     *
+     * @param capacity size of the space to allocate from, below 2^32
+     */
+    void reset(std::size_t capacity);
+
+    /**
+     * @brief Allocates a range.
+     *
+     * @param size size of the range; 0 is rounded up to 1
+     * @return handle of the range, or NO_RANGE if no free range is large enough
+     */
+    std::uint32_t allocate(std::size_t size);
+
+    /**
+     * @brief Frees a range, merging it with free neighbours.
+     *
+     * @param range handle from allocate()
+     */
+    void free(std::uint32_t range);
+
+    /**
+     * @brief Moves every allocation down to leave one free range at the end.
+     *
+     * Allocations keep their order, so each moves to a lower offset and the
+     * moves can be applied in the order given.
+     *
+     * @param moves receives the ranges that moved
+     */
+    void compact(std::vector<Move> &moves);
+
+    std::size_t offset(std::uint32_t range) const { return blocks_[range].offset; }
+    std::size_t size(std::uint32_t range) const { return blocks_[range].size; }
+    std::size_t capacity() const { return capacity_; }
+    std::size_t used() const { return used_; }
+
+    /**
+     * @brief Size of the largest free range, i.e. the largest allocation that would succeed.
+     */
+    std::size_t largestFree() const;
+
+private:
+    static const unsigned int SECOND_LEVEL_BITS = 4;                    // Each power of two is split into 16 classes.
+    static const unsigned int SECOND_LEVEL = 1u << SECOND_LEVEL_BITS;   // Classes per power of two.
+    static const unsigned int FIRST_LEVEL = 32 - SECOND_LEVEL_BITS + 1; // Powers of two up to 2^32.
+    static const std::uint32_t NONE = 0xFFFFFFFFu;                      // End of a list.
+
+    /**
+     * @brief A free or allocated range, linked to its neighbours in the space
+     *        and, when free, to the other free ranges of its class.
+     */
+    struct Block
+    {
+        std::size_t offset;
+        std::size_t size;
+        std::uint32_t previous;     // Block just below, or NONE.
+        std::uint32_t next;         // Block just above, or NONE.
+        std::uint32_t previousFree; // Previous block in the free list, or NONE.
+        std::uint32_t nextFree;     // Next block in the free list, or NONE.
+        bool free;
+    };
+
+    static void mapping(std::size_t size, unsigned int &first, unsigned int &second);
+    std::uint32_t newBlock();
+    void insertFree(std::uint32_t block);
+    void removeFree(std::uint32_t block);
+    std::uint32_t findFree(std::size_t size) const;
+
+    std::vector<Block> blocks_;
+    std::vector<std::uint32_t> spareBlocks_;         // Entries of blocks_ not in use.
+    std::uint32_t heads_[FIRST_LEVEL][SECOND_LEVEL]; // First free block of each class.
+    std::uint32_t firstLevelMap_;                    // Bit per first level with a free block.
+    std::uint32_t secondLevelMaps_[FIRST_LEVEL];     // Bit per class with a free block.
+    std::uint32_t lowest_;                           // Block at offset 0.
+    std::size_t capacity_;
+    std::size_t used_;
+};
+
+#endif // RANGE_ALLOCATOR_H
@@ -0,0 +1,131 @@
+/**
+ * @file render_thread.cpp
+ * @brief Runs the draw loop on its own thread, fed with commands by the event thread.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "render_thread.h"
+
+#include "gl_trace.h"
+#include "profiler.h"
+
+#include <chrono>
+
+RenderThread::RenderThread()
+    : frameStats_(0, RECENT_FRAME_SAMPLES), window_(NULL), running_(false)
+{
+}
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+void RenderThread::start(GLFWwindow *window, const RenderCallbacks &callbacks)
+{
+    window_ = window;
+    callbacks_ = callbacks;
+    running_.store(true, std::memory_order_release);
+
+    // A context can only be current on one thread at a time.
+    //
+    glfwMakeContextCurrent(NULL);
+    thread_ = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::post(const RenderCommand &command)
+{
+    while (!commands_.push(command))
+    {
+        if (!running())
+        {
+            return; // Nobody left to make room.
+        }
+        std::this_thread::yield();
+    }
+}
+
+void RenderThread::stop()
+{
+    if (!thread_.joinable())
+    {
+        return;
+    }
+
+    RenderCommand quit;
+    quit.type = RenderCommand::QUIT;
+    quit.width = 0;
+    quit.height = 0;
+    post(quit);
+
+    thread_.join();
+}
+
+void RenderThread::run()
+{
+    glfwMakeContextCurrent(window_);
+    PROFILE_THREAD("render thread");
+
+    const bool ready = callbacks_.setup();
+    bool rendering = ready;
+
+    std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+    while (rendering)
+    {
+        PROFILE_ZONE("frame");
+
+        // Apply everything the event thread sent since the last frame. Only the
+        // last of a run of resizes matters, so they are folded into one.
+        //
+        bool resized = false;
+        int width = 0;
+        int height = 0;
+        RenderCommand command;
+        while (commands_.pop(command))
+        {
+            if (command.type == RenderCommand::RESIZE)
+            {
+                resized = true;
+                width = command.width;
+                height = command.height;
+            }
+            else if (command.type == RenderCommand::QUIT)
+            {
+                rendering = false;
+            }
+        }
+        if (!rendering)
+        {
+            break;
+        }
+        if (resized)
+        {
+            callbacks_.resize(width, height);
+        }
+
+        callbacks_.frame();
+        {
+            PROFILE_ZONE("swap");
+            glfwSwapBuffers(window_);
+        }
+        glTraceFrame();
+
+        const std::chrono::steady_clock::time_point frameEnd = std::chrono::steady_clock::now();
+        frameStats_.addSample(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        frameStart = frameEnd;
+    }
+
+    if (ready)
+    {
+        callbacks_.teardown();
+    }
+    glfwMakeContextCurrent(NULL);
+
+    // Wake the event thread in case it is waiting for events, so it notices.
+    //
+    running_.store(false, std::memory_order_release);
+    glfwPostEmptyEvent();
+}
@@ -0,0 +1,130 @@
+/**
+ * @file render_thread.h
+ * @brief Runs the draw loop on its own thread, fed with commands by the event thread.
+ *
+ * GLFW requires window creation and event processing on the main thread, but the
+ * context may be current on any one thread. Moving drawing and buffer swaps to a
+ * separate thread means a burst of events, such as dragging or resizing the
+ * window, no longer holds up frames, and a blocking swap no longer holds up input.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "frame_stats.h"
+#include "spsc_queue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/**
+ * @brief A message from the event thread to the render thread.
+ */
+struct RenderCommand
+{
+    /**
+     * @brief Kinds of command.
+     */
+    enum Type
+    {
+        RESIZE, //!< The framebuffer changed size.
+        QUIT    //!< Stop rendering and release the context.
+    };
+
+    Type type;  //!< What the command is.
+    int width;  //!< New framebuffer width for RESIZE.
+    int height; //!< New framebuffer height for RESIZE.
+};
+
+/**
+ * @brief Work the render thread does on behalf of the application.
+ *
+ * Every function is called on the render thread with the context current.
+ */
+struct RenderCallbacks
+{
+    std::function<bool()> setup;                       //!< Creates GL resources; returning false stops the thread.
+    std::function<void()> frame;                       //!< Renders one frame, before the swap.
+    std::function<void(int width, int height)> resize; //!< Handles a new framebuffer size.
+    std::function<void()> teardown;                    //!< Deletes GL resources.
+};
+
+/**
+ * @brief Owns the window's context and the draw loop on a dedicated thread.
+ */
+class RenderThread
+{
+public:
+    static const std::size_t QUEUE_CAPACITY = 256; //!< Commands that can be waiting at once.
+
+    RenderThread();
+    ~RenderThread();
+
+    /**
+     * @brief Starts the render thread, moving the window's context to it.
+     *
+     * Must be called on the thread the context is current on, which gives the
+     * context up.
+     *
+     * @param window window whose context to render with
+     * @param callbacks the work to do on the render thread
+     */
+    void start(GLFWwindow *window, const RenderCallbacks &callbacks);
+
+    /**
+     * @brief Sends a command to the render thread. Event thread only.
+     *
+     * If the queue is full this waits for the render thread to make room, which
+     * is at most one frame.
+     *
+     * @param command the command to send
+     */
+    void post(const RenderCommand &command);
+
+    /**
+     * @brief Asks the render thread to quit and waits for it to finish.
+     */
+    void stop();
+
+    /**
+     * @brief Whether the render thread is still rendering.
+     *
+     * @return false once the thread has quit or failed to set up
+     */
+    bool running() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief CPU time of the recent frames on the render thread, swap included.
+     *
+     * Keeps the last RECENT_FRAME_SAMPLES frames. Only safe to read after stop().
+     *
+     * @return the frame times
+     */
+    const FrameStats &frameStats() const { return frameStats_; }
+
+private:
+    RenderThread(const RenderThread &);            // Not copyable.
+    RenderThread &operator=(const RenderThread &); // Not copyable.
+
+    /**
+     * @brief Body of the render thread.
+     */
+    void run();
+
+    SpscQueue<RenderCommand, QUEUE_CAPACITY> commands_;
+    RenderCallbacks callbacks_;
+    FrameStats frameStats_;
+    GLFWwindow *window_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+};
+
+#endif // RENDER_THREAD_H
@@ -0,0 +1,127 @@
+/**
+ * @file shader_watcher.cpp
+ * @brief Notices edits to shader files so programs can be rebuilt while running.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "shader_watcher.h"
+
+#ifdef HAVE_INOTIFY
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <iostream>
+
+ShaderWatcher::ShaderWatcher()
+    : fd_(-1)
+{
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+#ifdef HAVE_INOTIFY
+    if (fd_ >= 0)
+    {
+        close(fd_); // Also removes the watches.
+    }
+#endif
+}
+
+bool ShaderWatcher::watch(const std::string &path)
+{
+#ifdef HAVE_INOTIFY
+    if (fd_ < 0)
+    {
+        fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd_ < 0)
+        {
+            std::cout << "ERROR::SHADER_WATCHER::INOTIFY_INIT_FAILED" << std::endl;
+            return false;
+        }
+    }
+
+    const std::string::size_type slash = path.rfind('/');
+    const std::string directory = slash == std::string::npos ? "." : path.substr(0, slash + 1);
+    const std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+
+    // A finished write and a file renamed into place are the two ways editors
+    // save. Watching the same directory twice returns the same descriptor.
+    //
+    const int descriptor = inotify_add_watch(fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (descriptor < 0)
+    {
+        std::cout << "ERROR::SHADER_WATCHER::CANNOT_WATCH " << directory << std::endl;
+        return false;
+    }
+
+    for (std::size_t i = 0; i < directories_.size(); ++i)
+    {
+        if (directories_[i].descriptor == descriptor)
+        {
+            directories_[i].names.push_back(name);
+            return true;
+        }
+    }
+    Directory watched;
+    watched.descriptor = descriptor;
+    watched.names.push_back(name);
+    directories_.push_back(watched);
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+bool ShaderWatcher::poll()
+{
+#ifdef HAVE_INOTIFY
+    if (fd_ < 0)
+    {
+        return false;
+    }
+
+    // Drain every queued event, so one save that produces several events
+    // triggers only one rebuild.
+    //
+    bool changed = false;
+    alignas(struct inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(fd_, buffer, sizeof(buffer))) > 0)
+    {
+        for (char *next = buffer; next < buffer + length;)
+        {
+            const struct inotify_event *event = (const struct inotify_event *)next;
+            next += sizeof(struct inotify_event) + event->len;
+            if (event->len == 0)
+            {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < directories_.size() && !changed; ++i)
+            {
+                if (directories_[i].descriptor != event->wd)
+                {
+                    continue;
+                }
+                for (std::size_t j = 0; j < directories_[i].names.size(); ++j)
+                {
+                    if (std::strcmp(directories_[i].names[j].c_str(), event->name) == 0)
+                    {
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    return changed;
+#else
+    return false;
+#endif
+}
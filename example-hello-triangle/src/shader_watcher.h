@@ -0,0 +1,66 @@
+/**
+ * @file shader_watcher.h
+ * @brief Notices edits to shader files so programs can be rebuilt while running.
+ *
+ * Uses inotify on Linux. Elsewhere watching is unavailable and watch() fails,
+ * so shaders are only read at startup.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef SHADER_WATCHER_H
+#define SHADER_WATCHER_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Watches a set of files for being written or replaced.
+ *
+ * The directories of the files are watched rather than the files, because many
+ * editors save by writing a new file and renaming it over the old one, which
+ * would end a watch on the file itself.
+ */
+class ShaderWatcher
+{
+public:
+    ShaderWatcher();
+    ~ShaderWatcher();
+
+    /**
+     * @brief Starts watching a file.
+     *
+     * @param path path of the file
+     * @return true if the file is being watched
+     */
+    bool watch(const std::string &path);
+
+    /**
+     * @brief Checks, without blocking, whether any watched file changed.
+     *
+     * Only finished writes count, so the file is complete when this returns true.
+     *
+     * @return true if a watched file was written or replaced since the last call
+     */
+    bool poll();
+
+private:
+    ShaderWatcher(const ShaderWatcher &);            // Not copyable.
+    ShaderWatcher &operator=(const ShaderWatcher &); // Not copyable.
+
+    /**
+     * @brief A watched directory and the names of the files watched in it.
+     */
+    struct Directory
+    {
+        int descriptor;                 //!< Watch descriptor returned by inotify.
+        std::vector<std::string> names; //!< Files in the directory that matter.
+    };
+
+    int fd_; // inotify instance, or -1 before the first watch().
+    std::vector<Directory> directories_;
+};
+
+#endif // SHADER_WATCHER_H
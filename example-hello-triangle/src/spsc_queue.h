@@ -0,0 +1,84 @@
+/**
+ * @file spsc_queue.h
+ * @brief Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Fixed capacity ring of items passed from one thread to another.
+ *
+ * Only one thread may push and only one thread may pop. Neither side ever
+ * blocks or takes a lock; push fails when the queue is full and pop fails when
+ * it is empty.
+ *
+ * @tparam T type of the items, copied in and out of the queue
+ * @tparam Capacity number of items the queue can hold, a power of two
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : head_(0), tail_(0) {}
+
+    /**
+     * @brief Adds an item to the back of the queue. Producer thread only.
+     *
+     * @param item the item to add
+     * @return false if the queue is full
+     */
+    bool push(const T &item)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+
+        items_[tail & (Capacity - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release); // Publishes the item.
+        return true;
+    }
+
+    /**
+     * @brief Removes the item at the front of the queue. Consumer thread only.
+     *
+     * @param item receives the item
+     * @return false if the queue is empty
+     */
+    bool pop(T &item)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        item = items_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release); // Frees the slot.
+        return true;
+    }
+
+private:
+    SpscQueue(const SpscQueue &);            // Not copyable.
+    SpscQueue &operator=(const SpscQueue &); // Not copyable.
+
+    // Each index is written by only one side. Keeping them on separate cache
+    // lines stops the two threads from invalidating each other's line.
+    //
+    alignas(64) std::atomic<std::size_t> head_; //!< Next item to pop, written by the consumer.
+    alignas(64) std::atomic<std::size_t> tail_; //!< Next slot to push, written by the producer.
+    alignas(64) T items_[Capacity];
+};
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,417 @@
+/**
+ * @file stream_buffer.cpp
+ * @brief Ring buffer for vertex data that is rewritten every frame.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "stream_buffer.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+static const GLuint64 FENCE_WAIT_NANOSECONDS = 1000000; //!< How long each glClientWaitSync call may block.
+
+/**
+ * @brief Blocks until a fence has signaled.
+ *
+ * @param fence the fence to wait for
+ * @return true if the CPU actually had to wait
+ */
+static bool waitForFence(GLsync fence)
+{
+    // Check without waiting first, so that the common case of a long finished
+    // fence is not counted as a wait. The flush makes sure the fence is on its
+    // way to the GPU, or the wait below could never end.
+    //
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+    {
+        return false;
+    }
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = glClientWaitSync(fence, 0, FENCE_WAIT_NANOSECONDS);
+    }
+    if (result == GL_WAIT_FAILED)
+    {
+        std::cout << "ERROR::STREAM_BUFFER::WAIT_FAILED" << std::endl;
+    }
+    return true;
+}
+
+StreamBuffer::StreamBuffer(GlStateCache &state)
+    : state_(state), buffer_(0), capacity_(0), alignment_(1), head_(0), fencedUpTo_(0)
+{
+    std::memset(&counters_, 0, sizeof(counters_));
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    destroy();
+}
+
+bool StreamBuffer::create(std::size_t capacity, std::size_t alignment)
+{
+    capacity_ = capacity;
+    alignment_ = alignment > 0 ? alignment : 1;
+    head_ = 0;
+    fencedUpTo_ = 0;
+
+    // Clear earlier errors so that only the allocation's is seen below.
+    //
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+    glGenBuffers(1, &buffer_);
+    state_.bindBuffer(GL_ARRAY_BUFFER, buffer_);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)capacity_, NULL, GL_STREAM_DRAW);
+    if (glGetError() != GL_NO_ERROR)
+    {
+        std::cout << "ERROR::STREAM_BUFFER::ALLOCATION_FAILED" << std::endl;
+        destroy();
+        return false;
+    }
+    return true;
+}
+
+void StreamBuffer::destroy()
+{
+    while (!inFlight_.empty())
+    {
+        glDeleteSync(inFlight_.front().fence);
+        inFlight_.pop_front();
+    }
+    if (buffer_ != 0)
+    {
+        state_.deleteBuffer(buffer_);
+        buffer_ = 0;
+    }
+}
+
+void *StreamBuffer::map(std::size_t bytes, std::size_t &offset)
+{
+    if (bytes == 0 || bytes > capacity_)
+    {
+        return NULL;
+    }
+
+    // Go back to the start when the region does not fit before the end. What
+    // was written up to here is fenced first, so that coming around to it
+    // again waits for it.
+    //
+    if (head_ + bytes > capacity_)
+    {
+        fenceWritten();
+        head_ = 0;
+        fencedUpTo_ = 0;
+        ++counters_.wraps;
+    }
+    waitForRange(head_, head_ + bytes);
+
+    // Nothing the GPU still reads overlaps the region, so the driver does not
+    // need to synchronize, and the old contents need not be kept.
+    //
+    state_.bindBuffer(GL_ARRAY_BUFFER, buffer_);
+    void *data = glMapBufferRange(GL_ARRAY_BUFFER, (GLintptr)head_, (GLsizeiptr)bytes,
+                                  GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    if (data == NULL)
+    {
+        std::cout << "ERROR::STREAM_BUFFER::MAP_FAILED" << std::endl;
+        return NULL;
+    }
+
+    offset = head_;
+    head_ += (bytes + alignment_ - 1) / alignment_ * alignment_;
+    ++counters_.maps;
+    return data;
+}
+
+bool StreamBuffer::unmap()
+{
+    state_.bindBuffer(GL_ARRAY_BUFFER, buffer_);
+    return glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+}
+
+void StreamBuffer::endFrame()
+{
+    fenceWritten();
+}
+
+void StreamBuffer::fenceWritten()
+{
+    if (head_ == fencedUpTo_)
+    {
+        return;
+    }
+
+    Region region;
+    region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    region.begin = fencedUpTo_;
+    region.end = head_ < capacity_ ? head_ : capacity_;
+    inFlight_.push_back(region);
+    fencedUpTo_ = head_;
+}
+
+void StreamBuffer::waitForRange(std::size_t begin, std::size_t end)
+{
+    // Fences signal in the order they were placed, so once the newest region
+    // that overlaps is done, so are all the regions before it.
+    //
+    std::size_t overlapping = inFlight_.size();
+    for (std::size_t i = inFlight_.size(); i-- > 0;)
+    {
+        if (inFlight_[i].begin < end && begin < inFlight_[i].end)
+        {
+            overlapping = i;
+            break;
+        }
+    }
+    if (overlapping == inFlight_.size())
+    {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (waitForFence(inFlight_[overlapping].fence))
+    {
+        ++counters_.waits;
+        counters_.waitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    for (std::size_t i = 0; i <= overlapping; ++i)
+    {
+        glDeleteSync(inFlight_.front().fence);
+        inFlight_.pop_front();
+    }
+}
+
+/**
+ * @brief Ways of getting a frame's vertices into a buffer.
+ */
+enum UploadPath
+{
+    UPLOAD_ORPHAN,  //!< glBufferData with the whole frame, so the driver can orphan the old store.
+    UPLOAD_SUBDATA, //!< glBufferSubData over the same store.
+    UPLOAD_RING,    //!< Unsynchronized writes into a fenced StreamBuffer ring.
+    UPLOAD_PATH_COUNT
+};
+
+const char *const UPLOAD_PATH_NAMES[UPLOAD_PATH_COUNT] = {"glBufferData orphan", "glBufferSubData", "stream ring"};
+
+const unsigned int FRAMES_IN_FLIGHT = 2; //!< Frames queued before the benchmark waits, like a swap chain.
+const unsigned int RING_FRAMES = 3;      //!< Frames of vertices the ring holds.
+
+/**
+ * @brief Timings of one upload path.
+ */
+struct StreamTimings
+{
+    explicit StreamTimings(unsigned long frames)
+        : upload(frames), frame(frames)
+    {
+    }
+
+    FrameStats upload; //!< Time to move and upload the frame's vertices.
+    FrameStats frame;  //!< Time from the start of one frame to the next.
+};
+
+/**
+ * @brief Moves the triangles sideways by a frame-dependent amount.
+ *
+ * @param base the triangles at rest
+ * @param frame frame number, which sets the offset
+ * @param out receives the moved vertices, as many floats as base has
+ */
+static void animateVertices(const std::vector<float> &base, unsigned long frame, float *out)
+{
+    const float dx = 0.05f * std::sin((float)frame * 0.05f);
+    for (std::size_t i = 0; i < base.size(); i += FLOATS_PER_VERTEX)
+    {
+        out[i] = base[i] + dx;
+        out[i + 1] = base[i + 1];
+        out[i + 2] = base[i + 2];
+    }
+}
+
+/**
+ * @brief Animates, uploads and draws the triangles through one path, timing each frame.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the triangles with
+ * @param path how to upload
+ * @param base the triangles at rest
+ * @param frames frames to time
+ * @param timings receives the timings
+ * @param ring receives the ring's counters, for the ring path
+ */
+static void runPath(GlStateCache &state, unsigned int shaderProgram, UploadPath path, const std::vector<float> &base,
+                    unsigned long frames, StreamTimings &timings, StreamBuffer::Counters &ring)
+{
+    const std::size_t bytes = base.size() * sizeof(float);
+    const std::size_t vertexSize = PositionLayout::STRIDE;
+    const GLsizei vertexCount = (GLsizei)(base.size() / FLOATS_PER_VERTEX);
+
+    StreamBuffer stream(state);
+    unsigned int VBO = 0;
+    if (path == UPLOAD_RING)
+    {
+        if (!stream.create(bytes * RING_FRAMES, vertexSize))
+        {
+            return;
+        }
+        VBO = stream.buffer();
+    }
+    else
+    {
+        glGenBuffers(1, &VBO);
+        state.bindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bytes, NULL, GL_STREAM_DRAW);
+    }
+
+    // The ring path draws from wherever the frame landed by passing its offset
+    // in vertices as the first vertex, so the attribute setup never changes.
+    //
+    unsigned int VAO;
+    glGenVertexArrays(1, &VAO);
+    state.bindVertexArray(VAO);
+    state.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    PositionLayout::apply();
+
+    std::vector<float> staging(path == UPLOAD_RING ? 0 : base.size());
+    std::deque<GLsync> frameFences;
+
+    glFinish();
+    std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+    for (unsigned long frame = 0; frame <= frames; ++frame)
+    {
+        // Throttle like a swap chain: wait for the oldest frame once too many
+        // are queued. Without this the driver would queue without bound.
+        //
+        if (frameFences.size() >= FRAMES_IN_FLIGHT)
+        {
+            waitForFence(frameFences.front());
+            glDeleteSync(frameFences.front());
+            frameFences.pop_front();
+        }
+
+        const std::chrono::steady_clock::time_point uploadStart = std::chrono::steady_clock::now();
+        GLint first = 0;
+        if (path == UPLOAD_RING)
+        {
+            std::size_t offset;
+            float *data = (float *)stream.map(bytes, offset);
+            if (data != NULL)
+            {
+                animateVertices(base, frame, data);
+                stream.unmap();
+                first = (GLint)(offset / vertexSize);
+            }
+        }
+        else
+        {
+            animateVertices(base, frame, &staging[0]);
+            state.bindBuffer(GL_ARRAY_BUFFER, VBO);
+            if (path == UPLOAD_ORPHAN)
+            {
+                glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bytes, &staging[0], GL_STREAM_DRAW);
+            }
+            else
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)bytes, &staging[0]);
+            }
+        }
+        const double uploadMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - uploadStart).count();
+
+        state.beginFrame();
+        state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        state.useProgram(shaderProgram);
+        state.bindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, first, vertexCount);
+        if (path == UPLOAD_RING)
+        {
+            stream.endFrame();
+        }
+        frameFences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        glFlush();
+
+        // The first frame pays for any lazy setup in the driver, so skip it.
+        //
+        const std::chrono::steady_clock::time_point frameEnd = std::chrono::steady_clock::now();
+        if (frame > 0)
+        {
+            timings.upload.addSample(uploadMs);
+            timings.frame.addSample(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        }
+        frameStart = frameEnd;
+    }
+
+    while (!frameFences.empty())
+    {
+        waitForFence(frameFences.front());
+        glDeleteSync(frameFences.front());
+        frameFences.pop_front();
+    }
+    ring = stream.counters();
+
+    state.deleteVertexArray(VAO);
+    if (path == UPLOAD_RING)
+    {
+        stream.destroy();
+    }
+    else
+    {
+        state.deleteBuffer(VBO);
+    }
+}
+
+void runStreamingBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t triangles,
+                           unsigned long frames, std::ostream &out)
+{
+    std::vector<float> base;
+    generateTriangles(triangles, base);
+    const double megabytes = (double)(base.size() * sizeof(float)) / 1.0e6;
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Streaming benchmark: " << triangles << " triangles (" << std::setprecision(3) << megabytes
+        << " MB) re-uploaded every frame, " << frames << " frames per path on " << glGetString(GL_RENDERER)
+        << std::endl;
+
+    double medians[UPLOAD_PATH_COUNT];
+    for (int path = 0; path < UPLOAD_PATH_COUNT; ++path)
+    {
+        StreamTimings timings(frames);
+        StreamBuffer::Counters ring;
+        std::memset(&ring, 0, sizeof(ring));
+        runPath(state, shaderProgram, (UploadPath)path, base, frames, timings, ring);
+
+        out << UPLOAD_PATH_NAMES[path] << "\n";
+        timings.upload.report(out, "upload");
+        timings.frame.report(out, "frame");
+        medians[path] = timings.frame.percentile(50.0);
+        if (path == UPLOAD_RING)
+        {
+            out << std::fixed << std::setprecision(3) << "  ring              " << ring.maps << " maps, "
+                << ring.wraps << " wraps, " << ring.waits << " waits, " << ring.waitMs << " ms waiting" << std::endl;
+        }
+    }
+
+    out << std::fixed << std::setprecision(1) << "ring frame p50 vs orphan "
+        << medians[UPLOAD_ORPHAN] / medians[UPLOAD_RING] << "x, vs subdata "
+        << medians[UPLOAD_SUBDATA] / medians[UPLOAD_RING] << "x" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file stream_buffer.h
+ * @brief Ring buffer for vertex data that is rewritten every frame.
+ *
+ * Re-uploading with glBufferData or glBufferSubData either makes the driver
+ * allocate fresh storage each time or makes it wait until the GPU has finished
+ * reading the old contents. The ring instead maps a region the GPU is known to
+ * be done with, without synchronization, and writes straight into it. Each
+ * frame's region is guarded by a fence, and the CPU only waits on a fence when
+ * it comes back around to a region the GPU may still be reading.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+
+#include <cstddef>
+#include <deque>
+#include <ostream>
+
+/**
+ * @brief A large vertex buffer written as a ring, with a fence per written region.
+ *
+ * Data written by one map() must be drawn before the next map() or endFrame(),
+ * since the fence placed then has to come after the draws that read it.
+ */
+class StreamBuffer
+{
+public:
+    /**
+     * @brief Number of times the CPU had to wait for the GPU.
+     */
+    struct Counters
+    {
+        unsigned long maps;  //!< Regions handed out.
+        unsigned long wraps; //!< Times the ring went back to the start.
+        unsigned long waits; //!< Maps that had to wait for a fence to signal.
+        double waitMs;       //!< Time spent waiting for fences.
+    };
+
+    explicit StreamBuffer(GlStateCache &state);
+    ~StreamBuffer();
+
+    /**
+     * @brief Creates the buffer.
+     *
+     * @param capacity size of the ring in bytes; a few frames of data
+     * @param alignment every region starts at a multiple of this, e.g. the vertex
+     *                  size so offsets can be passed to glDrawArrays as vertices
+     * @return true if the buffer was created
+     */
+    bool create(std::size_t capacity, std::size_t alignment);
+
+    /**
+     * @brief Deletes the buffer and any fences still pending.
+     */
+    void destroy();
+
+    /**
+     * @brief Maps the next region of the ring for writing.
+     *
+     * Waits only if the region is still being read by the GPU. The buffer is
+     * left bound to GL_ARRAY_BUFFER.
+     *
+     * @param bytes size of the region, at most the capacity
+     * @param offset receives the offset of the region in the buffer
+     * @return pointer to write the data to, or NULL if the region cannot be mapped
+     */
+    void *map(std::size_t bytes, std::size_t &offset);
+
+    /**
+     * @brief Unmaps the region returned by map().
+     *
+     * @return false if the contents were lost and have to be written again
+     */
+    bool unmap();
+
+    /**
+     * @brief Fences everything written since the last fence. Call after the frame's draws.
+     */
+    void endFrame();
+
+    unsigned int buffer() const { return buffer_; }
+    const Counters &counters() const { return counters_; }
+
+private:
+    StreamBuffer(const StreamBuffer &);            // Not copyable.
+    StreamBuffer &operator=(const StreamBuffer &); // Not copyable.
+
+    /**
+     * @brief Written bytes the GPU may still be reading, up to a fence.
+     */
+    struct Region
+    {
+        GLsync fence;      //!< Signals once the GPU has finished the draws that read the region.
+        std::size_t begin; //!< First byte of the region.
+        std::size_t end;   //!< One past the last byte of the region.
+    };
+
+    void fenceWritten();
+    void waitForRange(std::size_t begin, std::size_t end);
+
+    GlStateCache &state_;
+    unsigned int buffer_;
+    std::size_t capacity_;
+    std::size_t alignment_;
+    std::size_t head_;            // Where the next region starts.
+    std::size_t fencedUpTo_;      // Start of the bytes written but not fenced yet.
+    std::deque<Region> inFlight_; // Oldest first.
+    Counters counters_;
+};
+
+/**
+ * @brief Compares ways of re-uploading animated triangles every frame.
+ *
+ * Each frame the triangles are moved a little and uploaded again, with
+ * glBufferData orphaning, with glBufferSubData, and through a StreamBuffer
+ * ring, then drawn. Frames are not waited on with glFinish, since that would
+ * hide the stalls being measured; instead at most two frames are allowed in
+ * flight, as a swap chain would. Needs a current context with a render
+ * target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the triangles with
+ * @param triangles number of triangles to animate
+ * @param frames frames to time for each path
+ * @param out stream to write the report to
+ */
+void runStreamingBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t triangles,
+                           unsigned long frames, std::ostream &out);
+
+#endif // STREAM_BUFFER_H
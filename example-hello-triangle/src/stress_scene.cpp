@@ -0,0 +1,202 @@
+/**
+ * @file stress_scene.cpp
+ * @brief Sweeps the triangle count to find where vertex throughput becomes the limit.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "stress_scene.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+
+// Shortest draw time a step is credited with. A small step can measure at or
+// below the empty frame, and dividing by that would make its throughput
+// meaningless.
+//
+static const double MIN_DRAW_MILLISECONDS = 0.001;
+
+/**
+ * @brief Result of one step of the sweep.
+ */
+struct StressStep
+{
+    std::size_t triangles;     //!< Triangles drawn per frame.
+    double uploadMilliseconds; //!< Time to upload the triangles.
+    double uploadBandwidth;    //!< Upload bandwidth in MB/s.
+    double frameMilliseconds;  //!< Median frame time.
+    double drawMilliseconds;   //!< Median frame time less that of an empty frame.
+    double trianglesPerSecond; //!< Triangles drawn per second of draw time.
+};
+
+/**
+ * @brief Times frames that clear the target and draw a vertex array.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw with
+ * @param VAO vertex array to draw
+ * @param vertexCount vertices to draw; with 0 the frame only clears
+ * @param frames frames to time
+ * @return the median frame time in milliseconds
+ */
+static double timeFrames(GlStateCache &state, unsigned int shaderProgram, unsigned int VAO, GLsizei vertexCount,
+                         unsigned long frames)
+{
+    FrameStats frameTimes(frames);
+    for (unsigned long frame = 0; frame <= frames; ++frame)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        state.beginFrame();
+        state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        state.useProgram(shaderProgram);
+        state.bindVertexArray(VAO);
+        if (vertexCount > 0)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+        }
+        glFinish();
+
+        // The first frame pays for any lazy setup in the driver, so skip it.
+        //
+        if (frame > 0)
+        {
+            frameTimes.addSample(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+    return frameTimes.percentile(50.0);
+}
+
+/**
+ * @brief Uploads and draws a number of triangles, timing both.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the triangles with
+ * @param triangles number of triangles
+ * @param frames frames to time
+ * @param halfPositions upload x, y halves instead of x, y, z floats
+ * @param emptyMilliseconds median time of a frame that draws nothing
+ * @return the timings
+ */
+static StressStep runStep(GlStateCache &state, unsigned int shaderProgram, std::size_t triangles, unsigned long frames,
+                          bool halfPositions, double emptyMilliseconds)
+{
+    StressStep step;
+    step.triangles = triangles;
+
+    std::vector<float> vertices;
+    generateTriangles(triangles, vertices);
+    std::vector<Half> halves;
+    if (halfPositions)
+    {
+        packHalfPositions(vertices, halves);
+        std::vector<float>().swap(vertices);
+    }
+    const std::size_t bytes = halfPositions ? halves.size() * sizeof(Half) : vertices.size() * sizeof(float);
+
+    // Time the upload through the same path the scene uses, waiting until the
+    // data has actually reached the buffer.
+    //
+    unsigned int VAO;
+    unsigned int VBO;
+    glFinish();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (halfPositions)
+    {
+        createVertexArray<HalfPositionLayout>(state, &halves[0], bytes, VAO, VBO);
+    }
+    else
+    {
+        createVertexArray<PositionLayout>(state, &vertices[0], bytes, VAO, VBO);
+    }
+    glFinish();
+    step.uploadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    step.uploadBandwidth = (double)bytes / 1.0e6 / (step.uploadMilliseconds / 1000.0);
+
+    // The CPU copy is no longer needed; free it so the largest steps fit.
+    //
+    std::vector<float>().swap(vertices);
+    std::vector<Half>().swap(halves);
+
+    // The clear and the wait cost the same at every step; only what the draw
+    // adds on top of them tells how the triangles scale.
+    //
+    const GLsizei vertexCount = (GLsizei)(triangles * VERTICES_PER_TRIANGLE);
+    step.frameMilliseconds = timeFrames(state, shaderProgram, VAO, vertexCount, frames);
+    step.drawMilliseconds = std::max(step.frameMilliseconds - emptyMilliseconds, MIN_DRAW_MILLISECONDS);
+    step.trianglesPerSecond = (double)triangles / (step.drawMilliseconds / 1000.0);
+
+    state.deleteVertexArray(VAO);
+    state.deleteBuffer(VBO);
+
+    return step;
+}
+
+void runStressSweep(GlStateCache &state, unsigned int shaderProgram, std::size_t maxTriangles,
+                    unsigned long frames, bool halfPositions, std::ostream &out)
+{
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    // An empty frame: the same clear, program and wait, with no vertex array.
+    //
+    const double emptyMilliseconds = timeFrames(state, shaderProgram, 0, 0, frames);
+
+    out << std::fixed << std::setprecision(3);
+    out << "Stress sweep: " << frames << " frames per step on " << glGetString(GL_RENDERER) << ", "
+        << (halfPositions ? (std::size_t)HalfPositionLayout::STRIDE : (std::size_t)PositionLayout::STRIDE) << " bytes per vertex\n"
+        << "Empty frame p50 " << emptyMilliseconds << " ms, taken off each step's frame time for its draw time\n"
+        << std::setw(12) << "triangles" << std::setw(12) << "upload ms" << std::setw(14) << "upload MB/s"
+        << std::setw(14) << "frame p50 ms" << std::setw(12) << "draw ms" << std::setw(12) << "Mtri/s" << std::endl;
+
+    // Ten times more triangles each step, up to the maximum.
+    //
+    std::vector<StressStep> steps;
+    std::size_t triangles = 1;
+    while (true)
+    {
+        const StressStep step = runStep(state, shaderProgram, triangles, frames, halfPositions, emptyMilliseconds);
+        steps.push_back(step);
+
+        out << std::setw(12) << step.triangles << std::setw(12) << step.uploadMilliseconds
+            << std::setw(14) << step.uploadBandwidth << std::setw(14) << step.frameMilliseconds
+            << std::setw(12) << step.drawMilliseconds << std::setw(12) << step.trianglesPerSecond / 1.0e6 << std::endl;
+
+        if (triangles >= maxTriangles)
+        {
+            break;
+        }
+        triangles = (triangles > maxTriangles / 10) ? maxTriangles : triangles * 10;
+    }
+
+    // Every step's triangles cover the same pixels, so a draw costs about the
+    // same fixed amount for submitting it and filling them, plus an amount per
+    // triangle. The one-triangle step is nearly all fixed cost and the largest
+    // nearly all per-triangle cost; the knee is where the two are equal, below
+    // it adding triangles is almost free and above it they set the draw time.
+    //
+    if (steps.size() > 1)
+    {
+        const StressStep &first = steps.front();
+        const StressStep &last = steps.back();
+        const double perTriangle =
+            (last.drawMilliseconds - first.drawMilliseconds) / (double)(last.triangles - first.triangles);
+        const double fixed = first.drawMilliseconds - perTriangle * (double)first.triangles;
+        if (perTriangle > 0.0 && fixed > 0.0)
+        {
+            out << std::setprecision(0) << "Knee at about " << fixed / perTriangle
+                << " triangles per frame; above it vertex throughput, not submission, limits the draw" << std::endl;
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
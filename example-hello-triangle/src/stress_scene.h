@@ -0,0 +1,45 @@
+/**
+ * @file stress_scene.h
+ * @brief Sweeps the triangle count to find where vertex throughput becomes the limit.
+ *
+ * With few triangles, draw time is dominated by the fixed cost of submitting a
+ * draw, so triangles per second grows in step with the triangle count. Once
+ * the GPU's vertex throughput is the limit, draw time grows with the triangle
+ * count instead and triangles per second levels off. The sweep reports both,
+ * along with the bandwidth of uploading the triangles. Draw time is the frame
+ * time less that of an empty frame, so the clear and the wait, which cost the
+ * same at every step, do not hide the knee. The knee is reported as the
+ * triangle count at which the per-triangle part of the draw time catches up
+ * with its fixed part.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef STRESS_SCENE_H
+#define STRESS_SCENE_H
+
+#include "gl_state_cache.h"
+
+#include <cstddef>
+#include <ostream>
+
+/**
+ * @brief Draws 1, 10, 100, ... triangles up to a maximum and reports the scaling.
+ *
+ * Each step uploads freshly generated triangles through a new vertex array and
+ * buffer, then times the given number of frames. Every frame is waited on with
+ * glFinish. An empty frame is timed the same way first, as the baseline. Needs a current context with a render target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the triangles with
+ * @param maxTriangles triangles in the last step
+ * @param frames frames to time at each step
+ * @param halfPositions upload x, y halves instead of x, y, z floats
+ * @param out stream to write the report to
+ */
+void runStressSweep(GlStateCache &state, unsigned int shaderProgram, std::size_t maxTriangles,
+                    unsigned long frames, bool halfPositions, std::ostream &out);
+
+#endif // STRESS_SCENE_H
@@ -0,0 +1,93 @@
+/**
+ * @file thread_pool.cpp
+ * @brief A fixed set of worker threads for splitting one job into many tasks.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(std::size_t threads)
+    : task_(NULL), count_(0), next_(0), busy_(0), generation_(0), stop_(false)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        workers_.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::size_t i = 0; i < workers_.size(); ++i)
+    {
+        workers_[i].join();
+    }
+}
+
+void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)> &task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        next_ = 0;
+        busy_ = workers_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_ == 0; });
+    task_ = NULL;
+}
+
+void ThreadPool::workerLoop()
+{
+    unsigned long seen = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+            if (stop_)
+            {
+                return;
+            }
+            seen = generation_;
+        }
+
+        work();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--busy_ == 0)
+        {
+            done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::work()
+{
+    std::size_t index;
+    while ((index = next_.fetch_add(1)) < count_)
+    {
+        (*task_)(index);
+    }
+}
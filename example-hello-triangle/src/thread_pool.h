@@ -0,0 +1,74 @@
+/**
+ * @file thread_pool.h
+ * @brief A fixed set of worker threads for splitting one job into many tasks.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Worker threads that run numbered tasks in parallel.
+ *
+ * The threads are started once and sleep between jobs, so a job costs a wake
+ * up rather than a thread creation. The calling thread works on the job too.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Starts the workers.
+     *
+     * @param threads threads to run tasks on, including the caller; 0 uses one
+     *                per hardware thread
+     */
+    explicit ThreadPool(std::size_t threads = 0);
+    ~ThreadPool();
+
+    /**
+     * @brief Runs task(0) to task(count - 1), returning when all are done.
+     *
+     * Tasks are handed out in order to whichever thread is free, so they may
+     * run in any order and at the same time as each other.
+     *
+     * @param count number of tasks
+     * @param task the work, given the number of the task
+     */
+    void run(std::size_t count, const std::function<void(std::size_t)> &task);
+
+    /**
+     * @brief Threads that run tasks, including the caller of run().
+     */
+    std::size_t size() const { return workers_.size() + 1; }
+
+private:
+    ThreadPool(const ThreadPool &);            // Not copyable.
+    ThreadPool &operator=(const ThreadPool &); // Not copyable.
+
+    void workerLoop();
+    void work();
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;                  // Signals a new job or stop_.
+    std::condition_variable done_;                  // Signals busy_ reaching zero.
+    const std::function<void(std::size_t)> *task_; // The current job.
+    std::size_t count_;                             // Tasks in the current job.
+    std::atomic<std::size_t> next_;                 // Next task to hand out.
+    std::size_t busy_;                              // Workers still on the current job.
+    unsigned long generation_;                      // Increments for each job.
+    bool stop_;
+};
+
+#endif // THREAD_POOL_H
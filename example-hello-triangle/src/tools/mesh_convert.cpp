@@ -0,0 +1,435 @@
+/**
+ * @file mesh_convert.cpp
+ * @brief Converts meshes to the binary mesh file format the example loads with --mesh.
+ *
+ * Does all the work that would otherwise be repeated on every load: parsing
+ * the text, reordering for the vertex cache and packing the vertices.
+ *
+ * --import-bench writes large synthetic OBJ and PLY files, imports them and
+ * checks every triangle against what was written, reporting the throughput.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "geometry.h"
+#include "mesh_file.h"
+#include "mesh_import.h"
+#include "mesh_optimizer.h"
+#include "thread_pool.h"
+#include "vertex_layout.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef VertexLayout<Attribute<0, Half, 4> > HalfPosition4Layout; //!< x, y, z, 1 as halves, 8 bytes.
+
+/**
+ * @brief Prints the command line usage.
+ *
+ * @param program name the program was invoked with
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "usage: " << program << " [--no-optimize] [--half-positions] INPUT OUTPUT\n"
+              << "       " << program << " [--no-optimize] [--half-positions] --grid N OUTPUT\n"
+              << "       " << program << " --import-bench N PREFIX\n"
+              << "  INPUT             OBJ or PLY file to convert; only positions and faces are kept\n"
+              << "  --grid N          generate an N by N grid of quads instead, in shuffled order\n"
+              << "  --import-bench N  write N by N grids of quads to PREFIX.obj and PREFIX-*.ply,\n"
+              << "                    import and check them, and report the throughput\n"
+              << "  --no-optimize     keep the triangle and vertex order of the input\n"
+              << "  --half-positions  store positions as four halves (8 bytes) instead of three\n"
+              << "                    floats (12 bytes)" << std::endl;
+}
+
+/**
+ * @brief Positions of the corners of a synthetic grid, and how to write them.
+ *
+ * The corners are jittered so they are not round numbers, and every seventh z
+ * is tiny so some numbers need an exponent. Printing with nine significant
+ * digits lets every float be read back exactly.
+ */
+struct BenchGrid
+{
+    unsigned long size;         //!< Quads along each side.
+    std::vector<float> corners; //!< x, y, z of the (size + 1)^2 corners, row by row.
+
+    /**
+     * @brief Index of the corner at a column and row.
+     */
+    std::size_t corner(unsigned long column, unsigned long row) const { return row * (size + 1) + column; }
+
+    /**
+     * @brief Index of corner 0 to 3 of a quad, counter-clockwise.
+     */
+    std::size_t quadCorner(std::size_t quad, int which) const
+    {
+        const unsigned long column = (unsigned long)(quad % size) + (which == 1 || which == 2);
+        const unsigned long row = (unsigned long)(quad / size) + (which >= 2);
+        return corner(column, row);
+    }
+};
+
+static void makeBenchGrid(unsigned long size, BenchGrid &grid)
+{
+    std::mt19937 random(12345);
+    std::uniform_real_distribution<float> jitter(-0.25f, 0.25f);
+    grid.size = size;
+    grid.corners.resize((std::size_t)(size + 1) * (size + 1) * 3);
+    for (unsigned long row = 0; row <= size; ++row)
+    {
+        for (unsigned long column = 0; column <= size; ++column)
+        {
+            float *position = &grid.corners[grid.corner(column, row) * 3];
+            position[0] = ((float)column + jitter(random)) / (float)size * 2.0f - 1.0f;
+            position[1] = ((float)row + jitter(random)) / (float)size * 2.0f - 1.0f;
+            position[2] = jitter(random) * (grid.corner(column, row) % 7 == 0 ? 1e-30f : 1.0f);
+        }
+    }
+}
+
+/**
+ * @brief Writes a grid as an OBJ file with four positions per quad.
+ *
+ * Every shared corner is repeated, for the importer to merge, and faces use
+ * negative indices, which resolve across the importer's chunks.
+ */
+static bool writeBenchObj(const std::string &path, const BenchGrid &grid)
+{
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    std::fprintf(file, "# %lu by %lu quads\n", grid.size, grid.size);
+    const std::size_t quads = (std::size_t)grid.size * grid.size;
+    for (std::size_t quad = 0; quad < quads; ++quad)
+    {
+        for (int which = 0; which < 4; ++which)
+        {
+            const float *position = &grid.corners[grid.quadCorner(quad, which) * 3];
+            std::fprintf(file, "v %.9g %.9g %.9g\n", position[0], position[1], position[2]);
+        }
+        std::fprintf(file, "vn 0 0 1\nf -4//1 -3//1 -2//1 -1//1\n");
+    }
+    return std::fclose(file) == 0;
+}
+
+/**
+ * @brief Writes a grid as an ascii PLY file, with normals to skip and quad faces.
+ */
+static bool writeBenchAsciiPly(const std::string &path, const BenchGrid &grid)
+{
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    const std::size_t quads = (std::size_t)grid.size * grid.size;
+    std::fprintf(file,
+                 "ply\nformat ascii 1.0\nelement vertex %lu\nproperty float x\nproperty float y\n"
+                 "property float z\nproperty float nx\nproperty float ny\nproperty float nz\n"
+                 "element face %lu\nproperty list uchar int vertex_indices\nend_header\n",
+                 (unsigned long)(grid.corners.size() / 3), (unsigned long)quads);
+    for (std::size_t i = 0; i < grid.corners.size(); i += 3)
+    {
+        std::fprintf(file, "%.9g %.9g %.9g 0 0 1\n", grid.corners[i], grid.corners[i + 1], grid.corners[i + 2]);
+    }
+    for (std::size_t quad = 0; quad < quads; ++quad)
+    {
+        std::fprintf(file, "4 %lu %lu %lu %lu\n", (unsigned long)grid.quadCorner(quad, 0),
+                     (unsigned long)grid.quadCorner(quad, 1), (unsigned long)grid.quadCorner(quad, 2),
+                     (unsigned long)grid.quadCorner(quad, 3));
+    }
+    return std::fclose(file) == 0;
+}
+
+/**
+ * @brief Writes bytes in big or little endian order.
+ */
+static void writeBytes(std::FILE *file, const void *value, std::size_t size, bool bigEndian)
+{
+    unsigned char bytes[8];
+    std::memcpy(bytes, value, size);
+    const std::uint16_t one = 1;
+    if (bigEndian == (*(const unsigned char *)&one == 1))
+    {
+        for (std::size_t i = 0; i < size / 2; ++i)
+        {
+            std::swap(bytes[i], bytes[size - 1 - i]);
+        }
+    }
+    std::fwrite(bytes, 1, size, file);
+}
+
+/**
+ * @brief Writes a grid as a binary PLY file with triangle faces.
+ */
+static bool writeBenchBinaryPly(const std::string &path, const BenchGrid &grid, bool bigEndian)
+{
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    const std::size_t quads = (std::size_t)grid.size * grid.size;
+    std::fprintf(file,
+                 "ply\nformat %s 1.0\ncomment synthetic grid\nelement vertex %lu\nproperty float x\n"
+                 "property float y\nproperty float z\nelement face %lu\n"
+                 "property list uchar uint vertex_indices\nend_header\n",
+                 bigEndian ? "binary_big_endian" : "binary_little_endian", (unsigned long)(grid.corners.size() / 3),
+                 (unsigned long)quads * 2);
+    for (std::size_t i = 0; i < grid.corners.size(); ++i)
+    {
+        writeBytes(file, &grid.corners[i], sizeof(float), bigEndian);
+    }
+    static const int TRIANGLES[2][3] = {{0, 1, 2}, {0, 2, 3}};
+    for (std::size_t quad = 0; quad < quads; ++quad)
+    {
+        for (int t = 0; t < 2; ++t)
+        {
+            const unsigned char three = 3;
+            std::fwrite(&three, 1, 1, file);
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t index = (std::uint32_t)grid.quadCorner(quad, TRIANGLES[t][k]);
+                writeBytes(file, &index, sizeof(index), bigEndian);
+            }
+        }
+    }
+    return std::fclose(file) == 0;
+}
+
+/**
+ * @brief Checks an imported grid: every corner merged once, and every triangle
+ *        made of exactly the positions that were written.
+ */
+static bool checkBenchGrid(const BenchGrid &grid, const std::vector<float> &vertices,
+                           const std::vector<GLuint> &indices)
+{
+    const std::size_t quads = (std::size_t)grid.size * grid.size;
+    if (vertices.size() != grid.corners.size() || indices.size() != quads * 6)
+    {
+        return false;
+    }
+    static const int TRIANGLES[2][3] = {{0, 1, 2}, {0, 2, 3}};
+    for (std::size_t quad = 0; quad < quads; ++quad)
+    {
+        for (int t = 0; t < 2; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                const float *expected = &grid.corners[grid.quadCorner(quad, TRIANGLES[t][k]) * 3];
+                const float *actual = &vertices[indices[quad * 6 + t * 3 + k] * 3];
+                if (std::memcmp(expected, actual, 3 * sizeof(float)) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Writes, imports and checks a synthetic grid in each supported format.
+ *
+ * @param size quads along each side of the grid
+ * @param prefix path prefix for the files, which are removed afterwards
+ * @return true if every import matched what was written
+ */
+static bool runImportBench(unsigned long size, const std::string &prefix)
+{
+    BenchGrid grid;
+    makeBenchGrid(size, grid);
+
+    static const char *FORMATS[] = {"obj", "ascii ply", "binary ply", "big endian ply"};
+    static const char *SUFFIXES[] = {".obj", "-ascii.ply", "-binary.ply", "-big-endian.ply"};
+    ThreadPool pool;
+    bool passed = true;
+    for (int format = 0; format < 4; ++format)
+    {
+        const std::string path = prefix + SUFFIXES[format];
+        bool written;
+        if (format == 0)
+        {
+            written = writeBenchObj(path, grid);
+        }
+        else if (format == 1)
+        {
+            written = writeBenchAsciiPly(path, grid);
+        }
+        else
+        {
+            written = writeBenchBinaryPly(path, grid, format == 3);
+        }
+        if (!written)
+        {
+            std::cout << "Cannot write " << path << std::endl;
+            return false;
+        }
+
+        std::vector<float> vertices;
+        std::vector<GLuint> indices;
+        ImportStats stats;
+        const bool imported = importMesh(path, pool, vertices, indices, &stats);
+        const bool matched = imported && checkBenchGrid(grid, vertices, indices);
+        std::remove(path.c_str());
+        passed = passed && matched;
+
+        std::cout << FORMATS[format] << ": ";
+        if (imported)
+        {
+            std::cout << stats.bytes / 1e6 << " MB in " << stats.milliseconds << " ms, "
+                      << stats.bytes / 1e3 / stats.milliseconds << " MB/s on " << stats.threads << " threads, "
+                      << stats.duplicates << " duplicates merged, ";
+        }
+        std::cout << (matched ? "ok" : "MISMATCH") << std::endl;
+    }
+    return passed;
+}
+
+int main(int argc, char *argv[])
+{
+    bool optimize = true;
+    bool halfPositions = false;
+    unsigned long grid = 0;
+    unsigned long importBench = 0;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--no-optimize") == 0)
+        {
+            optimize = false;
+        }
+        else if (std::strcmp(argv[i], "--half-positions") == 0)
+        {
+            halfPositions = true;
+        }
+        else if (std::strcmp(argv[i], "--grid") == 0 && i + 1 < argc)
+        {
+            char *end;
+            grid = std::strtoul(argv[++i], &end, 10);
+            if (*end != '\0' || grid == 0 || grid > 20000)
+            {
+                std::cout << "Invalid grid size: " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::strcmp(argv[i], "--import-bench") == 0 && i + 1 < argc)
+        {
+            char *end;
+            importBench = std::strtoul(argv[++i], &end, 10);
+            if (*end != '\0' || importBench == 0 || importBench > 20000)
+            {
+                std::cout << "Invalid grid size: " << argv[i] << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (argv[i][0] == '-')
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.size() != (grid > 0 || importBench > 0 ? 1u : 2u))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (importBench > 0)
+    {
+        return runImportBench(importBench, paths[0]) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<float> positions;
+    std::vector<GLuint> indices;
+    ImportStats stats;
+    std::memset(&stats, 0, sizeof(stats));
+    if (grid > 0)
+    {
+        generateGrid(grid, grid, positions, indices);
+    }
+    else
+    {
+        ThreadPool pool;
+        if (!importMesh(paths[0], pool, positions, indices, &stats))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    const std::size_t vertexCount = positions.size() / FLOATS_PER_VERTEX;
+    const std::chrono::steady_clock::time_point imported = std::chrono::steady_clock::now();
+
+    const double acmrBefore = computeAcmr(indices, vertexCount);
+    double acmrAfter = acmrBefore;
+    std::size_t usedVertices = vertexCount;
+    if (optimize)
+    {
+        optimizeVertexCache(indices, vertexCount);
+        usedVertices = optimizeVertexFetch(indices, positions, FLOATS_PER_VERTEX);
+        acmrAfter = computeAcmr(indices, usedVertices);
+    }
+    const std::chrono::steady_clock::time_point optimized = std::chrono::steady_clock::now();
+
+    MeshFileAttribute attribute;
+    std::memset(&attribute, 0, sizeof(attribute));
+    attribute.location = 0;
+    bool written;
+    if (halfPositions)
+    {
+        std::vector<Half> halves(usedVertices * 4);
+        for (std::size_t i = 0; i < usedVertices; ++i)
+        {
+            halves[i * 4] = floatToHalf(positions[i * FLOATS_PER_VERTEX]);
+            halves[i * 4 + 1] = floatToHalf(positions[i * FLOATS_PER_VERTEX + 1]);
+            halves[i * 4 + 2] = floatToHalf(positions[i * FLOATS_PER_VERTEX + 2]);
+            halves[i * 4 + 3] = floatToHalf(1.0f);
+        }
+        attribute.type = GL_HALF_FLOAT;
+        attribute.count = 4;
+        written = writeMeshFile(paths.back(), &attribute, 1, HalfPosition4Layout::STRIDE,
+                                halves.empty() ? NULL : &halves[0], usedVertices, indices);
+    }
+    else
+    {
+        attribute.type = GL_FLOAT;
+        attribute.count = 3;
+        written = writeMeshFile(paths.back(), &attribute, 1, PositionLayout::STRIDE,
+                                positions.empty() ? NULL : &positions[0], usedVertices, indices);
+    }
+    if (!written)
+    {
+        return EXIT_FAILURE;
+    }
+    const std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+    std::cout << paths.back() << ": " << usedVertices << " vertices, " << indices.size() / 3 << " triangles\n"
+              << "  read " << std::chrono::duration<double, std::milli>(imported - start).count() << " ms";
+    if (stats.bytes > 0)
+    {
+        std::cout << " (" << stats.bytes / 1e3 / stats.milliseconds << " MB/s on " << stats.threads << " threads, "
+                  << stats.duplicates << " duplicate vertices merged)";
+    }
+    std::cout << ", optimized "
+              << std::chrono::duration<double, std::milli>(optimized - imported).count() << " ms, written "
+              << std::chrono::duration<double, std::milli>(finished - optimized).count() << " ms\n"
+              << "  ACMR " << acmrBefore << " -> " << acmrAfter << " for a " << VERTEX_CACHE_SIZE
+              << " entry cache" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,576 @@
+/**
+ * @file upload_worker.cpp
+ * @brief Loads and uploads buffers and textures on a second thread with a shared context.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "upload_worker.h"
+
+#include "frame_stats.h"
+#include "geometry.h"
+#include "image.h"
+#include "shader.h"
+#include "vertex_layout.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+const std::size_t UploadWorker::QUEUE_CAPACITY;
+
+/**
+ * @brief Resets an upload to no objects.
+ */
+static void clearUpload(std::uint32_t id, Upload &upload)
+{
+    upload.id = id;
+    upload.loaded = false;
+    upload.vertexBuffer = 0;
+    upload.elementBuffer = 0;
+    upload.indexCount = 0;
+    upload.indexType = GL_UNSIGNED_INT;
+    upload.vertexStride = 0;
+    upload.attributes.clear();
+    upload.texture = 0;
+    upload.program = 0;
+    upload.bytes = 0;
+    upload.loadMs = 0.0;
+}
+
+/**
+ * @brief Deletes an upload's objects directly, for uploads no state cache has seen.
+ */
+static void deleteObjects(const Upload &upload)
+{
+    const GLuint buffers[2] = {upload.vertexBuffer, upload.elementBuffer};
+    glDeleteBuffers(2, buffers);
+    if (upload.texture != 0)
+    {
+        glDeleteTextures(1, &upload.texture);
+    }
+    if (upload.program != 0)
+    {
+        glDeleteProgram(upload.program);
+    }
+}
+
+UploadWorker::UploadWorker()
+    : haveNext_(false), stopping_(false), nextId_(0), pending_(0)
+{
+}
+
+UploadWorker::~UploadWorker()
+{
+    stop();
+}
+
+void UploadWorker::start(const std::function<bool()> &makeCurrent, const std::function<void()> &release)
+{
+    stopping_.store(false);
+    thread_ = std::thread(&UploadWorker::run, this, makeCurrent, release);
+}
+
+std::uint32_t UploadWorker::submit(const Job &job)
+{
+    Request request;
+    request.id = nextId_++;
+    request.job = job;
+    request.submitted = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requests_.push_back(request);
+    }
+    wake_.notify_one();
+    ++pending_;
+    return request.id;
+}
+
+bool UploadWorker::poll(Upload &upload)
+{
+    if (!haveNext_)
+    {
+        if (!finished_.pop(next_))
+        {
+            return false;
+        }
+        haveNext_ = true;
+    }
+
+    // Uploads finish in order, so only the oldest fence needs checking. A zero
+    // timeout only asks; the worker flushed, so the fence will get there.
+    //
+    if (next_.fence != NULL)
+    {
+        const GLenum status = glClientWaitSync(next_.fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        {
+            return false;
+        }
+        glDeleteSync(next_.fence);
+        next_.fence = NULL;
+    }
+
+    upload = next_.upload;
+    haveNext_ = false;
+    --pending_;
+    return true;
+}
+
+void UploadWorker::stop()
+{
+    if (!thread_.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_.store(true);
+        requests_.clear();
+    }
+    wake_.notify_one();
+    thread_.join();
+
+    // Nobody will poll these now. The objects are shared, so they can be
+    // deleted from this context.
+    //
+    if (haveNext_)
+    {
+        discard(next_);
+        haveNext_ = false;
+    }
+    Finished finished;
+    while (finished_.pop(finished))
+    {
+        discard(finished);
+    }
+    pending_ = 0;
+}
+
+void UploadWorker::discard(const Finished &finished)
+{
+    if (finished.fence != NULL)
+    {
+        glDeleteSync(finished.fence);
+    }
+    deleteObjects(finished.upload);
+}
+
+void UploadWorker::run(std::function<bool()> makeCurrent, std::function<void()> release)
+{
+    const bool current = makeCurrent();
+    if (!current)
+    {
+        std::cout << "ERROR::UPLOAD_WORKER::CONTEXT_NOT_CURRENT" << std::endl;
+    }
+
+    // The worker's context has its own bindings, so it needs its own shadow.
+    //
+    GlStateCache state;
+    while (true)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (!stopping_.load() && requests_.empty())
+            {
+                wake_.wait(lock);
+            }
+            if (stopping_.load())
+            {
+                break;
+            }
+            request = requests_.front();
+            requests_.pop_front();
+        }
+
+        Finished finished;
+        clearUpload(request.id, finished.upload);
+        finished.fence = NULL;
+        finished.upload.loaded = current && request.job(state, finished.upload);
+        if (finished.upload.loaded)
+        {
+            // The fence goes in after the upload commands. They have to reach
+            // the GPU before another context can see the fence signal, so flush.
+            //
+            finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+        }
+        else if (current)
+        {
+            deleteUpload(state, finished.upload);
+            clearUpload(request.id, finished.upload);
+        }
+        finished.upload.loadMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - request.submitted).count();
+
+        // If the render thread falls behind, wait for it rather than let uploads
+        // pile up in memory.
+        //
+        while (!finished_.push(finished))
+        {
+            if (stopping_.load())
+            {
+                glDeleteSync(finished.fence);
+                deleteUpload(state, finished.upload);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    if (current)
+    {
+        release();
+    }
+}
+
+UploadWorker::Job meshFileJob(const std::string &path)
+{
+    return [path](GlStateCache &state, Upload &upload)
+    {
+        MeshFile mesh;
+        if (!mesh.open(path))
+        {
+            return false;
+        }
+
+        // Element buffers bind to the vertex array, and this context has none
+        // bound, so both buffers are filled through the copy target.
+        //
+        glGenBuffers(1, &upload.vertexBuffer);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, upload.vertexBuffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)mesh.vertexBytes(), mesh.vertices(), GL_STATIC_DRAW);
+        glGenBuffers(1, &upload.elementBuffer);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, upload.elementBuffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)mesh.indexBytes(), mesh.indices(), GL_STATIC_DRAW);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        const MeshFileHeader &header = mesh.header();
+        upload.indexCount = (GLsizei)header.indexCount;
+        upload.indexType = header.indexType;
+        upload.vertexStride = header.vertexStride;
+        upload.attributes.assign(mesh.attributes(), mesh.attributes() + header.attributeCount);
+        upload.bytes = mesh.vertexBytes() + mesh.indexBytes();
+        return true;
+    };
+}
+
+UploadWorker::Job shaderProgramJob(const std::string &vertexSource, const std::string &fragmentSource)
+{
+    return [vertexSource, fragmentSource](GlStateCache &, Upload &upload) -> bool
+    {
+        // Checking the link waits for the compiles, here rather than on the
+        // render thread; a failed job has its program deleted.
+        //
+        upload.program = buildShaderProgram(vertexSource.c_str(), fragmentSource.c_str());
+        int linked = GL_FALSE;
+        glGetProgramiv(upload.program, GL_LINK_STATUS, &linked);
+        return linked != GL_FALSE;
+    };
+}
+
+unsigned int createUploadVertexArray(GlStateCache &state, const Upload &upload)
+{
+    // Binding the buffers here, after the fence, is also what makes the other
+    // context's writes to them visible in this one.
+    //
+    unsigned int VAO;
+    glGenVertexArrays(1, &VAO);
+    state.bindVertexArray(VAO);
+    state.bindBuffer(GL_ARRAY_BUFFER, upload.vertexBuffer);
+    if (upload.elementBuffer != 0)
+    {
+        state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, upload.elementBuffer);
+    }
+    for (std::size_t i = 0; i < upload.attributes.size(); ++i)
+    {
+        const MeshFileAttribute &attribute = upload.attributes[i];
+        glVertexAttribPointer(attribute.location, (GLint)attribute.count, attribute.type,
+                              attribute.normalized ? GL_TRUE : GL_FALSE, (GLsizei)upload.vertexStride,
+                              (void *)(std::size_t)attribute.offset);
+        glEnableVertexAttribArray(attribute.location);
+    }
+    state.bindBuffer(GL_ARRAY_BUFFER, 0);
+    state.bindVertexArray(0);
+    return VAO;
+}
+
+void deleteUpload(GlStateCache &state, const Upload &upload)
+{
+    if (upload.vertexBuffer != 0)
+    {
+        state.deleteBuffer(upload.vertexBuffer);
+    }
+    if (upload.elementBuffer != 0)
+    {
+        state.deleteBuffer(upload.elementBuffer);
+    }
+    if (upload.texture != 0)
+    {
+        glDeleteTextures(1, &upload.texture);
+    }
+    if (upload.program != 0)
+    {
+        state.deleteProgram(upload.program);
+    }
+}
+
+const std::size_t UPLOAD_GRID_CELLS = 64; //!< Columns and rows of quads in each benchmark mesh.
+const GLsizei UPLOAD_TEXTURE_SIZE = 256;  //!< Width and height of each benchmark texture.
+
+/**
+ * @brief Texel of benchmark texture i, a checkerboard in a colour of its own.
+ */
+static std::uint32_t benchmarkTexel(std::size_t asset, GLsizei x, GLsizei y)
+{
+    const std::uint32_t shade = ((x / 16 + y / 16) & 1) != 0 ? 0xFFu : 0x40u;
+    return shade | (std::uint32_t)((asset * 37) & 0xFF) << 8 | (std::uint32_t)((asset * 91) & 0xFF) << 16 |
+           0xFF000000u;
+}
+
+/**
+ * @brief The job that makes benchmark asset i: a grid in its own tile of the screen and a texture.
+ *
+ * Generating the data is part of the job, standing in for reading and
+ * decoding a file.
+ */
+static UploadWorker::Job benchmarkJob(std::size_t asset, std::size_t columns)
+{
+    return [asset, columns](GlStateCache &state, Upload &upload)
+    {
+        std::vector<float> vertices;
+        std::vector<GLuint> indices;
+        generateGrid(UPLOAD_GRID_CELLS, UPLOAD_GRID_CELLS, vertices, indices);
+        const float tile = 2.0f / (float)columns;
+        const float left = -1.0f + tile * (float)(asset % columns);
+        const float bottom = -1.0f + tile * (float)(asset / columns);
+        for (std::size_t i = 0; i < vertices.size(); i += FLOATS_PER_VERTEX)
+        {
+            vertices[i] = left + (vertices[i] + 1.0f) * 0.45f * tile + 0.05f * tile;
+            vertices[i + 1] = bottom + (vertices[i + 1] + 1.0f) * 0.45f * tile + 0.05f * tile;
+        }
+
+        std::vector<std::uint32_t> texels((std::size_t)UPLOAD_TEXTURE_SIZE * UPLOAD_TEXTURE_SIZE);
+        for (GLsizei y = 0; y < UPLOAD_TEXTURE_SIZE; ++y)
+        {
+            for (GLsizei x = 0; x < UPLOAD_TEXTURE_SIZE; ++x)
+            {
+                texels[(std::size_t)y * UPLOAD_TEXTURE_SIZE + x] = benchmarkTexel(asset, x, y);
+            }
+        }
+
+        glGenBuffers(1, &upload.vertexBuffer);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, upload.vertexBuffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(vertices.size() * sizeof(float)), &vertices[0],
+                     GL_STATIC_DRAW);
+        glGenBuffers(1, &upload.elementBuffer);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, upload.elementBuffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(indices.size() * sizeof(GLuint)), &indices[0],
+                     GL_STATIC_DRAW);
+        state.bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        glGenTextures(1, &upload.texture);
+        glBindTexture(GL_TEXTURE_2D, upload.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, UPLOAD_TEXTURE_SIZE, UPLOAD_TEXTURE_SIZE, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, &texels[0]);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        const MeshFileAttribute position = {0, GL_FLOAT, 3, 0, 0, 0};
+        upload.attributes.assign(1, position);
+        upload.vertexStride = PositionLayout::STRIDE;
+        upload.indexCount = (GLsizei)indices.size();
+        upload.indexType = GL_UNSIGNED_INT;
+        upload.bytes = vertices.size() * sizeof(float) + indices.size() * sizeof(GLuint) + texels.size() * 4;
+        return true;
+    };
+}
+
+/**
+ * @brief Whether a texture holds what benchmarkJob() put in it.
+ */
+static bool checkBenchmarkTexture(std::size_t asset, unsigned int texture)
+{
+    std::vector<std::uint32_t> texels((std::size_t)UPLOAD_TEXTURE_SIZE * UPLOAD_TEXTURE_SIZE);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &texels[0]);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    for (GLsizei y = 0; y < UPLOAD_TEXTURE_SIZE; ++y)
+    {
+        for (GLsizei x = 0; x < UPLOAD_TEXTURE_SIZE; ++x)
+        {
+            if (texels[(std::size_t)y * UPLOAD_TEXTURE_SIZE + x] != benchmarkTexel(asset, x, y))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Ways of loading the assets that are compared.
+ */
+enum AssetLoadPath
+{
+    UPLOAD_BLOCKING,   //!< Everything on the render thread before the first frame.
+    UPLOAD_BACKGROUND, //!< On the upload worker while frames are drawn.
+    UPLOAD_PATHS
+};
+
+const char *const UPLOAD_PATH_NAMES[UPLOAD_PATHS] = {"blocking", "background"}; //!< Names for reports.
+
+void runUploadBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t assets, unsigned long frames,
+                        const std::function<bool()> &makeCurrent, const std::function<void()> &release,
+                        std::ostream &out)
+{
+    const std::size_t columns = (std::size_t)std::ceil(std::sqrt((double)assets));
+
+    std::vector<Upload> uploads;
+    std::vector<unsigned int> vertexArrays;
+
+    // Draws whatever has been loaded so far.
+    //
+    const auto drawFrame = [&]()
+    {
+        state.beginFrame();
+        state.clearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        state.useProgram(shaderProgram);
+        for (std::size_t i = 0; i < vertexArrays.size(); ++i)
+        {
+            state.bindVertexArray(vertexArrays[i]);
+            glDrawElements(GL_TRIANGLES, uploads[i].indexCount, uploads[i].indexType, (void *)0);
+        }
+    };
+    const auto deleteAll = [&]()
+    {
+        for (std::size_t i = 0; i < uploads.size(); ++i)
+        {
+            state.deleteVertexArray(vertexArrays[i]);
+            deleteUpload(state, uploads[i]);
+        }
+        uploads.clear();
+        vertexArrays.clear();
+    };
+    const auto elapsedMs = [](std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    };
+
+    double firstFrameMs[UPLOAD_PATHS];
+    double allDrawnMs[UPLOAD_PATHS];
+    FrameStats loadingFrames[UPLOAD_PATHS];
+    FrameStats steadyFrames[UPLOAD_PATHS];
+    std::uint64_t images[UPLOAD_PATHS];
+    std::size_t bytes = 0;
+    bool texturesIntact = true;
+    bool failed = false;
+
+    for (int path = 0; path < UPLOAD_PATHS; ++path)
+    {
+        glFinish();
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        UploadWorker worker;
+        if (path == UPLOAD_BLOCKING)
+        {
+            for (std::size_t i = 0; i < assets; ++i)
+            {
+                Upload upload;
+                clearUpload((std::uint32_t)i, upload);
+                benchmarkJob(i, columns)(state, upload);
+                vertexArrays.push_back(createUploadVertexArray(state, upload));
+                uploads.push_back(upload);
+            }
+        }
+        else
+        {
+            worker.start(makeCurrent, release);
+            for (std::size_t i = 0; i < assets; ++i)
+            {
+                worker.submit(benchmarkJob(i, columns));
+            }
+        }
+
+        // Frames until everything is drawn. In the background path each frame
+        // first takes whatever the worker has finished.
+        //
+        std::chrono::steady_clock::time_point frameStart = start;
+        firstFrameMs[path] = 0.0;
+        while (true)
+        {
+            Upload upload;
+            while (path == UPLOAD_BACKGROUND && worker.poll(upload))
+            {
+                if (!upload.loaded)
+                {
+                    failed = true;
+                    continue;
+                }
+                vertexArrays.push_back(createUploadVertexArray(state, upload));
+                uploads.push_back(upload);
+            }
+            drawFrame();
+            glFinish();
+            const double frameMs = elapsedMs(frameStart);
+            frameStart = std::chrono::steady_clock::now();
+            if (firstFrameMs[path] == 0.0)
+            {
+                firstFrameMs[path] = elapsedMs(start);
+            }
+            if (uploads.size() == assets || (path == UPLOAD_BACKGROUND && worker.pending() == 0))
+            {
+                break;
+            }
+            loadingFrames[path].addSample(frameMs);
+        }
+        allDrawnMs[path] = elapsedMs(start);
+
+        for (unsigned long frame = 0; frame < frames; ++frame)
+        {
+            frameStart = std::chrono::steady_clock::now();
+            drawFrame();
+            glFinish();
+            steadyFrames[path].addSample(elapsedMs(frameStart));
+        }
+        images[path] = hashFramebuffer();
+
+        bytes = 0;
+        for (std::size_t i = 0; i < uploads.size(); ++i)
+        {
+            bytes += uploads[i].bytes;
+            texturesIntact = texturesIntact && checkBenchmarkTexture(uploads[i].id, uploads[i].texture);
+        }
+        worker.stop();
+        deleteAll();
+    }
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "Uploads: " << assets << " meshes of " << UPLOAD_GRID_CELLS * UPLOAD_GRID_CELLS * 2 << " triangles with a "
+        << UPLOAD_TEXTURE_SIZE << "x" << UPLOAD_TEXTURE_SIZE << " texture each, " << bytes / (1024 * 1024)
+        << " MiB, on " << glGetString(GL_RENDERER) << std::endl;
+    out << std::fixed << std::setprecision(3);
+    for (int path = 0; path < UPLOAD_PATHS; ++path)
+    {
+        out << std::left << std::setw(12) << UPLOAD_PATH_NAMES[path] << std::right << "first frame after "
+            << firstFrameMs[path] << " ms, everything drawn after " << allDrawnMs[path] << " ms, "
+            << loadingFrames[path].count() << " frames while loading" << std::endl;
+        if (loadingFrames[path].count() > 0)
+        {
+            loadingFrames[path].report(out, "loading frame");
+        }
+        steadyFrames[path].report(out, "frame");
+    }
+    out << "same image: " << (images[UPLOAD_BLOCKING] == images[UPLOAD_BACKGROUND] ? "yes" : "NO")
+        << ", textures intact: " << (texturesIntact ? "yes" : "NO") << (failed ? ", SOME UPLOADS FAILED" : "")
+        << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,235 @@
+/**
+ * @file upload_worker.h
+ * @brief Loads and uploads buffers and textures on a second thread with a shared context.
+ *
+ * Loading a large mesh at startup means reading, converting and uploading it
+ * before the first frame, and loading one later means a long frame. The upload
+ * worker instead owns a second context that shares objects with the render
+ * context, made current on a thread of its own. It runs load jobs there and
+ * creates the buffers and textures in its own context, then puts a fence
+ * behind each job's commands with glFenceSync and hands the objects over.
+ *
+ * The render thread collects them with poll() once per frame. A job is only
+ * returned once its fence has signalled, so the render thread never uses an
+ * object whose data the GPU may still be copying, and never waits for one.
+ * Vertex arrays are not shared between contexts, so the render thread makes
+ * those itself from what the job reports.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef UPLOAD_WORKER_H
+#define UPLOAD_WORKER_H
+
+#include <glad/glad.h>
+
+#include "gl_state_cache.h"
+#include "mesh_file.h"
+#include "spsc_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The objects a job created and how to draw them.
+ *
+ * Owned by whoever polled it; delete the objects with deleteUpload().
+ */
+struct Upload
+{
+    std::uint32_t id;                          //!< Returned by submit().
+    bool loaded;                               //!< Whether the job succeeded; if not, there are no objects.
+    unsigned int vertexBuffer;                 //!< Vertex buffer, or 0.
+    unsigned int elementBuffer;                //!< Element buffer, or 0.
+    GLsizei indexCount;                        //!< Indices in the element buffer.
+    GLenum indexType;                          //!< GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+    std::uint32_t vertexStride;                //!< Bytes per vertex.
+    std::vector<MeshFileAttribute> attributes; //!< Layout of a vertex.
+    unsigned int texture;                      //!< 2D texture, or 0.
+    unsigned int program;                      //!< Linked shader program, or 0.
+    std::size_t bytes;                         //!< Bytes of buffer and texture data uploaded.
+    double loadMs;                             //!< Time from submit() to the fence being issued.
+};
+
+/**
+ * @brief Runs upload jobs on a thread with a context of its own.
+ *
+ * One thread submits and polls, normally the render thread; the worker thread
+ * runs the jobs in the order they were submitted and they are returned in
+ * that order.
+ */
+class UploadWorker
+{
+public:
+    static const std::size_t QUEUE_CAPACITY = 64; //!< Finished uploads waiting for poll() at once.
+
+    /**
+     * @brief Loads something and uploads it, on the worker thread.
+     *
+     * Called with the worker's context current and its own state cache; fills
+     * in the objects and layout of the upload, which is otherwise empty.
+     * Returning false drops whatever objects it set.
+     */
+    typedef std::function<bool(GlStateCache &state, Upload &upload)> Job;
+
+    UploadWorker();
+    ~UploadWorker();
+
+    /**
+     * @brief Starts the worker thread.
+     *
+     * @param makeCurrent makes a context that shares with the render context
+     *                    current; called on the worker thread, which gives up
+     *                    if it returns false
+     * @param release makes no context current; called on the worker thread
+     *                before it exits
+     */
+    void start(const std::function<bool()> &makeCurrent, const std::function<void()> &release);
+
+    /**
+     * @brief Queues a job.
+     *
+     * @param job the work to do on the worker thread
+     * @return the id its Upload will carry
+     */
+    std::uint32_t submit(const Job &job);
+
+    /**
+     * @brief Takes the next finished upload, without waiting.
+     *
+     * Requires the render context to be current.
+     *
+     * @param upload receives the upload; its objects are ready to use
+     * @return false if the next upload is not finished yet, or there is none
+     */
+    bool poll(Upload &upload);
+
+    /**
+     * @brief Jobs submitted and not yet returned by poll().
+     */
+    std::size_t pending() const { return pending_; }
+
+    /**
+     * @brief Stops the worker thread, deleting the objects of uploads not yet polled.
+     *
+     * Jobs not started yet are dropped. Requires the render context to be current.
+     */
+    void stop();
+
+private:
+    UploadWorker(const UploadWorker &);            // Not copyable.
+    UploadWorker &operator=(const UploadWorker &); // Not copyable.
+
+    /**
+     * @brief A job waiting for the worker.
+     */
+    struct Request
+    {
+        std::uint32_t id;
+        Job job;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    /**
+     * @brief A job the worker has finished.
+     */
+    struct Finished
+    {
+        Upload upload;
+        GLsync fence; // Signals once the GPU has the data; NULL if the job failed.
+    };
+
+    /**
+     * @brief Body of the worker thread.
+     */
+    void run(std::function<bool()> makeCurrent, std::function<void()> release);
+
+    /**
+     * @brief Deletes a finished upload's fence and objects from the render context.
+     */
+    static void discard(const Finished &finished);
+
+    SpscQueue<Finished, QUEUE_CAPACITY> finished_;
+    Finished next_;                 // Taken from finished_, waiting for its fence.
+    bool haveNext_;                 // Whether next_ holds an upload.
+    std::deque<Request> requests_;
+    std::mutex mutex_;
+    std::condition_variable wake_;  // Signals a new request or stopping_.
+    std::atomic<bool> stopping_;
+    std::uint32_t nextId_;
+    std::size_t pending_;           // Only touched by the submitting thread.
+    std::thread thread_;
+};
+
+/**
+ * @brief A job that maps a mesh file and uploads it straight from the mapping.
+ *
+ * @param path path of the mesh file
+ * @return the job
+ */
+UploadWorker::Job meshFileJob(const std::string &path);
+
+/**
+ * @brief A job that compiles and links a shader program, for drivers that can only compile on the calling thread.
+ *
+ * Compile and link errors are printed; a program that does not link is
+ * deleted and the job fails.
+ *
+ * @param vertexSource source of the vertex shader
+ * @param fragmentSource source of the fragment shader
+ * @return the job
+ */
+UploadWorker::Job shaderProgramJob(const std::string &vertexSource, const std::string &fragmentSource);
+
+/**
+ * @brief Makes a vertex array for an upload's buffers, in the calling context.
+ *
+ * @param state state cache to bind through
+ * @param upload a loaded upload with a vertex buffer
+ * @return the vertex array, with the element buffer bound
+ */
+unsigned int createUploadVertexArray(GlStateCache &state, const Upload &upload);
+
+/**
+ * @brief Deletes an upload's buffers, texture and program.
+ *
+ * @param state state cache to delete through
+ * @param upload the upload
+ */
+void deleteUpload(GlStateCache &state, const Upload &upload);
+
+/**
+ * @brief Compares loading meshes and textures before the first frame against loading them during rendering.
+ *
+ * The blocking path generates and uploads every asset on the render thread,
+ * then renders. The background path starts rendering at once and adds each
+ * asset to the frame as the worker publishes it. Reports the time to the first
+ * frame, the frame times while loading, the time until everything is drawn,
+ * and whether both end on the same image. Needs a current context with a
+ * render target bound.
+ *
+ * @param state state cache to render through
+ * @param shaderProgram program to draw the meshes with
+ * @param assets number of meshes to load, each with a texture
+ * @param frames frames to render after everything is loaded
+ * @param makeCurrent makes a context that shares with the current one current, for the worker
+ * @param release makes no context current, for the worker
+ * @param out stream to write the report to
+ */
+void runUploadBenchmark(GlStateCache &state, unsigned int shaderProgram, std::size_t assets, unsigned long frames,
+                        const std::function<bool()> &makeCurrent, const std::function<void()> &release,
+                        std::ostream &out);
+
+#endif // UPLOAD_WORKER_H
@@ -7,24 +7,27 @@
  *
  * @copyright Copyright (c) 2024
  */
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include "example_options.h"
+#include "frame_loop.h"
+#include "geometry.h"
+#include "gl_state_cache.h"
+#include "shader.h"
+#include "window.h"
 
-#include <iostream>
 #include <cstdlib>
 
-#define UNUSED(x) (void)(x) //!< Voids unused parameters to resolve unnused parameters warnings.
-
 /**
- * @brief The most basic vertex shader source as a string.
+ * @brief Vertex shader source as a string.
  *
- * This shader does no processing; it just forwards the data to the output.
+ * Moves each copy of the triangle by its own offset, which advances once per
+ * instance instead of once per vertex.
  */
 const char *vertexShaderSource = "#version 330 core \n"
                                  "layout (location = 0) in vec3 aPos;\n"
+                                 "layout (location = 1) in vec2 aOffset;\n"
                                  "void main()\n"
                                  "{\n"
-                                 "  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+                                 "  gl_Position = vec4(aPos.x + aOffset.x, aPos.y + aOffset.y, aPos.z, 1.0);\n"
                                  "}\0";
 
 /**
@@ -40,149 +43,78 @@ const char *fragmentShaderSource = "#version 330 core \n"
                                    "  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
                                    "}\0";
 
-/**
- * @brief Handler for resizing of the viewport with resizing of the window.
- *
- * @param window instance of the window being resized
- * @param width width of the window
- * @param height height of the window
- */
-void framebufferSizeCallback(GLFWwindow *window, int width, int height);
+const unsigned int WINDOW_WIDTH = 800;  //!< Window width.
+const unsigned int WINDOW_HEIGHT = 600; //!< Window height.
 
 /**
- * @brief Handler for input to the window.
+ * @brief Color to clear the window to.
  *
- * @param window instance of the window receiving the input
+ * I changed this to a nicer color than the ugly green set in the book.
  */
-void processInput(GLFWwindow *window);
+const float CLEAR_COLOR[4] = {0.2f, 0.3f, 0.3f, 1.0f};
 
-const unsigned int WINDOW_WIDTH = 800;  //!< Window width.
-const unsigned int WINDOW_HEIGHT = 600; //!< Window height.
-
-int main()
+int main(int argc, char *argv[])
 {
-    // Init and configure glwf.
-    //
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
-
-    // Create a window / context using GLFW.
-    //
-    GLFWwindow *window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Work-Through: Learn OpenGL  |  Hello Window!", NULL, NULL);
-    if (window == NULL)
+    ExampleOptions options;
+    if (!parseExampleOptions(argc, argv, options))
     {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
+        return EXIT_FAILURE;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback); // Set handler resizing.
 
-    // Init GLAD to get function pointers for OpenGL.
+    // Create a window / context using GLFW, and init GLAD to get function
+    // pointers for OpenGL. Headless, render offscreen instead.
     //
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    Window window;
+    if (!createExampleWindow(window, options, WINDOW_WIDTH, WINDOW_HEIGHT,
+                             "Work-Through: Learn OpenGL  |  Hello Window!"))
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
         return -1;
     }
 
     // Build shader program here for simplicity.
     //
     // Shaders are compiled and linked together into a kind of shader program,
-    // then used by OpenGL.
-    //
-    // Compile the vertex shader.
-    //
-    unsigned int vertexShader;
-    vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Ensure vertex shader compiled successfully.
-    //
-    int successful;
-    char infolog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &successful);
-    if (!successful)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-                  << infolog << std::endl;
-    }
-
-    // Compile the fragment shader.
-    //
-    unsigned int fragmentShader;
-    fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Ensure fragment shader compiled successfully.
-    //
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &successful);
-    if (!successful)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-                  << infolog << std::endl;
-    }
-
-    // Now that we have shaders, we link them into a shader program.
-    //
-    unsigned int shaderProgram;
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    // Ensure the shader program built successfully.
+    // then used by OpenGL. Compile and link errors are printed.
     //
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &successful);
-    if (!successful)
-    {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infolog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
-                  << infolog << std::endl;
-    }
-
-    // Clean up - source objects are no longer needed.
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    // End build of shader program.
+    unsigned int shaderProgram = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
 
     // Create the vertices and buffers necessary to render.
+    //
+    // Both triangles are the same shape, so the vertices of one triangle are
+    // stored once and drawn twice with instancing, each copy at its own offset.
 
     // clang-format off
     float vertices[] = {
-        -0.5f, -0.5f, 0.0f, // Left.
-         0.5f, -0.5f, 0.0f, // Right.
-         0.0f,  0.5f, 0.0f  // Top.
+        -0.45f, -0.5f, 0.0f, // Left.
+         0.45f, -0.5f, 0.0f, // Right.
+         0.0f,   0.5f, 0.0f  // Top.
     };
-    // clang-format on
 
-    unsigned int VBO; // Vertex buffer object.
-    unsigned int VAO; // Vertex buffer array.
-
-    glGenVertexArrays(1, &VAO); // Generate a vertex buffer array.
-    glGenBuffers(1, &VBO);      // Generate a vertex buffer object.
-    glBindVertexArray(VAO);     // Bind the vertex array first.
+    float offsets[] = {
+        -0.5f, 0.0f, // Left triangle.
+         0.5f, 0.0f  // Right triangle.
+    };
+    // clang-format on
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);                                        // Bind the vertex buffer object.
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); // Set the buffer data using the array of vertices.
+    GlStateCache state;
+    unsigned int VBO;         // Vertex buffer object.
+    unsigned int instanceVBO; // Vertex buffer object holding the offset of each triangle.
+    unsigned int VAO;         // Vertex buffer array.
+    createVertexArray(state, vertices, sizeof(vertices), VAO, VBO);
 
-    // Specify how the vertex data should be interpreted.
+    // Same for the offsets, except the divisor of 1 moves to the next offset
+    // once per instance rather than once per vertex.
     //
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
+    glGenBuffers(1, &instanceVBO); // Generate a vertex buffer object for the offsets.
+    state.bindVertexArray(VAO);
+    state.bindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(offsets), offsets, GL_STATIC_DRAW);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0); // Safely unbind since VBO is now registered as vertex attributes bound vertex.
-    glBindVertexArray(0);             // Safely unbind the VAO but this usually isn't necessary.
+    state.bindBuffer(GL_ARRAY_BUFFER, 0); // Safely unbind since VBO is now registered as vertex attributes bound vertex.
+    state.bindVertexArray(0);             // Safely unbind the VAO but this usually isn't necessary.
 
     // Uncomment to display as wireframe.
     //
@@ -192,58 +124,30 @@ int main()
     //
     // An iteration of the loop is typically referred to as a frame.
     //
-    while (!glfwWindowShouldClose(window))
-    {
-        // Call the input handler first.
-        //
-        processInput(window);
-
-        // Render.
-        //
-        // I changed this to a nicer color than the ugly green set in the book.
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-
-        // Draw a triangle!
-        //
-        glUseProgram(shaderProgram); // Set shader program in OpenGL.
-        glBindVertexArray(VAO);      // Binds the vertex array every frame.
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-        // glBindVertexArray(0); // NOTE: Unbinding isn't necessary every frame.
-
-        // Check events, then swap the front/back buffers via glfw.
-        //
-        glfwPollEvents();
-        glfwSwapBuffers(window);
-    }
+    FrameStats frameTimes(0, RECENT_FRAME_SAMPLES);
+    runFrameLoop(
+        window, state, CLEAR_COLOR,
+        [&]()
+        {
+            // Draw two triangles with a single draw call!
+            //
+            state.useProgram(shaderProgram); // Set shader program in OpenGL.
+            state.bindVertexArray(VAO);      // Binds the vertex array, unless it still is.
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 2);
+        },
+        &frameTimes, options.frames);
+    const bool passed = finishExampleRun(options, window, frameTimes);
 
     // Clean up after render loop has returned.
     //
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shaderProgram);
+    state.deleteVertexArray(VAO);
+    state.deleteBuffer(VBO);
+    state.deleteBuffer(instanceVBO);
+    state.deleteProgram(shaderProgram);
 
     // Clean up after glfw.
     //
-    glfwTerminate();
-
-    return EXIT_SUCCESS;
-}
-
-void processInput(GLFWwindow *window)
-{
-    // If escape key is pressed, close the window.
-    //
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-    {
-        glfwSetWindowShouldClose(window, true);
-    }
-}
+    window.destroy();
 
-void framebufferSizeCallback(GLFWwindow *window, int width, int height)
-{
-    // Whenever the window size changes, change the view port size to match.
-    //
-    glViewport(0, 0, width, height);
-    UNUSED(window);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
 }
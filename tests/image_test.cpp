@@ -0,0 +1,155 @@
+/**
+ * @file image_test.cpp
+ * @brief Runs an example headless and compares its last frame with a golden image.
+ *
+ * The example is run with --capture added to its command line, so it writes
+ * its last frame out, and fails the test itself if it exits with an error,
+ * such as when its frames are over the --frame-budget it was given. The
+ * capture is then compared with the golden image pixel by pixel: a pixel
+ * differs when any channel is more than --tolerance off, and the test fails
+ * when more than --max-differing percent of the pixels differ. On failure a
+ * diff image is written next to the capture, with the differing pixels in red.
+ *
+ * With GOLDEN_UPDATE=1 in the environment, the capture replaces the golden
+ * image instead, for when a change to the rendering is intended.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "image.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Prints the command line usage.
+ *
+ * @param program name the program was invoked with
+ */
+static void printUsage(const char *program)
+{
+    std::cout << "usage: " << program << " [--tolerance N] [--max-differing PERCENT] GOLDEN CAPTURE -- COMMAND...\n"
+              << "  GOLDEN                 PPM image the last frame should match\n"
+              << "  CAPTURE                file the example writes its last frame to\n"
+              << "  COMMAND                the example and its options; --capture CAPTURE is added\n"
+              << "  --tolerance N          largest difference of a channel that still counts as equal\n"
+              << "                         (default 2)\n"
+              << "  --max-differing PERCENT\n"
+              << "                         most pixels that may differ, in percent (default 0.1)" << std::endl;
+}
+
+/**
+ * @brief Quotes an argument for the shell.
+ */
+static std::string quote(const char *argument)
+{
+    std::string quoted = "'";
+    for (const char *c = argument; *c != '\0'; ++c)
+    {
+        quoted += *c == '\'' ? std::string("'\\''") : std::string(1, *c);
+    }
+    return quoted + "'";
+}
+
+int main(int argc, char *argv[])
+{
+    int tolerance = 2;
+    double maxDiffering = 0.1;
+    const char *golden = NULL;
+    const char *capture = NULL;
+    int command = 0;
+    for (int i = 1; i < argc && command == 0; ++i)
+    {
+        if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+        {
+            tolerance = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--max-differing") == 0 && i + 1 < argc)
+        {
+            maxDiffering = std::atof(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--") == 0)
+        {
+            command = i + 1;
+        }
+        else if (golden == NULL)
+        {
+            golden = argv[i];
+        }
+        else if (capture == NULL)
+        {
+            capture = argv[i];
+        }
+        else
+        {
+            command = -1;
+        }
+    }
+    if (golden == NULL || capture == NULL || command <= 0 || command >= argc)
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Run the example; it checks its own frame budget.
+    //
+    std::string line;
+    for (int i = command; i < argc; ++i)
+    {
+        line += quote(argv[i]) + " ";
+    }
+    line += "--capture " + quote(capture);
+    std::cout << line << std::endl;
+    if (std::system(line.c_str()) != 0)
+    {
+        std::cout << "FAILED: the example exited with an error" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Image actual;
+    if (!readPpm(capture, actual))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const char *update = std::getenv("GOLDEN_UPDATE");
+    if (update != NULL && std::strcmp(update, "1") == 0)
+    {
+        if (!writePpm(golden, actual))
+        {
+            return EXIT_FAILURE;
+        }
+        std::cout << "updated " << golden << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    Image expected;
+    if (!readPpm(golden, expected))
+    {
+        return EXIT_FAILURE;
+    }
+    ImageDifference difference;
+    Image diff;
+    if (!compareImages(expected, actual, tolerance, difference, &diff))
+    {
+        std::cout << "FAILED: the capture is " << actual.width << "x" << actual.height << ", the golden image "
+                  << expected.width << "x" << expected.height << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const double percent = 100.0 * (double)difference.differing / ((double)expected.width * expected.height);
+    std::cout << difference.differing << " pixels (" << percent << "%) differ by more than " << tolerance
+              << ", largest difference " << difference.largest << std::endl;
+    if (percent > maxDiffering)
+    {
+        const std::string diffPath = std::string(capture) + ".diff.ppm";
+        writePpm(diffPath.c_str(), diff);
+        std::cout << "FAILED: more than " << maxDiffering << "% of the pixels differ; see " << diffPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,582 @@
+/**
+ * @file mesh_import_test.cpp
+ * @brief Imports large synthetic OBJ and PLY files and checks the meshes that come out.
+ *
+ * Each file holds a grid of quads whose positions are all written twice, and
+ * alternate quads use either copy, so the import has to merge every position
+ * with its copy. The files are large enough to be cut into many chunks, so
+ * lines and records on either side of a chunk boundary are covered. The OBJ
+ * file reaches the second copy through negative indices, which are resolved
+ * across chunks. The expected vertices and indices are known exactly.
+ *
+ * Copies of the files with one index out of range, past the end or before
+ * the start, must be rejected; for OBJ the error has to name the line. PLY
+ * files are also written with CRLF line ends, as Windows tools do.
+ *
+ * A separate OBJ file holds numbers that are hard to parse: long mantissas,
+ * which take the eight-digits-at-a-time path, exponents, and values at or
+ * next to the halfway point between two floats, which need the slow path.
+ * Each must come out as the same bits as strtof gives.
+ *
+ * Needs no GL context. The files are written to the working directory and
+ * removed again.
+ *
+ * @author Jason Scott
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include "mesh_import.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+const std::size_t GRID_QUADS = 384;                                  //!< Quads along each side of the grid.
+const std::size_t GRID_POINTS = (GRID_QUADS + 1) * (GRID_QUADS + 1); //!< Distinct positions in the grid.
+const std::size_t GRID_FACES = GRID_QUADS * GRID_QUADS;              //!< Quads in the grid.
+const std::size_t BAD_FACE = GRID_FACES / 2 + 1;                     //!< Quad replaced by one with a bad index.
+const std::size_t TEST_THREADS = 4;                                  //!< Threads the imports parse on.
+const std::size_t RANDOM_NUMBERS = 20000;                            //!< Random numbers in the numbers file.
+
+/**
+ * @brief Which index of a file to put out of range, if any.
+ */
+enum BadIndex
+{
+    BAD_NONE,        //!< Every index is valid.
+    BAD_PAST_END,    //!< One index is past the last position.
+    BAD_BEFORE_START //!< One index is before the first position.
+};
+
+/**
+ * @brief Layouts of the PLY files written.
+ */
+enum PlyLayout
+{
+    LAYOUT_ASCII,
+    LAYOUT_LITTLE_ENDIAN,
+    LAYOUT_BIG_ENDIAN,
+    LAYOUT_ASCII_CRLF,        //!< ascii, with CRLF line ends throughout.
+    LAYOUT_LITTLE_ENDIAN_CRLF //!< little endian, with CRLF line ends in the header.
+};
+
+/**
+ * @brief Position of a point of the grid, exact both as a float and as the text written for it.
+ */
+static void gridPosition(std::size_t point, float position[3])
+{
+    const std::size_t i = point % (GRID_QUADS + 1);
+    const std::size_t j = point / (GRID_QUADS + 1);
+    position[0] = (float)i * 0.5f - 100.0f;
+    position[1] = (float)j * 0.25f;
+    position[2] = (float)((i * j) % 7) * 0.125f;
+}
+
+/**
+ * @brief Points at the corners of a quad of the grid, counter-clockwise.
+ */
+static void gridQuad(std::size_t quad, std::size_t corners[4])
+{
+    const std::size_t i = quad % GRID_QUADS;
+    const std::size_t j = quad / GRID_QUADS;
+    corners[0] = j * (GRID_QUADS + 1) + i;
+    corners[1] = corners[0] + 1;
+    corners[2] = corners[1] + GRID_QUADS + 1;
+    corners[3] = corners[0] + GRID_QUADS + 1;
+}
+
+/**
+ * @brief Writes the grid as an OBJ file: both copies of the positions, then the faces.
+ *
+ * Even quads use the first copy, through positive indices in the forms v,
+ * v/vt and v//vn; odd quads use the second copy through negative indices.
+ *
+ * @param path file to write
+ * @param bad which index to put out of range, in quad BAD_FACE
+ * @return the line of quad BAD_FACE, or 0 if the file could not be written
+ */
+static std::size_t writeObj(const char *path, BadIndex bad)
+{
+    std::FILE *file = std::fopen(path, "w");
+    if (file == NULL)
+    {
+        return 0;
+    }
+    std::fprintf(file, "# %zu x %zu quads, every position twice\n", GRID_QUADS, GRID_QUADS);
+    for (std::size_t copy = 0; copy < 2; ++copy)
+    {
+        for (std::size_t point = 0; point < GRID_POINTS; ++point)
+        {
+            float position[3];
+            gridPosition(point, position);
+            std::fprintf(file, "v %g %g %g\n", position[0], position[1], position[2]);
+        }
+    }
+
+    const std::size_t badLine = 1 + 2 * GRID_POINTS + BAD_FACE + 1;
+    for (std::size_t quad = 0; quad < GRID_FACES; ++quad)
+    {
+        std::size_t corners[4];
+        gridQuad(quad, corners);
+        if (quad == BAD_FACE && bad == BAD_PAST_END)
+        {
+            std::fprintf(file, "f %zu %zu %zu\n", corners[0] + 1, corners[1] + 1, 2 * GRID_POINTS + 1);
+        }
+        else if (quad == BAD_FACE && bad == BAD_BEFORE_START)
+        {
+            std::fprintf(file, "f -1 -2 -%zu\n", 2 * GRID_POINTS + 1);
+        }
+        else if (quad % 2 == 1)
+        {
+            // -1 is the last position, the second copy of the last point.
+            //
+            std::fprintf(file, "f -%zu -%zu -%zu -%zu\n", GRID_POINTS - corners[0], GRID_POINTS - corners[1],
+                         GRID_POINTS - corners[2], GRID_POINTS - corners[3]);
+        }
+        else if (quad % 4 == 2)
+        {
+            std::fprintf(file, "f %zu/1 %zu/2 %zu/3 %zu/4\n", corners[0] + 1, corners[1] + 1, corners[2] + 1,
+                         corners[3] + 1);
+        }
+        else
+        {
+            std::fprintf(file, "f %zu//1 %zu//1 %zu %zu\n", corners[0] + 1, corners[1] + 1, corners[2] + 1,
+                         corners[3] + 1);
+        }
+    }
+    const bool written = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && written ? badLine : 0;
+}
+
+/**
+ * @brief Writes a value to a binary PLY file in the file's byte order.
+ */
+template <typename T> static void writeBinary(std::FILE *file, T value, bool bigEndian)
+{
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    const std::uint16_t one = 1;
+    if ((*(const unsigned char *)&one == 1) == bigEndian)
+    {
+        for (std::size_t i = 0; i < sizeof(T) / 2; ++i)
+        {
+            std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+        }
+    }
+    std::fwrite(bytes, 1, sizeof(T), file);
+}
+
+/**
+ * @brief Writes the grid as a PLY file, with both copies of the positions in its vertex element.
+ *
+ * Even quads use the first copy, odd quads the second.
+ *
+ * @param path file to write
+ * @param layout ascii or binary, and the byte order of binary files
+ * @param bad which index to put out of range, in quad BAD_FACE
+ * @return true if the file was written
+ */
+static bool writePly(const char *path, PlyLayout layout, BadIndex bad)
+{
+    std::FILE *file = std::fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    const char *const formats[] = {"ascii", "binary_little_endian", "binary_big_endian", "ascii",
+                                   "binary_little_endian"};
+    const bool crlf = layout == LAYOUT_ASCII_CRLF || layout == LAYOUT_LITTLE_ENDIAN_CRLF;
+    const char *const n = crlf ? "\r\n" : "\n";
+    std::fprintf(file,
+                 "ply%sformat %s 1.0%scomment %zu x %zu quads, every position twice%s"
+                 "element vertex %zu%sproperty float x%sproperty float y%sproperty float z%s"
+                 "element face %zu%sproperty list uchar int vertex_indices%send_header%s",
+                 n, formats[layout], n, GRID_QUADS, GRID_QUADS, n, 2 * GRID_POINTS, n, n, n, n, GRID_FACES, n, n, n);
+
+    if (layout == LAYOUT_ASCII_CRLF)
+    {
+        layout = LAYOUT_ASCII;
+    }
+    else if (layout == LAYOUT_LITTLE_ENDIAN_CRLF)
+    {
+        layout = LAYOUT_LITTLE_ENDIAN;
+    }
+    const bool bigEndian = layout == LAYOUT_BIG_ENDIAN;
+    for (std::size_t copy = 0; copy < 2; ++copy)
+    {
+        for (std::size_t point = 0; point < GRID_POINTS; ++point)
+        {
+            float position[3];
+            gridPosition(point, position);
+            if (layout == LAYOUT_ASCII)
+            {
+                std::fprintf(file, "%g %g %g%s", position[0], position[1], position[2], n);
+                continue;
+            }
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                writeBinary(file, position[axis], bigEndian);
+            }
+        }
+    }
+
+    for (std::size_t quad = 0; quad < GRID_FACES; ++quad)
+    {
+        std::size_t corners[4];
+        gridQuad(quad, corners);
+        std::int32_t face[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            face[i] = (std::int32_t)(corners[i] + (quad % 2) * GRID_POINTS);
+        }
+        if (quad == BAD_FACE && bad == BAD_PAST_END)
+        {
+            face[3] = (std::int32_t)(2 * GRID_POINTS);
+        }
+        else if (quad == BAD_FACE && bad == BAD_BEFORE_START)
+        {
+            face[3] = -1;
+        }
+
+        if (layout == LAYOUT_ASCII)
+        {
+            std::fprintf(file, "4 %d %d %d %d%s", (int)face[0], (int)face[1], (int)face[2], (int)face[3], n);
+            continue;
+        }
+        writeBinary(file, (std::uint8_t)4, bigEndian);
+        for (int i = 0; i < 4; ++i)
+        {
+            writeBinary(file, face[i], bigEndian);
+        }
+    }
+    const bool written = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && written;
+}
+
+/**
+ * @brief Checks an imported grid against the one written.
+ *
+ * Both copies of each point must have become the point's vertex, numbered in
+ * the order of the first copy, and each quad two triangles fanned from its
+ * first corner.
+ *
+ * @param name name of the case, for errors
+ * @param vertices the imported vertices
+ * @param indices the imported indices
+ * @param stats what the import did
+ * @return true if the mesh is the grid
+ */
+static bool checkGrid(const std::string &name, const std::vector<float> &vertices, const std::vector<GLuint> &indices,
+                      const ImportStats &stats)
+{
+    if (vertices.size() != GRID_POINTS * 3 || indices.size() != GRID_FACES * 6)
+    {
+        std::cout << "FAILED: " << name << ": " << vertices.size() / 3 << " vertices and " << indices.size()
+                  << " indices, expected " << GRID_POINTS << " and " << GRID_FACES * 6 << std::endl;
+        return false;
+    }
+    if (stats.duplicates != GRID_POINTS)
+    {
+        std::cout << "FAILED: " << name << ": " << stats.duplicates << " vertices merged, expected " << GRID_POINTS
+                  << std::endl;
+        return false;
+    }
+    if (stats.chunks < 2)
+    {
+        std::cout << "FAILED: " << name << ": parsed in " << stats.chunks << " chunk, expected several" << std::endl;
+        return false;
+    }
+    for (std::size_t point = 0; point < GRID_POINTS; ++point)
+    {
+        float position[3];
+        gridPosition(point, position);
+        if (vertices[point * 3] != position[0] || vertices[point * 3 + 1] != position[1] ||
+            vertices[point * 3 + 2] != position[2])
+        {
+            std::cout << "FAILED: " << name << ": vertex " << point << " is (" << vertices[point * 3] << ", "
+                      << vertices[point * 3 + 1] << ", " << vertices[point * 3 + 2] << "), expected (" << position[0]
+                      << ", " << position[1] << ", " << position[2] << ")" << std::endl;
+            return false;
+        }
+    }
+    for (std::size_t quad = 0; quad < GRID_FACES; ++quad)
+    {
+        std::size_t corners[4];
+        gridQuad(quad, corners);
+        const std::size_t expected[6] = {corners[0], corners[1], corners[2], corners[0], corners[2], corners[3]};
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            if (indices[quad * 6 + i] != expected[i])
+            {
+                std::cout << "FAILED: " << name << ": index " << i << " of quad " << quad << " is "
+                          << indices[quad * 6 + i] << ", expected " << expected[i] << std::endl;
+                return false;
+            }
+        }
+    }
+    std::cout << name << ": " << GRID_POINTS << " vertices, " << GRID_FACES * 2 << " triangles, " << stats.duplicates
+              << " merged, " << stats.chunks << " chunks, " << stats.milliseconds << " ms" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Imports a file and checks that it is the grid.
+ */
+static bool importGrid(const std::string &name, const char *path, ThreadPool &pool)
+{
+    std::vector<float> vertices;
+    std::vector<GLuint> indices;
+    ImportStats stats;
+    if (!importMesh(path, pool, vertices, indices, &stats))
+    {
+        std::cout << "FAILED: " << name << ": the import failed" << std::endl;
+        return false;
+    }
+    return checkGrid(name, vertices, indices, stats);
+}
+
+/**
+ * @brief Imports a file with a bad index and checks that it is rejected.
+ *
+ * @param name name of the case, for errors
+ * @param path file to import
+ * @param pool threads to parse on
+ * @param where text the error has to contain, such as the line, or empty
+ * @return true if the import failed with such an error
+ */
+static bool rejectGrid(const std::string &name, const char *path, ThreadPool &pool, const std::string &where)
+{
+    // Catch the error the import prints, to look for the line in it.
+    //
+    std::ostringstream log;
+    std::streambuf *const out = std::cout.rdbuf(log.rdbuf());
+    std::vector<float> vertices;
+    std::vector<GLuint> indices;
+    const bool imported = importMesh(path, pool, vertices, indices);
+    std::cout.rdbuf(out);
+
+    const std::string error = log.str();
+    if (imported)
+    {
+        std::cout << "FAILED: " << name << ": a file with an index out of range was imported" << std::endl;
+        return false;
+    }
+    if (error.find("ERROR::MESH_IMPORT::BAD_INDEX") == std::string::npos || error.find(where) == std::string::npos)
+    {
+        std::cout << "FAILED: " << name << ": expected a bad index error naming \"" << where << "\", got: " << error;
+        return false;
+    }
+    std::cout << name << ": rejected with " << error;
+    return true;
+}
+
+/**
+ * @brief Numbers that are hard to parse to the nearest float.
+ *
+ * Fixed cases first: long mantissas, exponents, denormals, and decimals at,
+ * just below and just above the halfway point between two floats, where
+ * rounding to a double first would go wrong. Then random ones: random digits
+ * with the point anywhere and a random exponent, and the halfway points of
+ * random floats written with 9 to 25 significant digits.
+ */
+static std::vector<std::string> hardNumbers()
+{
+    const char *const fixed[] = {
+        "3.14159265358979323846", "123456789", "1234567890123456789", "12345678901234567890123", "0.000012345678901234",
+        "98765432.123456789", "-0.0", "0", "1e0", "1.5e-07", "-4.2e-3", "2.5E+05", "6.02214076e+23", "1e38",
+        "3.4028234e38", "3.40282346638528859811704183484516925440e+38", "1.17549435e-38", "1e-38", "1.4e-45", "1e-45",
+        "7e-46", "1e-50", "9.999999e-39", "16777217", "16777217.0", "16777219", "16777216.999999999",
+        "16777217.000000001", "0.5000000298023223876953125", "0.50000002980232238769531249",
+        "0.50000002980232238769531251", "1.000000059604644775390625", "1.00000005960464477539062500001",
+        "1.00000005960464477539062499999", "33554435", "0.1", "0.2", "0.3", "1.1", "7.038531e-26",
+        "8.589973e9", "4.4501477170144023e-308", "0.000000000000000000000000000000000000011754943508222875"};
+
+    std::vector<std::string> numbers(fixed, fixed + sizeof(fixed) / sizeof(fixed[0]));
+    std::mt19937 random(20261016);
+    char text[64];
+    for (std::size_t i = 0; i < RANDOM_NUMBERS; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            // Random digits with the point anywhere, and an exponent that
+            // keeps them between the denormals and FLT_MAX.
+            //
+            std::string number = random() % 4 == 0 ? "-" : "";
+            const int digits = 1 + (int)(random() % 24);
+            const int point = (int)(random() % (digits + 1));
+            for (int digit = 0; digit < digits; ++digit)
+            {
+                if (digit == point && digit > 0)
+                {
+                    number += '.';
+                }
+                number += (char)('0' + random() % 10);
+            }
+            if (random() % 2 == 0)
+            {
+                const int exponent = (int)(random() % 70) - 40 - point;
+                std::snprintf(text, sizeof(text), "e%+03d", exponent);
+                number += text;
+            }
+            numbers.push_back(number);
+        }
+        else
+        {
+            // The halfway point between a random float and the next one is
+            // exact as a double; fewer digits put the text just off it.
+            //
+            std::uint32_t bits = random() & 0x7F7FFFFFu;
+            float below;
+            std::memcpy(&below, &bits, sizeof(below));
+            const float above = std::nextafter(below, FLT_MAX);
+            const double halfway = ((double)below + (double)above) / 2.0;
+            std::snprintf(text, sizeof(text), "%.*g", 9 + (int)(random() % 17), halfway);
+            numbers.push_back(text);
+        }
+    }
+    return numbers;
+}
+
+/**
+ * @brief Imports hard to parse numbers from an OBJ file and compares them with strtof, bit for bit.
+ *
+ * Each vertex holds two of the numbers as x and z, and its number as y so
+ * that no two are merged. Triangles use the vertices in order, so they come
+ * out in the order they were written.
+ *
+ * @param name name of the case, for errors
+ * @param path file to write and import
+ * @param pool threads to parse on
+ * @return true if every number came out as strtof reads it
+ */
+static bool importNumbers(const std::string &name, const char *path, ThreadPool &pool)
+{
+    std::vector<std::string> numbers = hardNumbers();
+    while (numbers.size() % 6 != 0)
+    {
+        numbers.push_back("1");
+    }
+    const std::size_t count = numbers.size() / 2;
+
+    std::FILE *file = std::fopen(path, "w");
+    if (file == NULL)
+    {
+        std::cout << "FAILED: " << name << ": could not write " << path << std::endl;
+        return false;
+    }
+    for (std::size_t vertex = 0; vertex < count; ++vertex)
+    {
+        std::fprintf(file, "v %s %zu %s\n", numbers[vertex * 2].c_str(), vertex, numbers[vertex * 2 + 1].c_str());
+    }
+    for (std::size_t vertex = 0; vertex < count; vertex += 3)
+    {
+        std::fprintf(file, "f %zu %zu %zu\n", vertex + 1, vertex + 2, vertex + 3);
+    }
+    const bool written = std::ferror(file) == 0;
+    if (std::fclose(file) != 0 || !written)
+    {
+        std::cout << "FAILED: " << name << ": could not write " << path << std::endl;
+        return false;
+    }
+
+    std::vector<float> vertices;
+    std::vector<GLuint> indices;
+    const bool imported = importMesh(path, pool, vertices, indices);
+    std::remove(path);
+    if (!imported || vertices.size() != count * 3)
+    {
+        std::cout << "FAILED: " << name << ": " << vertices.size() / 3 << " vertices imported, expected " << count
+                  << std::endl;
+        return false;
+    }
+
+    std::size_t wrong = 0;
+    for (std::size_t i = 0; i < numbers.size(); ++i)
+    {
+        // The import turns -0 into 0, so the two merge.
+        //
+        float expected = std::strtof(numbers[i].c_str(), NULL);
+        expected = expected == 0.0f ? 0.0f : expected;
+        const float actual = vertices[i / 2 * 3 + (i % 2) * 2];
+        std::uint32_t expectedBits;
+        std::uint32_t actualBits;
+        std::memcpy(&expectedBits, &expected, sizeof(expectedBits));
+        std::memcpy(&actualBits, &actual, sizeof(actualBits));
+        if (actualBits != expectedBits && ++wrong <= 10)
+        {
+            std::cout << "FAILED: " << name << ": " << numbers[i] << " read as " << std::hexfloat << actual
+                      << ", strtof gives " << expected << std::defaultfloat << std::endl;
+        }
+    }
+    if (wrong > 0)
+    {
+        std::cout << "FAILED: " << name << ": " << wrong << " of " << numbers.size() << " numbers differ" << std::endl;
+        return false;
+    }
+    std::cout << name << ": " << numbers.size() << " numbers read as strtof reads them" << std::endl;
+    return true;
+}
+
+int main()
+{
+    ThreadPool pool(TEST_THREADS);
+    bool passed = true;
+
+    const char *const objPath = "mesh-import-test.obj";
+    if (writeObj(objPath, BAD_NONE) == 0)
+    {
+        std::cout << "FAILED: could not write " << objPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    passed = importGrid("obj", objPath, pool) && passed;
+
+    const BadIndex badIndices[] = {BAD_PAST_END, BAD_BEFORE_START};
+    const char *const badNames[] = {"past the end", "before the start"};
+    for (int bad = 0; bad < 2; ++bad)
+    {
+        const std::size_t line = writeObj(objPath, badIndices[bad]);
+        std::ostringstream where;
+        where << objPath << ":" << line << "\n";
+        passed = line != 0 && rejectGrid(std::string("obj, index ") + badNames[bad], objPath, pool, where.str()) &&
+                 passed;
+    }
+    std::remove(objPath);
+
+    const char *const plyPath = "mesh-import-test.ply";
+    const PlyLayout layouts[] = {LAYOUT_ASCII, LAYOUT_LITTLE_ENDIAN, LAYOUT_BIG_ENDIAN, LAYOUT_ASCII_CRLF,
+                                 LAYOUT_LITTLE_ENDIAN_CRLF};
+    const char *const layoutNames[] = {"ascii ply", "little endian ply", "big endian ply", "ascii ply with crlf",
+                                       "little endian ply with crlf"};
+    for (int layout = 0; layout < 5; ++layout)
+    {
+        if (!writePly(plyPath, layouts[layout], BAD_NONE))
+        {
+            std::cout << "FAILED: could not write " << plyPath << std::endl;
+            return EXIT_FAILURE;
+        }
+        passed = importGrid(layoutNames[layout], plyPath, pool) && passed;
+        for (int bad = 0; bad < 2; ++bad)
+        {
+            passed = writePly(plyPath, layouts[layout], badIndices[bad]) &&
+                     rejectGrid(std::string(layoutNames[layout]) + ", index " + badNames[bad], plyPath, pool,
+                                plyPath) &&
+                     passed;
+        }
+    }
+    std::remove(plyPath);
+
+    passed = importNumbers("numbers", "mesh-import-test-numbers.obj", pool) && passed;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}